@@ -231,6 +231,12 @@ void glp_term_hook(void (*func)(const char *s));
 #endif
 
 /* install hook to intercept terminal output */
+
+#ifdef HAVE_ENV
+void *glp_term_info(void);
+/* retrieve transit pointer of terminal hook */
+#endif
+
 int glp_open_tee(const char *fname);
 /* start copying terminal output to text file */
 
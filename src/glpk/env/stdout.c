@@ -244,6 +244,32 @@ void glp_term_hook(void (*func)(const char *s))
 }
 #endif
 
+#if 1 /* 19/X-2026 */
+#ifdef HAVE_ENV
+/***********************************************************************
+*  NAME
+*
+*  glp_term_info - retrieve transit pointer of terminal hook
+*
+*  SYNOPSIS
+*
+*  void *glp_term_info(void);
+*
+*  RETURNS
+*
+*  The routine glp_term_info returns the transit pointer, which is
+*  currently passed to the hook routine intercepting terminal output in
+*  the calling thread, or NULL if no hook routine is installed. Other
+*  hook routines may use it to send their output the same way. */
+
+void *glp_term_info(void)
+{
+      ENV *env = get_env_ptr();
+      return env->term_hook == NULL ? NULL : env->term_info;
+}
+#endif
+#endif
+
 
 
 /***********************************************************************
@@ -80,6 +80,7 @@ static void create_prob(glp_prob *lp)
       lp->n_max = 200;
       lp->m = lp->n = 0;
       lp->nnz = 0;
+      lp->rev = 0;
       lp->row = xcalloc(1+lp->m_max, sizeof(GLPROW *));
       lp->col = xcalloc(1+lp->n_max, sizeof(GLPCOL *));
       lp->r_tree = lp->c_tree = NULL;
@@ -98,9 +99,13 @@ static void create_prob(glp_prob *lp)
       /* interior-point solution (LP) */
       lp->ipt_stat = GLP_UNDEF;
       lp->ipt_obj = 0.0;
+      lp->ipt_xret = -1;
       /* integer solution (MIP) */
       lp->mip_stat = GLP_UNDEF;
       lp->mip_obj = 0.0;
+      /* solution pool (MIP) */
+      lp->sp_max = lp->sp_cnt = lp->sp_n = 0;
+      lp->sp_obj = lp->sp_x = NULL;
       return;
 }
 
@@ -320,6 +325,7 @@ int glp_add_rows(glp_prob *lp, int nrs)
 #if 1
       if (tree != NULL && tree->reason != 0) tree->reopt = 1;
 #endif
+      lp->rev++;
       /* return the ordinal number of the first row added */
       return m_new - nrs + 1;
 }
@@ -397,6 +403,9 @@ int glp_add_cols(glp_prob *lp, int ncs)
       }
       /* set new number of columns */
       lp->n = n_new;
+      lp->rev++;
+      /* pooled solutions do not correspond to the new column list */
+      ios_spool_free(lp);
       /* return the ordinal number of the first column added */
       return n_new - ncs + 1;
 }
@@ -814,6 +823,7 @@ void glp_set_mat_row(glp_prob *lp, int i, int len, const int ind[],
             dmp_free_atom(lp->pool, aij, sizeof(GLPAIJ)), lp->nnz--;
          }
       }
+      lp->rev++;
       return;
 }
 
@@ -934,6 +944,7 @@ void glp_set_mat_col(glp_prob *lp, int j, int len, const int ind[],
       }
       /* if j-th column is basic, invalidate the basis factorization */
       if (col->stat == GLP_BS) lp->valid = 0;
+      lp->rev++;
       return;
 }
 
@@ -1070,6 +1081,7 @@ void glp_load_matrix(glp_prob *lp, int ne, const int ia[],
       }
       /* invalidate the basis factorization */
       lp->valid = 0;
+      lp->rev++;
       return;
 }
 
@@ -1315,6 +1327,7 @@ void glp_del_rows(glp_prob *lp, int nrs, const int num[])
       lp->m = m_new;
       /* invalidate the basis factorization */
       lp->valid = 0;
+      lp->rev++;
       return;
 }
 
@@ -1401,6 +1414,9 @@ void glp_del_cols(glp_prob *lp, int ncs, const int num[])
             }
          }
       }
+      lp->rev++;
+      /* pooled solutions do not correspond to the new column list */
+      ios_spool_free(lp);
       return;
 }
 
@@ -1454,6 +1470,7 @@ void glp_copy_prob(glp_prob *dest, glp_prob *prob, int names)
       dest->some = prob->some;
       dest->ipt_stat = prob->ipt_stat;
       dest->ipt_obj = prob->ipt_obj;
+      dest->ipt_xret = prob->ipt_xret;
       dest->mip_stat = prob->mip_stat;
       dest->mip_obj = prob->mip_obj;
       for (i = 1; i <= prob->m; i++)
@@ -1499,6 +1516,87 @@ void glp_copy_prob(glp_prob *dest, glp_prob *prob, int names)
       return;
 }
 
+/***********************************************************************
+*  NAME
+*
+*  glp_copy_sol - copy solution between problem objects
+*
+*  SYNOPSIS
+*
+*  void glp_copy_sol(glp_prob *dest, glp_prob *prob, int sol);
+*
+*  DESCRIPTION
+*
+*  The routine glp_copy_sol copies the solution of the specified kind
+*  from the problem object prob to the problem object dest, which both
+*  should have the same number of rows and columns. Problem data stored
+*  in the object dest, including symbolic names and their indices, are
+*  not changed.
+*
+*  The parameter sol specifies which solution should be copied:
+*
+*  GLP_SOL - basic solution, which includes the statuses of rows and
+*            columns (the basis factorization of dest is invalidated);
+*  GLP_IPT - interior-point solution;
+*  GLP_MIP - mixed integer solution. */
+
+void glp_copy_sol(glp_prob *dest, glp_prob *prob, int sol)
+{     glp_tree *tree = dest->tree;
+      int i, j;
+      if (tree != NULL && tree->reason != 0)
+         xerror("glp_copy_sol: operation not allowed\n");
+      if (dest == prob)
+         xerror("glp_copy_sol: copying solution to itself not allowed\n"
+            );
+      if (!(dest->m == prob->m && dest->n == prob->n))
+         xerror("glp_copy_sol: dest = %d x %d, prob = %d x %d; problem"
+            " sizes mismatch\n", dest->m, dest->n, prob->m, prob->n);
+      switch (sol)
+      {  case GLP_SOL:
+            dest->valid = 0;
+            dest->pbs_stat = prob->pbs_stat;
+            dest->dbs_stat = prob->dbs_stat;
+            dest->obj_val = prob->obj_val;
+            dest->it_cnt = prob->it_cnt;
+            dest->some = prob->some;
+            for (i = 1; i <= prob->m; i++)
+            {  dest->row[i]->stat = prob->row[i]->stat;
+               dest->row[i]->prim = prob->row[i]->prim;
+               dest->row[i]->dual = prob->row[i]->dual;
+            }
+            for (j = 1; j <= prob->n; j++)
+            {  dest->col[j]->stat = prob->col[j]->stat;
+               dest->col[j]->prim = prob->col[j]->prim;
+               dest->col[j]->dual = prob->col[j]->dual;
+            }
+            break;
+         case GLP_IPT:
+            dest->ipt_stat = prob->ipt_stat;
+            dest->ipt_obj = prob->ipt_obj;
+            dest->ipt_xret = prob->ipt_xret;
+            for (i = 1; i <= prob->m; i++)
+            {  dest->row[i]->pval = prob->row[i]->pval;
+               dest->row[i]->dval = prob->row[i]->dval;
+            }
+            for (j = 1; j <= prob->n; j++)
+            {  dest->col[j]->pval = prob->col[j]->pval;
+               dest->col[j]->dval = prob->col[j]->dval;
+            }
+            break;
+         case GLP_MIP:
+            dest->mip_stat = prob->mip_stat;
+            dest->mip_obj = prob->mip_obj;
+            for (i = 1; i <= prob->m; i++)
+               dest->row[i]->mipx = prob->row[i]->mipx;
+            for (j = 1; j <= prob->n; j++)
+               dest->col[j]->mipx = prob->col[j]->mipx;
+            break;
+         default:
+            xerror("glp_copy_sol: sol = %d; invalid parameter\n", sol);
+      }
+      return;
+}
+
 /***********************************************************************
 *  NAME
 *
@@ -1520,10 +1618,12 @@ static void delete_prob(glp_prob *lp);
 
 void glp_erase_prob(glp_prob *lp)
 {     glp_tree *tree = lp->tree;
+      int rev = lp->rev;
       if (tree != NULL && tree->reason != 0)
          xerror("glp_erase_prob: operation not allowed\n");
       delete_prob(lp);
       create_prob(lp);
+      lp->rev = rev + 1;
       return;
 }
 
@@ -1564,6 +1664,7 @@ static void delete_prob(glp_prob *lp)
       if (lp->bfcp != NULL) xfree(lp->bfcp);
 #endif
       if (lp->bfd != NULL) bfd_delete_it(lp->bfd);
+      ios_spool_free(lp);
       return;
 }
 
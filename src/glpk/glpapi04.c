@@ -55,6 +55,7 @@ void glp_set_rii(glp_prob *lp, int i, double rii)
             }
          }
       }
+      if (lp->row[i]->rii != rii) lp->rev++;
       lp->row[i]->rii = rii;
       return;
 }
@@ -84,6 +85,7 @@ void glp_set_sjj(glp_prob *lp, int j, double sjj)
       {  /* invalidate the basis factorization */
          lp->valid = 0;
       }
+      if (lp->col[j]->sjj != sjj) lp->rev++;
       lp->col[j]->sjj = sjj;
       return;
 }
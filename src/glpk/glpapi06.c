@@ -102,6 +102,10 @@
 *     The search was prematurely terminated, because the time limit has
 *     been exceeded.
 *
+*  GLP_ESTOP
+*     The search was prematurely terminated, because the callback routine
+*     stop_fn specified in the control parameters requested termination.
+*
 *  GLP_ENOPFS
 *     The LP problem instance has no primal feasible solution (only if
 *     the LP presolver is used).
@@ -220,30 +224,38 @@ up:         col->stat = GLP_NU, col->prim = col->ub;
       return;
 }
 
-static int solve_lp(glp_prob *P, const glp_smcp *parm)
-{     /* solve LP directly without using the preprocessor */
-      int ret;
+static int factorize_lp(const char *func, glp_prob *P,
+      const glp_smcp *parm)
+{     /* compute initial basis factorization, if necessary */
+      int ret = 0;
       if (!glp_bf_exists(P))
       {  ret = glp_factorize(P);
          if (ret == 0)
             ;
          else if (ret == GLP_EBADB)
          {  if (parm->msg_lev >= GLP_MSG_ERR)
-               xprintf("glp_simplex: initial basis is invalid\n");
+               xprintf("%s: initial basis is invalid\n", func);
          }
          else if (ret == GLP_ESING)
          {  if (parm->msg_lev >= GLP_MSG_ERR)
-               xprintf("glp_simplex: initial basis is singular\n");
+               xprintf("%s: initial basis is singular\n", func);
          }
          else if (ret == GLP_ECOND)
          {  if (parm->msg_lev >= GLP_MSG_ERR)
-               xprintf(
-                  "glp_simplex: initial basis is ill-conditioned\n");
+               xprintf("%s: initial basis is ill-conditioned\n",
+                  func);
          }
          else
             xassert(ret != ret);
-         if (ret != 0) goto done;
       }
+      return ret;
+}
+
+static int solve_lp(glp_prob *P, const glp_smcp *parm)
+{     /* solve LP directly without using the preprocessor */
+      int ret;
+      ret = factorize_lp("glp_simplex", P, parm);
+      if (ret != 0) goto done;
       if (parm->meth == GLP_PRIMAL)
          ret = spx_primal(P, parm);
       else if (parm->meth == GLP_DUALP)
@@ -369,87 +381,101 @@ done: /* delete the transformed LP, if it exists */
       return ret;
 }
 
-int glp_simplex(glp_prob *P, const glp_smcp *parm)
-{     /* solve LP problem with the simplex method */
-      glp_smcp _parm;
-      int i, j, ret;
-      /* check problem object */
-      if (P == NULL || P->magic != GLP_PROB_MAGIC)
-         xerror("glp_simplex: P = %p; invalid problem object\n", P);
-      if (P->tree != NULL && P->tree->reason != 0)
-         xerror("glp_simplex: operation not allowed\n");
-      /* check control parameters */
-      if (parm == NULL)
-         parm = &_parm, glp_init_smcp((glp_smcp *)parm);
+static void check_parm(const char *func, const glp_smcp *parm)
+{     /* check simplex method control parameters */
       if (!(parm->msg_lev == GLP_MSG_OFF ||
             parm->msg_lev == GLP_MSG_ERR ||
             parm->msg_lev == GLP_MSG_ON  ||
             parm->msg_lev == GLP_MSG_ALL ||
             parm->msg_lev == GLP_MSG_DBG))
-         xerror("glp_simplex: msg_lev = %d; invalid parameter\n",
-            parm->msg_lev);
+         xerror("%s: msg_lev = %d; invalid parameter\n",
+            func, parm->msg_lev);
       if (!(parm->meth == GLP_PRIMAL ||
             parm->meth == GLP_DUALP  ||
             parm->meth == GLP_DUAL))
-         xerror("glp_simplex: meth = %d; invalid parameter\n",
-            parm->meth);
+         xerror("%s: meth = %d; invalid parameter\n",
+            func, parm->meth);
       if (!(parm->pricing == GLP_PT_STD ||
             parm->pricing == GLP_PT_PSE))
-         xerror("glp_simplex: pricing = %d; invalid parameter\n",
-            parm->pricing);
+         xerror("%s: pricing = %d; invalid parameter\n",
+            func, parm->pricing);
       if (!(parm->r_test == GLP_RT_STD ||
             parm->r_test == GLP_RT_HAR))
-         xerror("glp_simplex: r_test = %d; invalid parameter\n",
-            parm->r_test);
+         xerror("%s: r_test = %d; invalid parameter\n",
+            func, parm->r_test);
       if (!(0.0 < parm->tol_bnd && parm->tol_bnd < 1.0))
-         xerror("glp_simplex: tol_bnd = %g; invalid parameter\n",
-            parm->tol_bnd);
+         xerror("%s: tol_bnd = %g; invalid parameter\n",
+            func, parm->tol_bnd);
       if (!(0.0 < parm->tol_dj && parm->tol_dj < 1.0))
-         xerror("glp_simplex: tol_dj = %g; invalid parameter\n",
-            parm->tol_dj);
+         xerror("%s: tol_dj = %g; invalid parameter\n",
+            func, parm->tol_dj);
       if (!(0.0 < parm->tol_piv && parm->tol_piv < 1.0))
-         xerror("glp_simplex: tol_piv = %g; invalid parameter\n",
-            parm->tol_piv);
+         xerror("%s: tol_piv = %g; invalid parameter\n",
+            func, parm->tol_piv);
       if (parm->it_lim < 0)
-         xerror("glp_simplex: it_lim = %d; invalid parameter\n",
-            parm->it_lim);
+         xerror("%s: it_lim = %d; invalid parameter\n",
+            func, parm->it_lim);
       if (parm->tm_lim < 0)
-         xerror("glp_simplex: tm_lim = %d; invalid parameter\n",
-            parm->tm_lim);
+         xerror("%s: tm_lim = %d; invalid parameter\n",
+            func, parm->tm_lim);
       if (parm->out_frq < 1)
-         xerror("glp_simplex: out_frq = %d; invalid parameter\n",
-            parm->out_frq);
+         xerror("%s: out_frq = %d; invalid parameter\n",
+            func, parm->out_frq);
       if (parm->out_dly < 0)
-         xerror("glp_simplex: out_dly = %d; invalid parameter\n",
-            parm->out_dly);
+         xerror("%s: out_dly = %d; invalid parameter\n",
+            func, parm->out_dly);
       if (!(parm->presolve == GLP_ON || parm->presolve == GLP_OFF))
-         xerror("glp_simplex: presolve = %d; invalid parameter\n",
-            parm->presolve);
-      /* basic solution is currently undefined */
-      P->pbs_stat = P->dbs_stat = GLP_UNDEF;
-      P->obj_val = 0.0;
-      P->some = 0;
-      /* check bounds of double-bounded variables */
+         xerror("%s: presolve = %d; invalid parameter\n",
+            func, parm->presolve);
+      return;
+}
+
+static int check_bnds(const char *func, glp_prob *P,
+      const glp_smcp *parm)
+{     /* check bounds of double-bounded variables */
+      int i, j;
       for (i = 1; i <= P->m; i++)
       {  GLPROW *row = P->row[i];
          if (row->type == GLP_DB && row->lb >= row->ub)
          {  if (parm->msg_lev >= GLP_MSG_ERR)
-               xprintf("glp_simplex: row %d: lb = %g, ub = %g; incorrec"
-                  "t bounds\n", i, row->lb, row->ub);
-            ret = GLP_EBOUND;
-            goto done;
+               xprintf("%s: row %d: lb = %g, ub = %g; incorrect b"
+                  "ounds\n", func, i, row->lb, row->ub);
+            return GLP_EBOUND;
          }
       }
       for (j = 1; j <= P->n; j++)
       {  GLPCOL *col = P->col[j];
          if (col->type == GLP_DB && col->lb >= col->ub)
          {  if (parm->msg_lev >= GLP_MSG_ERR)
-               xprintf("glp_simplex: column %d: lb = %g, ub = %g; incor"
-                  "rect bounds\n", j, col->lb, col->ub);
-            ret = GLP_EBOUND;
-            goto done;
+               xprintf("%s: column %d: lb = %g, ub = %g; incorrect "
+                  "bounds\n", func, j, col->lb, col->ub);
+            return GLP_EBOUND;
          }
       }
+      return 0;
+}
+
+int glp_simplex(glp_prob *P, const glp_smcp *parm)
+{     /* solve LP problem with the simplex method */
+      glp_smcp _parm;
+      int ret;
+      /* check problem object */
+      if (P == NULL || P->magic != GLP_PROB_MAGIC)
+         xerror("glp_simplex: P = %p; invalid problem object\n", P);
+      if (P->tree != NULL && P->tree->reason != 0)
+         xerror("glp_simplex: operation not allowed\n");
+      /* check control parameters */
+      if (parm == NULL)
+         parm = &_parm, glp_init_smcp((glp_smcp *)parm);
+      check_parm("glp_simplex", parm);
+      /* basic solution is currently undefined */
+      P->pbs_stat = P->dbs_stat = GLP_UNDEF;
+      P->obj_val = 0.0;
+      P->some = 0;
+      /* check bounds of double-bounded variables */
+      ret = check_bnds("glp_simplex", P, parm);
+      if (ret != 0)
+         goto done;
       /* solve LP problem */
       if (parm->msg_lev >= GLP_MSG_ALL)
       {  xprintf("GLPK Simplex Optimizer, v%d.%d\n", GLP_MAJOR_VERSION, GLP_MINOR_VERSION);
@@ -503,6 +529,202 @@ void glp_init_smcp(glp_smcp *parm)
       parm->out_frq = 500;
       parm->out_dly = 0;
       parm->presolve = GLP_OFF;
+      parm->stop_fn = NULL;
+      parm->stop_info = NULL;
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_create_session - create simplex re-optimization session
+*
+*  SYNOPSIS
+*
+*  glp_session *glp_create_session(glp_prob *P);
+*
+*  DESCRIPTION
+*
+*  The routine glp_create_session creates a session intended to solve
+*  a sequence of closely related LP problems, which differ from each
+*  other only in the objective coefficients and bounds of rows and
+*  columns, as it happens on re-optimizing the same model after small
+*  changes in its data.
+*
+*  The session keeps the working LP, the row-wise constraint matrix and
+*  the basis header between successive calls to glp_session_simplex, so
+*  if the constraint matrix has not been changed, they are refreshed in
+*  O(m+n) time instead of being built from scratch.
+*
+*  The session should be deleted with glp_delete_session before the
+*  problem object is deleted.
+*
+*  RETURNS
+*
+*  The routine returns a pointer to the session created. */
+
+struct glp_session
+{     /* simplex re-optimization session */
+      glp_prob *P;
+      /* problem object the session is attached to */
+      SPXWS ws;
+      /* persistent simplex workspace */
+      int solves;
+      /* number of re-optimizations performed */
+      int meth;
+      /* simplex method used on the most recent re-optimization */
+};
+
+glp_session *glp_create_session(glp_prob *P)
+{     glp_session *S;
+      if (P == NULL || P->magic != GLP_PROB_MAGIC)
+         xerror("glp_create_session: P = %p; invalid problem object\n",
+            P);
+      S = talloc(1, glp_session);
+      S->P = P;
+      spx_init_ws(&S->ws);
+      S->solves = 0;
+      S->meth = 0;
+      return S;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_session_simplex - re-optimize LP problem within simplex session
+*
+*  SYNOPSIS
+*
+*  int glp_session_simplex(glp_session *S, const glp_smcp *parm);
+*
+*  DESCRIPTION
+*
+*  The routine glp_session_simplex solves the LP problem the session is
+*  attached to starting from its current basis, which is usually the
+*  optimal basis found on the previous call.
+*
+*  The routine itself chooses the simplex method to be used: if the
+*  current basis remains primal feasible (only objective coefficients
+*  have been changed), the primal simplex is used; if it remains dual
+*  feasible (only bounds have been changed), the dual simplex is used;
+*  otherwise the method specified by the control parameter meth is
+*  used. If the dual simplex fails, the routine switches to the primal
+*  simplex as glp_simplex does with meth = GLP_DUALP.
+*
+*  The control parameter presolve is ignored, since the session works
+*  with the original LP problem.
+*
+*  RETURNS
+*
+*  The routine returns the same codes as the routine glp_simplex. */
+
+int glp_session_simplex(glp_session *S, const glp_smcp *parm)
+{     glp_prob *P;
+      glp_smcp _parm, dparm;
+      int meth, ret;
+      if (S == NULL || S->P->magic != GLP_PROB_MAGIC)
+         xerror("glp_session_simplex: S = %p; invalid session\n", S);
+      P = S->P;
+      if (P->tree != NULL && P->tree->reason != 0)
+         xerror("glp_session_simplex: operation not allowed\n");
+      /* no method is used if the problem is found invalid */
+      meth = 0;
+      /* check control parameters */
+      if (parm == NULL)
+         parm = &_parm, glp_init_smcp((glp_smcp *)parm);
+      check_parm("glp_session_simplex", parm);
+      /* basic solution is currently undefined */
+      P->pbs_stat = P->dbs_stat = GLP_UNDEF;
+      P->obj_val = 0.0;
+      P->some = 0;
+      /* check bounds of double-bounded variables */
+      ret = check_bnds("glp_session_simplex", P, parm);
+      if (ret != 0)
+         goto done;
+      S->solves++;
+      meth = (parm->meth == GLP_PRIMAL ? GLP_PRIMAL : GLP_DUAL);
+      if (P->nnz == 0)
+      {  trivial_lp(P, parm), ret = 0;
+         goto done;
+      }
+      ret = factorize_lp("glp_session_simplex", P, parm);
+      if (ret != 0)
+         goto done;
+      /* refresh working LP and choose the method */
+      spx_load_ws(&S->ws, P);
+      ret = spx_ws_meth(&S->ws, parm->tol_bnd, parm->tol_dj);
+      if (ret != 0)
+         meth = ret;
+      if (meth == GLP_PRIMAL)
+         ret = spx_primal_ws(P, parm, &S->ws);
+      else
+      {  memcpy(&dparm, parm, sizeof(glp_smcp));
+         dparm.meth = GLP_DUALP;
+         ret = spy_dual_ws(P, &dparm, &S->ws);
+         if (ret == GLP_EFAIL)
+         {  /* restart with the primal simplex from the last basis
+             * stored in the problem object */
+            meth = GLP_PRIMAL;
+            ret = factorize_lp("glp_session_simplex", P, parm);
+            if (ret != 0)
+               goto done;
+            spx_load_ws(&S->ws, P);
+            ret = spx_primal_ws(P, parm, &S->ws);
+         }
+      }
+done: S->meth = meth;
+      return ret;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_session_info - retrieve simplex session statistics
+*
+*  SYNOPSIS
+*
+*  void glp_session_info(glp_session *S, int *solves, int *rebuilds,
+*     int *meth);
+*
+*  DESCRIPTION
+*
+*  The routine glp_session_info stores the number of re-optimizations
+*  performed within the session, the number of times the working LP had
+*  to be built from scratch (because the constraint matrix was changed),
+*  and the simplex method (GLP_PRIMAL or GLP_DUAL) used on the most
+*  recent re-optimization to locations, which the parameters solves,
+*  rebuilds, and meth point to, respectively. Any of the parameters can
+*  be specified as NULL. */
+
+void glp_session_info(glp_session *S, int *solves, int *rebuilds,
+      int *meth)
+{     if (solves != NULL)
+         *solves = S->solves;
+      if (rebuilds != NULL)
+         *rebuilds = S->ws.rebuilds;
+      if (meth != NULL)
+         *meth = S->meth;
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_delete_session - delete simplex re-optimization session
+*
+*  SYNOPSIS
+*
+*  void glp_delete_session(glp_session *S);
+*
+*  DESCRIPTION
+*
+*  The routine glp_delete_session deletes the specified session and
+*  frees all the memory allocated to it. The problem object the session
+*  is attached to is not affected. */
+
+void glp_delete_session(glp_session *S)
+{     spx_free_ws(&S->ws);
+      tfree(S);
       return;
 }
 
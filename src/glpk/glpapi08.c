@@ -25,6 +25,7 @@
 #include "glpenv.h"
 #include "glpipm.h"
 #include "glpnpp.h"
+#include "triang.h"
 
 /***********************************************************************
 *  NAME
@@ -51,6 +52,12 @@
 *  the transformed problem, and then transforms an obtained solution to
 *  the solution of the original problem.
 *
+*  If the control parameter crossover is set to GLP_ON and an optimal
+*  interior-point solution has been found, the routine also recovers an
+*  optimal basic solution (see the routine crossover below), which can
+*  then be used to warm start the simplex method or to perform the
+*  sensitivity analysis.
+*
 *  RETURNS
 *
 *  0  The LP problem instance has been successfully solved. This code
@@ -67,7 +74,15 @@
 *     Iteration limit exceeded.
 *
 *  GLP_EINSTAB
-*     Numerical instability on solving Newtonian system. */
+*     Numerical instability on solving Newtonian system.
+*
+*  GLP_ESTOP
+*     Termination requested by the callback routine stop_fn.
+*
+*  The code reported by the simplex solver on cleaning up the basis
+*  recovered by the crossover is not returned by the routine, so the
+*  interior-point solution remains valid even if the cleanup fails; it
+*  can be retrieved with the routine glp_ipt_xret. */
 
 static void transform(NPP *npp)
 {     /* transform LP to the standard formulation */
@@ -117,6 +132,259 @@ static void transform(NPP *npp)
       return;
 }
 
+/***********************************************************************
+*  crossover - recover optimal basic solution from interior point
+*
+*  This routine is called on the original LP after an optimal interior-
+*  point solution has been stored to it. It constructs a basis in two
+*  phases.
+*
+*  On the push phase every variable is classified using complementarity
+*  of its primal and dual values: variables, which are strictly between
+*  their bounds, are candidates to be basic, and other variables are
+*  made non-basic on their nearest bounds. Columns of the candidates are
+*  included in the basis as far as together with active rows they form
+*  a triangular (and therefore non-singular) basis matrix; auxiliary
+*  variables of all other rows complete the basis.
+*
+*  On the cleanup phase the simplex method is started from this basis.
+*  Since the basis is close to an optimal vertex, only a few iterations
+*  are usually needed to make it primal and dual feasible. The method
+*  is chosen by the basis: the dual simplex is used if the basis is
+*  dual feasible, the primal simplex if it is primal feasible, and
+*  otherwise the method, for which fewer variables are infeasible. */
+
+#define CROSS_TOL 0.001
+/* relative tolerance used to include inner columns in the triangular
+   part of the basis; smaller pivots would make the basis matrix ill-
+   conditioned */
+
+struct xcsa
+{     /* common storage area used by the crossover */
+      glp_prob *P;
+      /* original LP */
+      char *tight; /* char tight[1+m]; */
+      /* tight[i] means that i-th row is active, i.e. its auxiliary
+         variable should be non-basic */
+      char *inner; /* char inner[1+n]; */
+      /* inner[j] means that j-th column is strictly between its bounds,
+         i.e. it should be basic */
+};
+
+static int is_inner(int type, double lb, double ub, double x, double d)
+{     /* check if a variable with primal value x and dual value d is
+         strictly between its bounds */
+      double dist, temp;
+      switch (type)
+      {  case GLP_FR:
+            return 1;
+         case GLP_LO:
+            dist = (x - lb) / (1.0 + fabs(lb));
+            break;
+         case GLP_UP:
+            dist = (ub - x) / (1.0 + fabs(ub));
+            break;
+         case GLP_DB:
+            dist = (x - lb) / (1.0 + fabs(lb));
+            temp = (ub - x) / (1.0 + fabs(ub));
+            if (dist > temp) dist = temp;
+            break;
+         case GLP_FX:
+            return 0;
+         default:
+            xassert(type != type);
+            /* no return */
+            return 0;
+      }
+      /* in an optimal interior point either the primal value is off
+         its bound or the dual value is non-zero */
+      return dist > fabs(d);
+}
+
+static int bound_stat(int type, double lb, double ub, double x)
+{     /* determine status of a non-basic variable with value x */
+      switch (type)
+      {  case GLP_FR:
+            return GLP_NF;
+         case GLP_LO:
+            return GLP_NL;
+         case GLP_UP:
+            return GLP_NU;
+         case GLP_DB:
+            return x - lb <= ub - x ? GLP_NL : GLP_NU;
+         case GLP_FX:
+            return GLP_NS;
+         default:
+            xassert(type != type);
+      }
+      /* no return */
+      return 0;
+}
+
+static int cross_mat(void *info, int k, int ind[], double val[])
+{     /* retrieve scaled row or column of the submatrix formed by active
+         rows and inner columns */
+      struct xcsa *csa = info;
+      glp_prob *P = csa->P;
+      GLPAIJ *aij;
+      int i, j, len;
+      len = 0;
+      if (k > 0)
+      {  i = +k;
+         xassert(1 <= i && i <= P->m);
+         if (csa->tight[i])
+         {  for (aij = P->row[i]->ptr; aij != NULL; aij = aij->r_next)
+            {  j = aij->col->j;
+               if (csa->inner[j])
+               {  len++;
+                  ind[len] = j;
+                  val[len] = aij->row->rii * aij->val * aij->col->sjj;
+               }
+            }
+         }
+      }
+      else
+      {  j = -k;
+         xassert(1 <= j && j <= P->n);
+         if (csa->inner[j])
+         {  for (aij = P->col[j]->ptr; aij != NULL; aij = aij->c_next)
+            {  i = aij->row->i;
+               if (csa->tight[i])
+               {  len++;
+                  ind[len] = i;
+                  val[len] = aij->row->rii * aij->val * aij->col->sjj;
+               }
+            }
+         }
+      }
+      return len;
+}
+
+static int cleanup_meth(glp_prob *P, const glp_smcp *smcp)
+{     /* choose simplex method to start from the pushed basis */
+      int k, type, stat, np, nd;
+      double lb, ub, prim, dual;
+      if (glp_warm_up(P) != 0)
+         return GLP_DUALP;
+      if (P->dbs_stat == GLP_FEAS)
+         return GLP_DUALP;
+      if (P->pbs_stat == GLP_FEAS)
+         return GLP_PRIMAL;
+      /* count primal infeasible basic variables and dual infeasible
+         non-basic variables */
+      np = nd = 0;
+      for (k = 1; k <= P->m+P->n; k++)
+      {  if (k <= P->m)
+         {  GLPROW *row = P->row[k];
+            type = row->type, stat = row->stat;
+            lb = row->lb, ub = row->ub;
+            prim = row->prim, dual = row->dual;
+         }
+         else
+         {  GLPCOL *col = P->col[k-P->m];
+            type = col->type, stat = col->stat;
+            lb = col->lb, ub = col->ub;
+            prim = col->prim, dual = col->dual;
+         }
+         if (P->dir == GLP_MAX)
+            dual = -dual;
+         if (stat == GLP_BS)
+         {  if ((type == GLP_LO || type == GLP_DB || type == GLP_FX) &&
+                prim < lb - smcp->tol_bnd * (1.0 + fabs(lb)))
+               np++;
+            else if ((type == GLP_UP || type == GLP_DB ||
+                type == GLP_FX) &&
+                prim > ub + smcp->tol_bnd * (1.0 + fabs(ub)))
+               np++;
+         }
+         else
+         {  if ((stat == GLP_NL || stat == GLP_NF) &&
+                dual < -smcp->tol_dj)
+               nd++;
+            else if ((stat == GLP_NU || stat == GLP_NF) &&
+                dual > +smcp->tol_dj)
+               nd++;
+         }
+      }
+      return np <= nd ? GLP_PRIMAL : GLP_DUALP;
+}
+
+static int crossover(glp_prob *P, const glp_iptcp *parm)
+{     struct xcsa _csa, *csa = &_csa;
+      GLPROW *row;
+      GLPCOL *col;
+      glp_smcp smcp;
+      int m = P->m;
+      int n = P->n;
+      int i, j, k, min_mn, size, nint, *rn, *cn;
+      char *flag;
+      /* push phase */
+      csa->P = P;
+      csa->tight = talloc(1+m, char);
+      csa->inner = talloc(1+n, char);
+      for (i = 1; i <= m; i++)
+      {  row = P->row[i];
+         csa->tight[i] = (char)!is_inner(row->type, row->lb, row->ub,
+            row->pval, row->dval);
+      }
+      nint = 0;
+      for (j = 1; j <= n; j++)
+      {  col = P->col[j];
+         csa->inner[j] = (char)is_inner(col->type, col->lb, col->ub,
+            col->pval, col->dval);
+         if (csa->inner[j]) nint++;
+      }
+      min_mn = (m < n ? m : n);
+      rn = talloc(1+min_mn, int);
+      cn = talloc(1+min_mn, int);
+      flag = talloc(1+n, char);
+      memset(&flag[1], 0, n * sizeof(char));
+      size = triang(m, n, cross_mat, csa, CROSS_TOL, rn, cn);
+      xassert(0 <= size && size <= min_mn);
+      /* include in the basis inner columns, which constitute the
+         triangular part; their rows become non-basic */
+      memset(csa->tight+1, 0, m * sizeof(char));
+      for (k = 1; k <= size; k++)
+      {  i = rn[k];
+         xassert(1 <= i && i <= m);
+         csa->tight[i] = 1;
+         j = cn[k];
+         xassert(1 <= j && j <= n);
+         flag[j] = 1;
+      }
+      for (i = 1; i <= m; i++)
+      {  row = P->row[i];
+         if (csa->tight[i])
+            glp_set_row_stat(P, i, bound_stat(row->type, row->lb,
+               row->ub, row->pval));
+         else
+            glp_set_row_stat(P, i, GLP_BS);
+      }
+      for (j = 1; j <= n; j++)
+      {  col = P->col[j];
+         if (flag[j])
+            glp_set_col_stat(P, j, GLP_BS);
+         else
+            glp_set_col_stat(P, j, bound_stat(col->type, col->lb,
+               col->ub, col->pval));
+      }
+      if (parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Crossover: %d of %d column(s) off bounds, %d pushed i"
+            "nto basis\n", nint, n, size);
+      tfree(csa->tight);
+      tfree(csa->inner);
+      tfree(rn);
+      tfree(cn);
+      tfree(flag);
+      /* cleanup phase */
+      glp_init_smcp(&smcp);
+      smcp.msg_lev = parm->msg_lev;
+      smcp.meth = cleanup_meth(P, &smcp);
+      smcp.stop_fn = parm->stop_fn;
+      smcp.stop_info = parm->stop_info;
+      return glp_simplex(P, &smcp);
+}
+
 int glp_interior(glp_prob *P, const glp_iptcp *parm)
 {     glp_iptcp _parm;
       GLPROW *row;
@@ -139,9 +407,16 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
             parm->ord_alg == GLP_ORD_SYMAMD))
          xerror("glp_interior: ord_alg = %d; invalid parameter\n",
             parm->ord_alg);
+      if (!(parm->crossover == GLP_ON || parm->crossover == GLP_OFF))
+         xerror("glp_interior: crossover = %d; invalid parameter\n",
+            parm->crossover);
+      if (!(1 <= parm->num_thr && parm->num_thr <= 256))
+         xerror("glp_interior: num_thr = %d; invalid parameter\n",
+            parm->num_thr);
       /* interior-point solution is currently undefined */
       P->ipt_stat = GLP_UNDEF;
       P->ipt_obj = 0.0;
+      P->ipt_xret = -1;
       /* check bounds of double-bounded variables */
       for (i = 1; i <= P->m; i++)
       {  row = P->row[i];
@@ -216,6 +491,10 @@ int glp_interior(glp_prob *P, const glp_iptcp *parm)
 done: /* free working program objects */
       if (npp != NULL) npp_delete_wksp(npp);
       if (prob != NULL) glp_delete_prob(prob);
+      /* recover optimal basic solution, if required */
+      if (ret == 0 && parm->crossover == GLP_ON &&
+          P->ipt_stat == GLP_OPT)
+         P->ipt_xret = crossover(P, parm);
       /* return to the application program */
       return ret;
 }
@@ -240,6 +519,10 @@ done: /* free working program objects */
 void glp_init_iptcp(glp_iptcp *parm)
 {     parm->msg_lev = GLP_MSG_ALL;
       parm->ord_alg = GLP_ORD_AMD;
+      parm->crossover = GLP_OFF;
+      parm->num_thr = 1;
+      parm->stop_fn = NULL;
+      parm->stop_info = NULL;
       return;
 }
 
@@ -267,6 +550,28 @@ int glp_ipt_status(glp_prob *lp)
       return ipt_stat;
 }
 
+/***********************************************************************
+*  NAME
+*
+*  glp_ipt_xret - retrieve crossover return code
+*
+*  SYNOPSIS
+*
+*  int glp_ipt_xret(glp_prob *P);
+*
+*  RETURNS
+*
+*  The routine glp_ipt_xret returns the code reported by the simplex
+*  solver on cleaning up the basis recovered by the crossover, which has
+*  been performed by the last call to glp_interior (0 means an optimal
+*  basic solution has been recovered). If the crossover has not been
+*  performed (it was not requested, or no optimal interior-point
+*  solution was found), the routine returns -1. */
+
+int glp_ipt_xret(glp_prob *P)
+{     return P->ipt_xret;
+}
+
 /***********************************************************************
 *  NAME
 *
@@ -253,6 +253,12 @@ static void solve_mip_start(glp_prob *P, glp_mip_ctx *ctx,
       T->P = P0;
       T->npp = npp;
 #endif
+      /* resume the search from checkpoint, if required */
+      if (parm->resume != NULL && ios_ckpt_load(T, parm->resume) != 0)
+      {  ios_delete_tree(T);
+         ctx->ret = GLP_EDATA;
+         goto done;
+      }
       ctx->tree = T;
     
       /* solve the problem instance */
@@ -271,8 +277,14 @@ static void solve_mip_stop(glp_prob *P, glp_mip_ctx *ctx,
       int ret = ctx->ret;
       const glp_iocp *parm = ctx->parm;
       glp_tree *T = ctx->tree;
+      int ext;
+      double obj;
       if (!T) return;
 
+      /* check if only concurrent solvers have found integer feasible
+         solutions, in which case the search proves their optimality
+         rather than infeasibility of the problem */
+      ext = (P->mip_stat != GLP_FEAS && ios_incumb(T, &obj));
       /* delete the branch-and-bound tree */
       ios_delete_tree(T);
       ctx->tree = NULL;
@@ -283,6 +295,11 @@ static void solve_mip_stop(glp_prob *P, glp_mip_ctx *ctx,
                xprintf("INTEGER OPTIMAL SOLUTION FOUND\n");
             P->mip_stat = GLP_OPT;
          }
+         else if (ext)
+         {  if (parm->msg_lev >= GLP_MSG_ALL)
+               xprintf("INTEGER OPTIMAL SOLUTION FOUND BY CONCURRENT SOL"
+                  "VER\n");
+         }
          else
          {  if (parm->msg_lev >= GLP_MSG_ALL)
                xprintf("PROBLEM HAS NO INTEGER FEASIBLE SOLUTION\n");
@@ -329,6 +346,10 @@ static void preprocess_and_solve_mip_start(glp_prob *P, glp_mip_ctx *ctx)
          xprintf("Preprocessing...\n");
       /* create preprocessor workspace */
       ctx->presolve.npp = npp = npp_create_wksp();
+#if 1 /* 19/X-2026 */
+      /* global presolve passes may use search threads */
+      npp->threads = parm->threads;
+#endif
       /* load original problem into the preprocessor workspace */
       npp_load_prob(npp, P, GLP_OFF, GLP_MIP, GLP_OFF);
       /* process MIP prior to applying the branch-and-bound method */
@@ -526,7 +547,8 @@ void glp_intopt_start(glp_prob *P, glp_mip_ctx *ctx)
             parm->br_tech == GLP_BR_LFV ||
             parm->br_tech == GLP_BR_MFV ||
             parm->br_tech == GLP_BR_DTH ||
-            parm->br_tech == GLP_BR_PCH))
+            parm->br_tech == GLP_BR_PCH ||
+            parm->br_tech == GLP_BR_RLB))
          xerror("glp_intopt: br_tech = %d; invalid parameter\n",
             parm->br_tech);
       if (!(parm->bt_tech == GLP_BT_DFS ||
@@ -587,6 +609,57 @@ void glp_intopt_start(glp_prob *P, glp_mip_ctx *ctx)
          xerror("glp_intopt: alien = %d; invalid parameter\n",
             parm->alien);
 #endif
+      if (!(1 <= parm->threads && parm->threads <= 256))
+         xerror("glp_intopt: threads = %d; invalid parameter\n",
+            parm->threads);
+      if (!(parm->det_mode == GLP_ON || parm->det_mode == GLP_OFF))
+         xerror("glp_intopt: det_mode = %d; invalid parameter\n",
+            parm->det_mode);
+      if (!(parm->share_cuts == GLP_ON || parm->share_cuts == GLP_OFF))
+         xerror("glp_intopt: share_cuts = %d; invalid parameter\n",
+            parm->share_cuts);
+      if (parm->node_mem < 0)
+         xerror("glp_intopt: node_mem = %d; invalid parameter\n",
+            parm->node_mem);
+      if (parm->rel_lim < 0)
+         xerror("glp_intopt: rel_lim = %d; invalid parameter\n",
+            parm->rel_lim);
+      if (parm->sb_it_lim < 1)
+         xerror("glp_intopt: sb_it_lim = %d; invalid parameter\n",
+            parm->sb_it_lim);
+      if (parm->sb_look < 1)
+         xerror("glp_intopt: sb_look = %d; invalid parameter\n",
+            parm->sb_look);
+      if (parm->cut_pool < 0)
+         xerror("glp_intopt: cut_pool = %d; invalid parameter\n",
+            parm->cut_pool);
+      if (parm->sol_pool < 0)
+         xerror("glp_intopt: sol_pool = %d; invalid parameter\n",
+            parm->sol_pool);
+      if (parm->pool_gap < 0.0)
+         xerror("glp_intopt: pool_gap = %g; invalid parameter\n",
+            parm->pool_gap);
+      if (parm->pool_div < 1)
+         xerror("glp_intopt: pool_div = %d; invalid parameter\n",
+            parm->pool_div);
+      if (!(parm->rins_heur == GLP_ON || parm->rins_heur == GLP_OFF))
+         xerror("glp_intopt: rins_heur = %d; invalid parameter\n",
+            parm->rins_heur);
+      if (!(parm->lb_heur == GLP_ON || parm->lb_heur == GLP_OFF))
+         xerror("glp_intopt: lb_heur = %d; invalid parameter\n",
+            parm->lb_heur);
+      if (parm->sub_freq < 1)
+         xerror("glp_intopt: sub_freq = %d; invalid parameter\n",
+            parm->sub_freq);
+      if (parm->sub_nodes < 1)
+         xerror("glp_intopt: sub_nodes = %d; invalid parameter\n",
+            parm->sub_nodes);
+      if (parm->sub_tm_lim < 0)
+         xerror("glp_intopt: sub_tm_lim = %d; invalid parameter\n",
+            parm->sub_tm_lim);
+      if (parm->ckpt_int < 1)
+         xerror("glp_intopt: ckpt_int = %d; invalid parameter\n",
+            parm->ckpt_int);
 #if 0 /* 11/VII-2013 */
       /* integer solution is currently undefined */
       P->mip_stat = GLP_UNDEF;
@@ -601,6 +674,8 @@ void glp_intopt_start(glp_prob *P, glp_mip_ctx *ctx)
       else if (P->mip_stat == GLP_OPT)
          P->mip_stat = GLP_FEAS;
 #endif
+      /* solutions of the previous search are discarded */
+      ios_spool_free(P);
       /* check bounds of double-bounded variables */
       for (i = 1; i <= P->m; i++)
       {  GLPROW *row = P->row[i];
@@ -777,6 +852,29 @@ void glp_init_iocp(glp_iocp *parm)
       parm->save_sol = NULL;
       parm->alien = GLP_OFF;
 #endif
+      parm->threads = 1;
+      parm->det_mode = GLP_OFF;
+      parm->share_cuts = GLP_ON;
+      parm->node_mem = 0;
+      parm->rel_lim = 4;
+      parm->sb_it_lim = 50;
+      parm->sb_look = 8;
+      parm->cut_pool = 1000;
+      parm->inc_fn = NULL;
+      parm->inc_info = NULL;
+      parm->stop_fn = NULL;
+      parm->stop_info = NULL;
+      parm->sol_pool = 0;
+      parm->pool_gap = DBL_MAX;
+      parm->pool_div = 1;
+      parm->rins_heur = GLP_OFF;
+      parm->lb_heur = GLP_OFF;
+      parm->sub_freq = 100;
+      parm->sub_nodes = 500;
+      parm->sub_tm_lim = 5000; /* 5 seconds */
+      parm->ckpt_file = NULL;
+      parm->ckpt_int = 60000; /* 1 minute */
+      parm->resume = NULL;
       return;
 }
 
@@ -879,4 +977,71 @@ double glp_mip_col_val(glp_prob *mip, int j)
       return mipx;
 }
 
+/***********************************************************************
+*  NAME
+*
+*  glp_mip_pool_size - retrieve number of solutions in solution pool
+*
+*  SYNOPSIS
+*
+*  int glp_mip_pool_size(glp_prob *mip);
+*
+*  RETURNS
+*
+*  The routine glp_mip_pool_size returns the number of integer feasible
+*  solutions collected in the solution pool by the last call to the
+*  routine glp_intopt (see glp_iocp.sol_pool). The pool is emptied when
+*  columns are added to or deleted from the problem object. */
+
+int glp_mip_pool_size(glp_prob *mip)
+{     return mip->sp_cnt;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_mip_pool_obj - retrieve objective value of pooled solution
+*
+*  SYNOPSIS
+*
+*  double glp_mip_pool_obj(glp_prob *mip, int k);
+*
+*  RETURNS
+*
+*  The routine glp_mip_pool_obj returns value of the objective function
+*  for k-th solution in the solution pool. Solutions are ordered by
+*  their objective values, so the first one is the best. */
+
+double glp_mip_pool_obj(glp_prob *mip, int k)
+{     if (!(1 <= k && k <= mip->sp_cnt))
+         xerror("glp_mip_pool_obj: k = %d; solution number out of range"
+            "\n", k);
+      return mip->sp_obj[k];
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_mip_pool_sol - retrieve column values of pooled solution
+*
+*  SYNOPSIS
+*
+*  void glp_mip_pool_sol(glp_prob *mip, int k, double x[]);
+*
+*  DESCRIPTION
+*
+*  The routine glp_mip_pool_sol stores values of all structural
+*  variables for k-th solution in the solution pool to locations x[1],
+*  ..., x[n], where n is the number of columns in the problem object. */
+
+void glp_mip_pool_sol(glp_prob *mip, int k, double x[])
+{     if (!(1 <= k && k <= mip->sp_cnt))
+         xerror("glp_mip_pool_sol: k = %d; solution number out of range"
+            "\n", k);
+      xassert(mip->sp_n == mip->n);
+      memcpy(&x[1], &mip->sp_x[(k-1) * mip->sp_n + 1],
+         mip->sp_n * sizeof(double));
+      return;
+}
+
 /* eof */
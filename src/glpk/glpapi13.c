@@ -462,6 +462,29 @@ int glp_ios_pool_size(glp_tree *tree)
 
 /**********************************************************************/
 
+void glp_ios_gpool_stat(glp_tree *tree, glp_gpstat *stat)
+{     /* retrieve global cut pool statistics */
+      IOSGPOOL *gpool = tree->gpool;
+      memset(stat, 0, sizeof(glp_gpstat));
+      if (gpool != NULL)
+      {  stat->size = gpool->size;
+         stat->added = gpool->added;
+         stat->dupl = gpool->dupl;
+         stat->reused = gpool->reused;
+         stat->removed = gpool->removed;
+      }
+      return;
+}
+
+/**********************************************************************/
+
+int glp_ios_spill_cnt(glp_tree *tree)
+{     /* determine number of subproblems moved to temporary file */
+      return tree->spill_cnt;
+}
+
+/**********************************************************************/
+
 int glp_ios_add_row(glp_tree *tree,
       const char *name, int klass, int flags, int len, const int ind[],
       const double val[], int type, double rhs)
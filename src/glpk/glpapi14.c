@@ -25,6 +25,9 @@
 #include "draft.h"
 #include "glpmpl.h"
 #include "prob.h"
+#if 1 /* 19/X-2026 */
+#define NNZ_MAX 500000000 /* = 500*10^6 */
+#endif
 
 glp_tran *glp_mpl_alloc_wksp(void)
 {     /* allocate the MathProg translator workspace */
@@ -38,6 +41,9 @@ void _glp_mpl_init_rand(glp_tran *tran, int seed)
 {     if (tran->phase != 0)
          xerror("glp_mpl_init_rand: invalid call sequence\n");
       rng_init_rand(tran->rand, seed);
+#if 1 /* 19/X-2026 */
+      tran->seed = seed;
+#endif
       return;
 }
 #endif
@@ -72,6 +78,62 @@ int glp_mpl_read_data(glp_tran *tran, const char *fname)
       return ret;
 }
 
+#if 1 /* 19/X-2026 */
+int glp_mpl_put_set_data(glp_tran *tran, const char *name, int dim,
+      const double snum[], const char *sstr[], int dimen, int n,
+      const double num[], const char *str[])
+{     /* assign set data directly */
+      int ret;
+      if (!(tran->phase == 1 || tran->phase == 2))
+         xerror("glp_mpl_put_set_data: invalid call sequence\n");
+      ret = mpl_put_set_data(tran, (char *)name, dim, snum,
+         (char **)sstr, dimen, n, num, (char **)str);
+      if (ret == 2)
+         ret = 0;
+      else if (ret == 4)
+         ret = 1;
+      else
+         xassert(ret != ret);
+      return ret;
+}
+
+int glp_mpl_put_par_data(glp_tran *tran, const char *name, int dim,
+      int n, const double snum[], const char *sstr[],
+      const double num[], const char *str[])
+{     /* assign parameter data directly */
+      int ret;
+      if (!(tran->phase == 1 || tran->phase == 2))
+         xerror("glp_mpl_put_par_data: invalid call sequence\n");
+      ret = mpl_put_par_data(tran, (char *)name, dim, n, snum,
+         (char **)sstr, num, (char **)str);
+      if (ret == 2)
+         ret = 0;
+      else if (ret == 4)
+         ret = 1;
+      else
+         xassert(ret != ret);
+      return ret;
+}
+#endif
+
+#if 1 /* 19/X-2026 */
+void glp_mpl_set_threads(glp_tran *tran, int threads)
+{     /* set number of threads used to generate the model */
+      if (!(tran->phase == 0 || tran->phase == 1 || tran->phase == 2))
+         xerror("glp_mpl_set_threads: invalid call sequence\n");
+      if (threads < 1)
+         xerror("glp_mpl_set_threads: threads = %d; invalid number of "
+            "threads\n", threads);
+      tran->threads = threads;
+      return;
+}
+
+int glp_mpl_get_par_cnt(glp_tran *tran)
+{     /* determine number of constraints generated by worker threads */
+      return tran->par_cnt;
+}
+#endif
+
 int glp_mpl_generate(glp_tran *tran, const char *fname)
 {     /* generate the model */
       int ret;
@@ -85,6 +147,253 @@ int glp_mpl_generate(glp_tran *tran, const char *fname)
       return ret;
 }
 
+#if 1 /* 19/X-2026 */
+static void set_row_bnds(glp_tran *tran, glp_prob *prob, int i)
+{     /* set bounds of i-th row as specified in the model */
+      int type;
+      double lb, ub;
+      type = mpl_get_row_bnds(tran, i, &lb, &ub);
+      switch (type)
+      {  case MPL_FR: type = GLP_FR; break;
+         case MPL_LO: type = GLP_LO; break;
+         case MPL_UP: type = GLP_UP; break;
+         case MPL_DB: type = GLP_DB; break;
+         case MPL_FX: type = GLP_FX; break;
+         default: xassert(type != type);
+      }
+      if (type == GLP_DB && fabs(lb - ub) < 1e-9 * (1.0 + fabs(lb)))
+      {  type = GLP_FX;
+         if (fabs(lb) <= fabs(ub)) ub = lb; else lb = ub;
+      }
+      glp_set_row_bnds(prob, i, type, lb, ub);
+      /* warn about non-zero constant term */
+      if (mpl_get_row_c0(tran, i) != 0.0)
+         xprintf("glp_mpl_build_prob: row %s; constant term %.12g ignor"
+            "ed\n",
+            mpl_get_row_name(tran, i), mpl_get_row_c0(tran, i));
+      return;
+}
+
+static void set_col_bnds(glp_tran *tran, glp_prob *prob, int j)
+{     /* set bounds of j-th column as specified in the model */
+      int type;
+      double lb, ub;
+      type = mpl_get_col_bnds(tran, j, &lb, &ub);
+      switch (type)
+      {  case MPL_FR: type = GLP_FR; break;
+         case MPL_LO: type = GLP_LO; break;
+         case MPL_UP: type = GLP_UP; break;
+         case MPL_DB: type = GLP_DB; break;
+         case MPL_FX: type = GLP_FX; break;
+         default: xassert(type != type);
+      }
+      if (mpl_get_col_kind(tran, j) == MPL_BIN)
+      {  if (type == GLP_FR || type == GLP_UP || lb < 0.0) lb = 0.0;
+         if (type == GLP_FR || type == GLP_LO || ub > 1.0) ub = 1.0;
+         type = GLP_DB;
+      }
+      if (type == GLP_DB && fabs(lb - ub) < 1e-9 * (1.0 + fabs(lb)))
+      {  type = GLP_FX;
+         if (fabs(lb) <= fabs(ub)) ub = lb; else lb = ub;
+      }
+      glp_set_col_bnds(prob, j, type, lb, ub);
+      return;
+}
+
+void glp_mpl_build_prob(glp_tran *tran, glp_prob *prob)
+{     /* build LP/MIP problem instance from the model */
+      if (tran->phase != 3)
+         xerror("glp_mpl_build_prob: invalid call sequence\n");
+      glp_mpl_build_prob1(tran, prob, GLP_ON);
+      return;
+}
+
+void glp_mpl_build_prob1(glp_tran *tran, glp_prob *prob, int names)
+{     /* build LP/MIP problem instance in one pass */
+      GLPROW *row;
+      GLPCOL *col;
+      GLPAIJ *aij;
+      FORMULA *term;
+      int m, n, i, j, kind;
+      if (tran->phase != 3)
+         xerror("glp_mpl_build_prob1: invalid call sequence\n");
+      if (!(names == GLP_ON || names == GLP_OFF))
+         xerror("glp_mpl_build_prob1: names = %d; invalid parameter\n",
+            names);
+      /* erase the problem object */
+      glp_erase_prob(prob);
+      /* set problem name */
+      if (names)
+         glp_set_prob_name(prob, mpl_get_prob_name(tran));
+      /* build rows (constraints) */
+      m = mpl_get_num_rows(tran);
+      if (m > 0)
+         glp_add_rows(prob, m);
+      for (i = 1; i <= m; i++)
+      {  /* set row name */
+         if (names)
+            glp_set_row_name(prob, i, mpl_get_row_name(tran, i));
+         /* set row bounds */
+         set_row_bnds(tran, prob, i);
+      }
+      /* build columns (variables) */
+      n = mpl_get_num_cols(tran);
+      if (n > 0)
+         glp_add_cols(prob, n);
+      for (j = 1; j <= n; j++)
+      {  /* set column name */
+         if (names)
+            glp_set_col_name(prob, j, mpl_get_col_name(tran, j));
+         /* set column kind */
+         kind = mpl_get_col_kind(tran, j);
+         switch (kind)
+         {  case MPL_NUM:
+               break;
+            case MPL_INT:
+            case MPL_BIN:
+               glp_set_col_kind(prob, j, GLP_IV);
+               break;
+            default:
+               xassert(kind != kind);
+         }
+         /* set column bounds */
+         set_col_bnds(tran, prob, j);
+      }
+      /* load the constraint matrix directly from the linear forms of
+         the elemental constraints; elements are added to the row and
+         column lists in the same order as glp_set_mat_row would add
+         them row by row, and zero coefficients are not stored */
+      for (i = 1; i <= m; i++)
+      {  row = prob->row[i];
+         for (term = tran->row[i]->form; term != NULL;
+            term = term->next)
+         {  xassert(term->var != NULL);
+            if (term->coef == 0.0) continue;
+            col = prob->col[term->var->j];
+            /* linear forms of elemental constraints are reduced, so
+               each column appears in a row at most once */
+            xassert(!(col->ptr != NULL && col->ptr->row == row));
+            if (prob->nnz == NNZ_MAX)
+               xerror("glp_mpl_build_prob1: i = %d; too many constraint"
+                  " coefficients\n", i);
+            aij = dmp_get_atom(prob->pool, sizeof(GLPAIJ)), prob->nnz++;
+            aij->row = row;
+            aij->col = col;
+            aij->val = term->coef;
+            aij->r_prev = NULL;
+            aij->r_next = row->ptr;
+            aij->c_prev = NULL;
+            aij->c_next = col->ptr;
+            if (aij->r_next != NULL) aij->r_next->r_prev = aij;
+            if (aij->c_next != NULL) aij->c_next->c_prev = aij;
+            row->ptr = col->ptr = aij;
+         }
+      }
+      prob->rev++;
+      /* build objective function (the first objective is used) */
+      for (i = 1; i <= m; i++)
+      {  kind = mpl_get_row_kind(tran, i);
+         if (kind == MPL_MIN || kind == MPL_MAX)
+         {  /* set objective name */
+            if (names)
+               glp_set_obj_name(prob, mpl_get_row_name(tran, i));
+            /* set optimization direction */
+            glp_set_obj_dir(prob, kind == MPL_MIN ? GLP_MIN : GLP_MAX);
+            /* set constant term */
+            glp_set_obj_coef(prob, 0, mpl_get_row_c0(tran, i));
+            /* set objective coefficients */
+            for (term = tran->row[i]->form; term != NULL;
+               term = term->next)
+               prob->col[term->var->j]->coef = term->coef;
+            break;
+         }
+      }
+      return;
+}
+
+int glp_mpl_update_par_data(glp_tran *tran, const char *name, int dim,
+      int n, const double snum[], const char *sstr[],
+      const double num[], const char *str[])
+{     /* change parameter data of generated model */
+      int ret;
+      if (!(tran->phase == 3 && !tran->flag_p))
+         xerror("glp_mpl_update_par_data: invalid call sequence\n");
+      ret = mpl_update_par_data(tran, (char *)name, dim, n, snum,
+         (char **)sstr, num, (char **)str);
+      if (ret == 3)
+         ret = 0;
+      else if (ret == 4)
+         ret = 1;
+      else
+         xassert(ret != ret);
+      return ret;
+}
+
+int glp_mpl_update(glp_tran *tran)
+{     /* regenerate model objects depending on changed data */
+      int ret;
+      if (!(tran->phase == 3 && !tran->flag_p))
+         xerror("glp_mpl_update: invalid call sequence\n");
+      ret = mpl_update(tran);
+      if (ret == 3)
+         ret = 0;
+      else if (ret == 4)
+         ret = 1;
+      else
+         xassert(ret != ret);
+      return ret;
+}
+
+int glp_mpl_update_prob(glp_tran *tran, glp_prob *prob)
+{     /* apply changes of updated model to problem instance */
+      FORMULA *term;
+      int m, n, i, j, len, obj, cnt, kind, *ind;
+      double *val;
+      if (tran->phase != 3)
+         xerror("glp_mpl_update_prob: invalid call sequence\n");
+      m = mpl_get_num_rows(tran);
+      n = mpl_get_num_cols(tran);
+      if (!(prob->m == m && prob->n == n))
+         xerror("glp_mpl_update_prob: problem object has %d rows and %d"
+            " columns rather than %d and %d\n", prob->m, prob->n, m, n);
+      cnt = 0;
+      if (tran->upd_row == NULL)
+         goto done;
+      /* find the row of the objective function */
+      for (obj = 1; obj <= m; obj++)
+      {  kind = mpl_get_row_kind(tran, obj);
+         if (kind == MPL_MIN || kind == MPL_MAX) break;
+      }
+      /* change rows; the basis statuses are kept, so the basis may be
+         used as initial one for re-optimization */
+      ind = xcalloc(1+n, sizeof(int));
+      val = xcalloc(1+n, sizeof(double));
+      for (i = 1; i <= m; i++)
+      {  if (!tran->upd_row[i]) continue;
+         set_row_bnds(tran, prob, i);
+         len = mpl_get_mat_row(tran, i, ind, val);
+         glp_set_mat_row(prob, i, len, ind, val);
+         if (i == obj)
+         {  glp_set_obj_coef(prob, 0, mpl_get_row_c0(tran, i));
+            for (j = 1; j <= n; j++)
+               prob->col[j]->coef = 0.0;
+            for (term = tran->row[i]->form; term != NULL;
+               term = term->next)
+               prob->col[term->var->j]->coef = term->coef;
+         }
+         tran->upd_row[i] = 0, cnt++;
+      }
+      xfree(ind);
+      xfree(val);
+      /* change column bounds */
+      for (j = 1; j <= n; j++)
+      {  if (!tran->upd_col[j]) continue;
+         set_col_bnds(tran, prob, j);
+         tran->upd_col[j] = 0, cnt++;
+      }
+done: return cnt;
+}
+#else
 void glp_mpl_build_prob(glp_tran *tran, glp_prob *prob)
 {     /* build LP/MIP problem instance from the model */
       int m, n, i, j, t, kind, type, len, *ind;
@@ -193,6 +502,8 @@ void glp_mpl_build_prob(glp_tran *tran, glp_prob *prob)
       return;
 }
 
+#endif
+
 int glp_mpl_postsolve(glp_tran *tran, glp_prob *prob, int sol)
 {     /* postsolve the model */
       int i, j, m, n, stat, ret;
@@ -263,6 +574,46 @@ int glp_mpl_postsolve(glp_tran *tran, glp_prob *prob, int sol)
 done: return ret;
 }
 
+#if 1 /* 19/X-2026 */
+int glp_mpl_reset(glp_tran *tran)
+{     /* discard data and generated content, keep translated model */
+      int ret;
+      if (!(tran->phase == 1 || tran->phase == 2 || tran->phase == 3))
+         xerror("glp_mpl_reset: invalid call sequence\n");
+      ret = mpl_reset(tran);
+      if (ret == 1)
+         ret = 0;
+      else if (ret == 4)
+         ret = 1;
+      else
+         xassert(ret != ret);
+      return ret;
+}
+
+const char *glp_mpl_pool_stats(glp_tran *tran, int k, size_t *count,
+      size_t *total)
+{     /* retrieve statistics of translator memory pool */
+      return mpl_get_pool_stats(tran, k, count, total);
+}
+
+void glp_mpl_out_hook(glp_tran *tran, void (*func)(void *info,
+      const char *s), void *info)
+{     /* install hook to intercept display and printf output */
+      tran->out_hook = func;
+      tran->out_info = (func == NULL ? NULL : info);
+      return;
+}
+
+void glp_mpl_tab_hook(glp_tran *tran, int (*func)(void *info,
+      const char *table, int nf, const char *name[], int nr,
+      const double *num[], const char **str[]), void *info)
+{     /* install hook to receive records of output tables */
+      tran->tab_hook = func;
+      tran->tab_info = (func == NULL ? NULL : info);
+      return;
+}
+#endif
+
 void glp_mpl_free_wksp(glp_tran *tran)
 {     /* free the MathProg translator workspace */
       mpl_terminate(tran);
@@ -0,0 +1,307 @@
+/* glpapi22.c (LP/MIP preprocessor API) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "glpenv.h"
+#include "glpnpp.h"
+
+/***********************************************************************
+*  The preprocessor workspace glp_prep is an NPP object, in which the
+*  recording of objective transformations is always enabled. Thus, the
+*  resultant problem may be built once, while its objective is updated
+*  with glp_npp_update_obj every time the objective of the original
+*  problem is changed. */
+
+#define prep2npp(prep) ((NPP *)(prep))
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_alloc_wksp - allocate the preprocessor workspace
+*
+*  SYNOPSIS
+*
+*  glp_prep *glp_npp_alloc_wksp(void);
+*
+*  RETURNS
+*
+*  The routine glp_npp_alloc_wksp returns a pointer to the workspace
+*  allocated. */
+
+glp_prep *glp_npp_alloc_wksp(void)
+{     NPP *npp;
+      npp = npp_create_wksp();
+      npp->o_rec = 1;
+      return (glp_prep *)npp;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_load_prob - load original problem instance
+*
+*  SYNOPSIS
+*
+*  void glp_npp_load_prob(glp_prep *prep, glp_prob *P, int sol,
+*     int names);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_load_prob loads the original problem instance P
+*  into the preprocessor workspace. The parameter sol specifies which
+*  solution will be recovered later (GLP_SOL, GLP_IPT or GLP_MIP), and
+*  the parameter names specifies whether symbolic names of the problem,
+*  rows and columns should be copied (GLP_ON) or not (GLP_OFF). */
+
+void glp_npp_load_prob(glp_prep *prep, glp_prob *P, int sol,
+      int names)
+{     NPP *npp = prep2npp(prep);
+      if (npp->sol != 0)
+         xerror("glp_npp_load_prob: invalid call sequence (original ins"
+            "tance already loaded)\n");
+      if (!(sol == GLP_SOL || sol == GLP_IPT || sol == GLP_MIP))
+         xerror("glp_npp_load_prob: sol = %d; invalid parameter\n",
+            sol);
+      if (!(names == GLP_ON || names == GLP_OFF))
+         xerror("glp_npp_load_prob: names = %d; invalid parameter\n",
+            names);
+      npp_load_prob(npp, P, names, sol, GLP_OFF);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_preprocess1 - perform preprocessing
+*
+*  SYNOPSIS
+*
+*  int glp_npp_preprocess1(glp_prep *prep, int hard);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_preprocess1 performs basic LP preprocessing (if
+*  the solution to be recovered is basic or interior-point) or the same
+*  MIP preprocessing as glp_intopt does (if the solution to be recovered
+*  is integer). The flag hard allows using more expensive techniques to
+*  improve bounds of rows; it is ignored for MIP.
+*
+*  RETURNS
+*
+*  0        preprocessing has been successfully completed;
+*
+*  GLP_ENOPFS the problem has no primal feasible solution;
+*
+*  GLP_ENODFS the problem has no dual feasible solution. */
+
+int glp_npp_preprocess1(glp_prep *prep, int hard)
+{     NPP *npp = prep2npp(prep);
+      glp_iocp parm;
+      if (npp->sol == 0)
+         xerror("glp_npp_preprocess1: invalid call sequence (original "
+            "instance not loaded yet)\n");
+      if (npp->pool == NULL)
+         xerror("glp_npp_preprocess1: invalid call sequence (resultant "
+            "instance already built)\n");
+      if (!(hard == GLP_ON || hard == GLP_OFF))
+         xerror("glp_npp_preprocess1: hard = %d; invalid parameter\n",
+            hard);
+      if (npp->sol != GLP_MIP)
+         return npp_process_prob(npp, hard);
+      glp_init_iocp(&parm);
+      return npp_integer(npp, &parm);
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_build_prob - build resultant problem instance
+*
+*  SYNOPSIS
+*
+*  void glp_npp_build_prob(glp_prep *prep, glp_prob *Q);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_build_prob erases the problem object Q and then
+*  stores the resultant problem instance in it. */
+
+void glp_npp_build_prob(glp_prep *prep, glp_prob *Q)
+{     NPP *npp = prep2npp(prep);
+      if (npp->sol == 0)
+         xerror("glp_npp_build_prob: invalid call sequence (original i"
+            "nstance not loaded yet)\n");
+      if (npp->pool == NULL)
+         xerror("glp_npp_build_prob: invalid call sequence (resultant "
+            "instance already built)\n");
+      npp_build_prob(npp, Q);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_update_obj - update objective of resultant problem
+*
+*  SYNOPSIS
+*
+*  int glp_npp_update_obj(glp_prep *prep, glp_prob *P, glp_prob *Q);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_update_obj transforms the objective function of
+*  the original problem instance P in the same way as it was done on
+*  preprocessing and stores the result in the resultant instance Q.
+*  Only the objective coefficients of P may be changed since P was
+*  loaded into the workspace.
+*
+*  RETURNS
+*
+*  0        the objective of Q has been updated;
+*
+*  GLP_EDATA some reduction made on preprocessing depends on signs of
+*           objective coefficients and is not valid for the new
+*           objective, so the problem should be preprocessed again; in
+*           this case Q is not changed. */
+
+int glp_npp_update_obj(glp_prep *prep, glp_prob *P, glp_prob *Q)
+{     NPP *npp = prep2npp(prep);
+      int j, ret;
+      double dir, *c;
+      if (npp->pool != NULL)
+         xerror("glp_npp_update_obj: invalid call sequence (resultant "
+            "instance not built yet)\n");
+      if (!(npp->orig_dir == P->dir && npp->orig_m == P->m &&
+            npp->orig_n == P->n && npp->orig_nnz == P->nnz))
+         xerror("glp_npp_update_obj: original instance mismatch\n");
+      if (!(npp->m == Q->m && npp->n == Q->n && npp->nnz == Q->nnz))
+         xerror("glp_npp_update_obj: resultant instance mismatch\n");
+      c = xcalloc(1+npp->ncols, sizeof(double));
+      if (npp_obj_replay(npp, P, c) != 0)
+      {  ret = GLP_EDATA;
+         goto done;
+      }
+      dir = (npp->orig_dir == GLP_MIN ? +1.0 : -1.0);
+      glp_set_obj_coef(Q, 0, dir * c[0]);
+      for (j = 1; j <= npp->n; j++)
+         glp_set_obj_coef(Q, j, dir * c[npp->col_ref[j]]);
+      ret = 0;
+done: xfree(c);
+      return ret;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_postprocess - postprocess solution to resultant problem
+*
+*  SYNOPSIS
+*
+*  void glp_npp_postprocess(glp_prep *prep, glp_prob *Q);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_postprocess recovers a solution to the original
+*  problem instance from the solution to the resultant instance Q. The
+*  transformation stack is kept, so the routine may be called as many
+*  times as necessary, e.g. after Q has been re-solved with another
+*  objective. */
+
+void glp_npp_postprocess(glp_prep *prep, glp_prob *Q)
+{     NPP *npp = prep2npp(prep);
+      if (npp->pool != NULL)
+         xerror("glp_npp_postprocess: invalid call sequence (resultant "
+            "instance not built yet)\n");
+      if (!(npp->orig_dir == Q->dir && npp->m == Q->m &&
+            npp->n == Q->n && npp->nnz == Q->nnz))
+         xerror("glp_npp_postprocess: resultant instance mismatch\n");
+      switch (npp->sol)
+      {  case GLP_SOL:
+            if (glp_get_status(Q) != GLP_OPT)
+               xerror("glp_npp_postprocess: unable to recover non-optim"
+                  "al basic solution\n");
+            break;
+         case GLP_IPT:
+            if (glp_ipt_status(Q) != GLP_OPT)
+               xerror("glp_npp_postprocess: unable to recover non-optim"
+                  "al interior-point solution\n");
+            break;
+         case GLP_MIP:
+            if (!(glp_mip_status(Q) == GLP_OPT ||
+                  glp_mip_status(Q) == GLP_FEAS))
+               xerror("glp_npp_postprocess: unable to recover integer f"
+                  "easible solution\n");
+            break;
+         default:
+            xassert(npp != npp);
+      }
+      npp_postprocess(npp, Q);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_obtain_sol - obtain solution to original problem
+*
+*  SYNOPSIS
+*
+*  void glp_npp_obtain_sol(glp_prep *prep, glp_prob *P);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_obtain_sol stores the solution recovered by
+*  glp_npp_postprocess in the original problem instance P. */
+
+void glp_npp_obtain_sol(glp_prep *prep, glp_prob *P)
+{     NPP *npp = prep2npp(prep);
+      if (npp->pool != NULL || npp->c_value == NULL)
+         xerror("glp_npp_obtain_sol: invalid call sequence (solution n"
+            "ot postprocessed yet)\n");
+      if (!(npp->orig_dir == P->dir && npp->orig_m == P->m &&
+            npp->orig_n == P->n && npp->orig_nnz == P->nnz))
+         xerror("glp_npp_obtain_sol: original instance mismatch\n");
+      npp_unload_sol(npp, P);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  glp_npp_free_wksp - free the preprocessor workspace
+*
+*  SYNOPSIS
+*
+*  void glp_npp_free_wksp(glp_prep *prep);
+*
+*  DESCRIPTION
+*
+*  The routine glp_npp_free_wksp frees all memory allocated to the
+*  preprocessor workspace. */
+
+void glp_npp_free_wksp(glp_prep *prep)
+{     npp_delete_wksp(prep2npp(prep));
+      return;
+}
+
+/* eof */
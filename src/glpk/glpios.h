@@ -28,13 +28,13 @@
 #include "prob.h"
 
 typedef struct IOSLOT IOSLOT;
+typedef struct IOSHEAP IOSHEAP;
 typedef struct IOSNPD IOSNPD;
-typedef struct IOSBND IOSBND;
-typedef struct IOSTAT IOSTAT;
-typedef struct IOSROW IOSROW;
 typedef struct IOSAIJ IOSAIJ;
 typedef struct IOSPOOL IOSPOOL;
 typedef struct IOSCUT IOSCUT;
+typedef struct IOSGPOOL IOSGPOOL;
+typedef struct IOSGCUT IOSGCUT;
 
 struct glp_tree
 {     /* branch-and-bound tree */
@@ -95,6 +95,38 @@ struct glp_tree
       /* total number of nodes including those which have been already
          removed from the tree; this count is increased by one whenever
          a new node is created and never decreased */
+      IOSHEAP *heap; /* IOSHEAP heap[3]; */
+      /* priority queues of active subproblems (see glpios12.c):
+         heap[IOS_BND] orders them by local bound and is always kept;
+         heap[IOS_FEAS] orders them by the sum of integer infeasibilities
+         of the parent and heap[IOS_PROJ] by the best projection value;
+         both are kept only for the best projection heuristic, and the
+         latter is built once an integer feasible solution exists */
+      double proj_deg;
+      /* degradation per unit of integer infeasibility heap[IOS_PROJ]
+         is ordered for */
+      /*--------------------------------------------------------------*/
+      /* packed strings of changes of subproblems (see glpios14.c) */
+      unsigned char *pk_buf; /* uchar pk_buf[pk_max]; */
+      /* working buffer used to build packed strings */
+      int pk_len, pk_max;
+      /* current and maximal length of the working buffer */
+      size_t chg_mem;
+      /* total size of packed strings kept in memory, in bytes */
+      size_t chg_lim;
+      /* limit on chg_mem, in bytes; 0 means no limit */
+      IOSNPD *lru_head;
+      /* pointer to subproblem whose packed string was used least
+         recently */
+      IOSNPD *lru_tail;
+      /* pointer to subproblem whose packed string was used most
+         recently */
+      void *spill; /* FILE *spill; */
+      /* temporary file to keep packed strings or NULL */
+      size_t spill_size;
+      /* total size of packed strings written to the file, in bytes */
+      int spill_cnt;
+      /* number of times packed strings were moved to the file */
       /*--------------------------------------------------------------*/
       /* problem components corresponding to the root subproblem */
       int root_m;
@@ -148,6 +180,8 @@ struct glp_tree
       /* built-in cut generators segment */
       IOSPOOL *local;
       /* local cut pool */
+      IOSGPOOL *gpool;
+      /* global cut pool (NULL if disabled) */
       void *mir_gen;
       /* pointer to working area used by the MIR cut generator */
       void *clq_gen;
@@ -197,6 +231,19 @@ struct glp_tree
       int stop;
       /* flag indicating that the callback routine requires premature
          termination of the search */
+      double ext_obj;
+      /* best objective value of integer feasible solutions found by
+         concurrent solvers, which is obtained through parm->inc_fn;
+         +DBL_MAX (minimization) or -DBL_MAX (maximization) means that
+         no such value is known */
+      int sub_skip;
+      /* number of subproblems to be skipped before the sub-MIP
+         heuristics are applied next time (see glpios18.c) */
+      double lb_obj;
+      /* incumbent value, for which local branching was applied last
+         time */
+      void *ckpt; /* IOSCKPT *ckpt; */
+      /* checkpoint data (see glpios19.c) or NULL */
       int next_p;
       /* reference number of active subproblem selected to continue
          the search; 0 means no subproblem has been selected */
@@ -227,6 +274,22 @@ struct IOSLOT
       /* index of another free slot (only if this slot is free) */
 };
 
+struct IOSHEAP
+{     /* addressable binary heap of active subproblems */
+      int size;
+      /* number of subproblems in the heap; 0 means the heap is empty
+         or (for heap[IOS_PROJ]) is not built */
+      int max;
+      /* length of the array node (enlarged automatically) */
+      IOSNPD **node; /* IOSNPD *node[1+max]; */
+      /* node[1] is the best subproblem; node[i] is not worse than
+         node[2*i] and node[2*i+1] */
+};
+
+#define IOS_BND   0  /* order by local bound */
+#define IOS_FEAS  1  /* order by parent's sum of infeasibilities */
+#define IOS_PROJ  2  /* order by best projection value */
+
 struct IOSNPD
 {     /* node subproblem descriptor */
       int p;
@@ -241,16 +304,21 @@ struct IOSNPD
       /* if count = 0, this subproblem is active; if count > 0, this
          subproblem is inactive, in which case count is the number of
          its child subproblems */
-      /* the following three linked lists are destroyed on reviving and
-         built anew on freezing the subproblem: */
-      IOSBND *b_ptr;
-      /* linked list of rows and columns of the parent subproblem whose
-         types and bounds were changed */
-      IOSTAT *s_ptr;
-      /* linked list of rows and columns of the parent subproblem whose
-         statuses were changed */
-      IOSROW *r_ptr;
-      /* linked list of rows (cuts) added to the parent subproblem */
+      unsigned char *chg; /* uchar chg[chg_len]; */
+      /* packed string of changes made to the parent subproblem: types,
+         bounds and statuses of its rows and columns and rows added (see
+         glpios14.c); the string is destroyed on reviving and built anew
+         on freezing the subproblem; NULL means that either there are no
+         changes or the string is moved to the temporary file */
+      int chg_len;
+      /* length of the packed string, in bytes */
+      long chg_pos;
+      /* offset of the copy of the packed string in the temporary file;
+         -1 means there is no copy */
+      IOSNPD *lru_prev;
+      /* pointer to subproblem whose packed string was used previously */
+      IOSNPD *lru_next;
+      /* pointer to subproblem whose packed string was used next */
       int solved;
       /* how many times LP relaxation of this subproblem was solved;
          for inactive subproblem this count is always non-zero;
@@ -296,64 +364,18 @@ struct IOSNPD
       /* pointer to the application-specific data */
       IOSNPD *temp;
       /* working pointer used by some routines */
+      int seq;
+      /* sequential number of the subproblem; it is used to break ties
+         in the heaps the same way as the active list order does */
+      int pos[3];
+      /* pos[k] is the index of this subproblem in the array of heap[k];
+         0 means the subproblem is not in the heap */
       IOSNPD *prev;
       /* pointer to previous subproblem in the active list */
       IOSNPD *next;
       /* pointer to next subproblem in the active list */
 };
 
-struct IOSBND
-{     /* bounds change entry */
-      int k;
-      /* ordinal number of corresponding row (1 <= k <= m) or column
-         (m+1 <= k <= m+n), where m and n are the number of rows and
-         columns, resp., in the parent subproblem */
-      unsigned char type;
-      /* new type */
-      double lb;
-      /* new lower bound */
-      double ub;
-      /* new upper bound */
-      IOSBND *next;
-      /* pointer to next entry for the same subproblem */
-};
-
-struct IOSTAT
-{     /* status change entry */
-      int k;
-      /* ordinal number of corresponding row (1 <= k <= m) or column
-         (m+1 <= k <= m+n), where m and n are the number of rows and
-         columns, resp., in the parent subproblem */
-      unsigned char stat;
-      /* new status */
-      IOSTAT *next;
-      /* pointer to next entry for the same subproblem */
-};
-
-struct IOSROW
-{     /* row (constraint) addition entry */
-      char *name;
-      /* row name or NULL */
-      unsigned char origin;
-      /* row origin flag (see glp_attr.origin) */
-      unsigned char klass;
-      /* row class descriptor (see glp_attr.klass) */
-      unsigned char type;
-      /* row type (GLP_LO, GLP_UP, etc.) */
-      double lb;
-      /* row lower bound */
-      double ub;
-      /* row upper bound */
-      IOSAIJ *ptr;
-      /* pointer to the row coefficient list */
-      double rii;
-      /* row scale factor */
-      unsigned char stat;
-      /* row status (GLP_BS, GLP_NL, etc.) */
-      IOSROW *next;
-      /* pointer to next entry for the same subproblem */
-};
-
 struct IOSAIJ
 {     /* constraint coefficient */
       int j;
@@ -399,6 +421,63 @@ struct IOSCUT
       /* pointer to next cut */
 };
 
+struct IOSGPOOL
+{     /* global cut pool; it keeps cuts passed through the local cut
+         pool, so they can be re-activated at other subproblems without
+         being separated again */
+      int size;
+      /* number of cuts in the pool */
+      int max;
+      /* maximal number of cuts (glp_iocp.cut_pool) */
+      int hsize;
+      /* size of the hash table (power of 2) */
+      IOSGCUT **htab; /* IOSGCUT *htab[hsize]; */
+      /* hash table; htab[h & (hsize-1)] is a chain of cuts having hash
+         code h */
+      IOSGCUT *head, *tail;
+      /* list of all cuts in the order of their addition */
+      double *work; /* double work[1+n]; */
+      /* working array (always zero between calls) */
+      int added, dupl, reused, removed;
+      /* statistics (see glp_gpstat) */
+};
+
+struct IOSGCUT
+{     /* cut in the global cut pool */
+      int seq;
+      /* sequential number of the subproblem, where the cut was put to
+         the local cut pool; the cut is valid in the subtree rooted at
+         this subproblem */
+      unsigned int hash;
+      /* hash code of the left-hand side (see ios_cut_hash) */
+      unsigned char klass, type;
+      /* cut class and type (as in IOSCUT) */
+      double rhs;
+      /* cut right-hand side */
+      int len;
+      /* number of cut coefficients */
+      int *ind; /* int ind[1+len]; */
+      double *val; /* double val[1+len]; */
+      /* cut coefficients */
+      double norm;
+      /* Euclidean norm of the vector of cut coefficients */
+      double eff;
+      /* cut efficacy (normalized residual) when the cut was violated
+         last time */
+      int age;
+      /* number of times the cut was checked since it was violated last
+         time */
+      int act;
+      /* sequential number of the subproblem, where the cut was re-
+         activated last time (0 means never) */
+      int dupl;
+      /* flag set if the cut has been counted as a duplicate */
+      IOSGCUT *link;
+      /* next cut in the same hash chain */
+      IOSGCUT *prev, *next;
+      /* adjacent cuts in the list of all cuts */
+};
+
 #define ios_create_tree _glp_ios_create_tree
 glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm);
 /* create branch-and-bound tree */
@@ -431,6 +510,14 @@ void ios_eval_degrad(glp_tree *tree, int j, double *dn, double *up);
 double ios_round_bound(glp_tree *tree, double bound);
 /* improve local bound by rounding */
 
+#define ios_incumb _glp_ios_incumb
+int ios_incumb(glp_tree *tree, double *obj);
+/* determine best known objective value */
+
+#define ios_cutoff _glp_ios_cutoff
+int ios_cutoff(glp_tree *tree, double *obj);
+/* determine objective value used to prune subproblems */
+
 #define ios_is_hopeful _glp_ios_is_hopeful
 int ios_is_hopeful(glp_tree *tree, double bound);
 /* check if subproblem is hopeful */
@@ -492,6 +579,31 @@ void ios_driver_run(glp_tree *tree, ios_driver_ctx *ctx);
 
 /* branch-and-bound driver */
 
+#define ios_show_progress _glp_ios_show_progress
+void ios_show_progress(glp_tree *T, int bingo);
+/* display current progress of the search */
+
+#define ios_check_integrality _glp_ios_check_integrality
+void ios_check_integrality(glp_tree *T);
+/* check integrality of basic solution */
+
+#define ios_cleanup_tree _glp_ios_cleanup_tree
+void ios_cleanup_tree(glp_tree *T);
+/* prune hopeless branches from the tree */
+
+#define ios_par_search _glp_ios_par_search
+int ios_par_search(glp_tree *tree);
+/* continue the search with several worker threads */
+
+#define IOS_GMI         1  /* Gomory's mixed integer cuts */
+#define IOS_MIR         2  /* mixed integer rounding cuts */
+#define IOS_COV         3  /* mixed cover cuts */
+#define IOS_CLQ         4  /* clique cuts */
+
+#define ios_par_sep _glp_ios_par_sep
+void ios_par_sep(glp_tree *tree, int nsep, const int sep[]);
+/* run built-in cut generators concurrently */
+
 /**********************************************************************/
 
 typedef struct IOSVEC IOSVEC;
@@ -590,6 +702,10 @@ void *ios_pcost_init(glp_tree *tree);
 int ios_pcost_branch(glp_tree *T, int *next);
 /* choose branching variable with pseudocost branching */
 
+#define ios_rel_branch _glp_ios_rel_branch
+int ios_rel_branch(glp_tree *T, int *next);
+/* choose branching variable with reliability branching */
+
 #define ios_pcost_update _glp_ios_pcost_update
 void ios_pcost_update(glp_tree *tree);
 /* update history information for pseudocost branching */
@@ -598,6 +714,15 @@ void ios_pcost_update(glp_tree *tree);
 void ios_pcost_free(glp_tree *tree);
 /* free working area used on pseudocost branching */
 
+#define ios_pcost_get _glp_ios_pcost_get
+void ios_pcost_get(glp_tree *tree, int j, int cnt[2], double sum[2]);
+/* obtain history information used on pseudocost branching */
+
+#define ios_pcost_set _glp_ios_pcost_set
+void ios_pcost_set(glp_tree *tree, int j, const int cnt[2],
+      const double sum[2]);
+/* restore history information used on pseudocost branching */
+
 #define ios_feas_pump _glp_ios_feas_pump
 void ios_feas_pump(glp_tree *T);
 /* feasibility pump heuristic */
@@ -608,14 +733,118 @@ void ios_proxy_heur(glp_tree *T);
 /* proximity search heuristic */
 #endif
 
+#define ios_sub_heur _glp_ios_sub_heur
+void ios_sub_heur(glp_tree *T);
+/* sub-MIP heuristics (RINS and local branching) */
+
 #define ios_process_cuts _glp_ios_process_cuts
 void ios_process_cuts(glp_tree *T);
 /* process cuts stored in the local cut pool */
 
+#define ios_cut_hash _glp_ios_cut_hash
+unsigned int ios_cut_hash(IOSCUT *cut);
+/* compute hash code of cut left-hand side */
+
+#define ios_gpool_create _glp_ios_gpool_create
+IOSGPOOL *ios_gpool_create(glp_tree *T);
+/* create global cut pool */
+
+#define ios_gpool_sep _glp_ios_gpool_sep
+void ios_gpool_sep(glp_tree *T);
+/* re-activate cuts from the global cut pool */
+
+#define ios_gpool_add _glp_ios_gpool_add
+void ios_gpool_add(glp_tree *T);
+/* store cuts from the local cut pool in the global cut pool */
+
+#define ios_gpool_delete _glp_ios_gpool_delete
+void ios_gpool_delete(glp_tree *T);
+/* delete global cut pool */
+
+#define ios_spool_add _glp_ios_spool_add
+void ios_spool_add(glp_tree *T);
+/* store new incumbent in solution pool */
+
+#define ios_spool_lp _glp_ios_spool_lp
+void ios_spool_lp(glp_tree *T);
+/* store integer feasible solution of LP relaxation in solution pool */
+
+#define ios_spool_free _glp_ios_spool_free
+void ios_spool_free(glp_prob *P);
+/* delete solution pool */
+
+#define ios_ckpt_load _glp_ios_ckpt_load
+int ios_ckpt_load(glp_tree *T, const char *fname);
+/* read checkpoint to resume the search */
+
+#define ios_ckpt_root _glp_ios_ckpt_root
+void ios_ckpt_root(glp_tree *T);
+/* restore cuts of checkpoint in the global cut pool */
+
+#define ios_ckpt_split _glp_ios_ckpt_split
+int ios_ckpt_split(glp_tree *T);
+/* split root subproblem into subproblems of checkpoint */
+
+#define ios_ckpt_save _glp_ios_ckpt_save
+void ios_ckpt_save(glp_tree *T, int force);
+/* write checkpoint of the search */
+
+#define ios_ckpt_free _glp_ios_ckpt_free
+void ios_ckpt_free(glp_tree *T);
+/* finish writing checkpoint and free its data */
+
 #define ios_choose_node _glp_ios_choose_node
 int ios_choose_node(glp_tree *T);
 /* select subproblem to continue the search */
 
+#define ios_heap_add _glp_ios_heap_add
+void ios_heap_add(glp_tree *T, IOSNPD *node);
+/* add active subproblem to the heaps */
+
+#define ios_heap_del _glp_ios_heap_del
+void ios_heap_del(glp_tree *T, IOSNPD *node);
+/* remove active subproblem from the heaps */
+
+#define ios_heap_update _glp_ios_heap_update
+void ios_heap_update(glp_tree *T, IOSNPD *node);
+/* restore the heaps after changing local bound of subproblem */
+
+#define ios_save_chg _glp_ios_save_chg
+void ios_save_chg(glp_tree *tree);
+/* save changes of current subproblem */
+
+#define ios_bnd_chg _glp_ios_bnd_chg
+void ios_bnd_chg(glp_tree *tree, IOSNPD *node, int k, int type,
+      double lb, double ub);
+/* save bound change of new subproblem */
+
+#define ios_bnds_chg _glp_ios_bnds_chg
+void ios_bnds_chg(glp_tree *tree, IOSNPD *node, int len,
+      const int ind[], const int type[], const double lb[],
+      const double ub[]);
+/* save bound changes of new subproblem */
+
+#define ios_load_chg _glp_ios_load_chg
+void ios_load_chg(glp_tree *tree, IOSNPD *node);
+/* apply changes of subproblem */
+
+#define ios_node_bnds _glp_ios_node_bnds
+void ios_node_bnds(glp_tree *tree, IOSNPD *node, unsigned char type[],
+      double lb[], double ub[]);
+/* determine bounds of columns of subproblem */
+
+#define ios_drop_chg _glp_ios_drop_chg
+void ios_drop_chg(glp_tree *tree, IOSNPD *node);
+/* delete changes of subproblem */
+
+#define ios_spill_chg _glp_ios_spill_chg
+void ios_spill_chg(glp_tree *tree);
+/* move packed strings to temporary file */
+
+#define ios_free_chg _glp_ios_free_chg
+void ios_free_chg(glp_tree *tree);
+/* free storage of packed strings */
+
 #define ios_choose_var _glp_ios_choose_var
 int ios_choose_var(glp_tree *T, int *next);
 /* select variable to branch on */
@@ -107,6 +107,17 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
       tree->slot = NULL;
       tree->head = tree->tail = NULL;
       tree->a_cnt = tree->n_cnt = tree->t_cnt = 0;
+      tree->heap = xcalloc(3, sizeof(IOSHEAP));
+      memset(tree->heap, 0, 3 * sizeof(IOSHEAP));
+      tree->proj_deg = 0.0;
+      tree->pk_buf = NULL;
+      tree->pk_len = tree->pk_max = 0;
+      tree->chg_mem = 0;
+      tree->chg_lim = (size_t)parm->node_mem * 1024;
+      tree->lru_head = tree->lru_tail = NULL;
+      tree->spill = NULL;
+      tree->spill_size = 0;
+      tree->spill_cnt = 0;
       /* the root subproblem is not solved yet, so its final components
          are unknown so far */
       tree->root_m = 0;
@@ -127,6 +138,7 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
       tree->pred_stat = NULL;
       /* cut generator */
       tree->local = ios_create_pool(tree);
+      tree->gpool = NULL;
       /*tree->first_attempt = 1;*/
       /*tree->max_added_cuts = 0;*/
       /*tree->min_eff = 0.0;*/
@@ -150,6 +162,8 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
       tree->dwrk = xcalloc(1+n, sizeof(double));
       /* initialize control parameters */
       tree->parm = parm;
+      if (parm->cut_pool > 0)
+         tree->gpool = ios_gpool_create(tree);
       tree->tm_beg = xtime();
 #if 0 /* 10/VI-2013 */
       tree->tm_lag = xlset(0);
@@ -173,6 +187,10 @@ glp_tree *ios_create_tree(glp_prob *mip, const glp_iocp *parm)
       tree->next_p = 0;
       /*tree->btrack = NULL;*/
       tree->stop = 0;
+      tree->ext_obj = (mip->dir == GLP_MIN ? +DBL_MAX : -DBL_MAX);
+      tree->sub_skip = 0;
+      tree->lb_obj = (mip->dir == GLP_MIN ? +DBL_MAX : -DBL_MAX);
+      tree->ckpt = NULL;
       /* create the root subproblem, which initially is identical to
          the original MIP */
       new_node(tree, NULL);
@@ -268,52 +286,9 @@ void ios_revive_node(glp_tree *tree, int p)
                tree->pred_stat[mip->m+j] = (char)col->stat;
             }
          }
-         /* change bounds of rows and columns */
-         {  IOSBND *b;
-            for (b = node->b_ptr; b != NULL; b = b->next)
-            {  if (b->k <= m)
-                  glp_set_row_bnds(mip, b->k, b->type, b->lb, b->ub);
-               else
-                  glp_set_col_bnds(mip, b->k-m, b->type, b->lb, b->ub);
-            }
-         }
-         /* change statuses of rows and columns */
-         {  IOSTAT *s;
-            for (s = node->s_ptr; s != NULL; s = s->next)
-            {  if (s->k <= m)
-                  glp_set_row_stat(mip, s->k, s->stat);
-               else
-                  glp_set_col_stat(mip, s->k-m, s->stat);
-            }
-         }
-         /* add new rows */
-         if (node->r_ptr != NULL)
-         {  IOSROW *r;
-            IOSAIJ *a;
-            int i, len, *ind;
-            double *val;
-            ind = xcalloc(1+n, sizeof(int));
-            val = xcalloc(1+n, sizeof(double));
-            for (r = node->r_ptr; r != NULL; r = r->next)
-            {  i = glp_add_rows(mip, 1);
-               glp_set_row_name(mip, i, r->name);
-#if 1 /* 20/IX-2008 */
-               xassert(mip->row[i]->level == 0);
-               mip->row[i]->level = node->level;
-               mip->row[i]->origin = r->origin;
-               mip->row[i]->klass = r->klass;
-#endif
-               glp_set_row_bnds(mip, i, r->type, r->lb, r->ub);
-               len = 0;
-               for (a = r->ptr; a != NULL; a = a->next)
-                  len++, ind[len] = a->j, val[len] = a->val;
-               glp_set_mat_row(mip, i, len, ind, val);
-               glp_set_rii(mip, i, r->rii);
-               glp_set_row_stat(mip, i, r->stat);
-            }
-            xfree(ind);
-            xfree(val);
-         }
+         /* change types, bounds and statuses of rows and columns and
+            add new rows */
+         ios_load_chg(tree, node);
 #if 0
          /* add new edges to the conflict graph */
          /* add new cliques to the conflict graph */
@@ -325,37 +300,12 @@ void ios_revive_node(glp_tree *tree, int p)
       }
       /* the specified subproblem has been revived */
       node = tree->curr;
-      /* delete its bound change list */
-      while (node->b_ptr != NULL)
-      {  IOSBND *b;
-         b = node->b_ptr;
-         node->b_ptr = b->next;
-         dmp_free_atom(tree->pool, b, sizeof(IOSBND));
-      }
-      /* delete its status change list */
-      while (node->s_ptr != NULL)
-      {  IOSTAT *s;
-         s = node->s_ptr;
-         node->s_ptr = s->next;
-         dmp_free_atom(tree->pool, s, sizeof(IOSTAT));
-      }
-#if 1 /* 20/XI-2009 */
-      /* delete its row addition list (additional rows may appear, for
-         example, due to branching on GUB constraints */
-      while (node->r_ptr != NULL)
-      {  IOSROW *r;
-         r = node->r_ptr;
-         node->r_ptr = r->next;
-         xassert(r->name == NULL);
-         while (r->ptr != NULL)
-         {  IOSAIJ *a;
-            a = r->ptr;
-            r->ptr = a->next;
-            dmp_free_atom(tree->pool, a, sizeof(IOSAIJ));
-         }
-         dmp_free_atom(tree->pool, r, sizeof(IOSROW));
-      }
-#endif
+      /* delete its packed string (additional rows may appear, for
+         example, due to branching on GUB constraints) */
+      ios_drop_chg(tree, node);
+      /* packed strings of subproblems on the path have been brought
+         back to memory, so the limit may be exceeded */
+      ios_spill_chg(tree);
 done: return;
 }
 
@@ -415,101 +365,11 @@ void ios_freeze_node(glp_tree *tree)
       else
       {  /* freeze non-root subproblem */
          int root_m = tree->root_m;
-         int pred_m = tree->pred_m;
-         int i, j, k;
-         xassert(pred_m <= m);
-         /* build change lists for rows and columns which exist in the
-            parent subproblem */
-         xassert(node->b_ptr == NULL);
-         xassert(node->s_ptr == NULL);
-         for (k = 1; k <= pred_m + n; k++)
-         {  int pred_type, pred_stat, type, stat;
-            double pred_lb, pred_ub, lb, ub;
-            /* determine attributes in the parent subproblem */
-            pred_type = tree->pred_type[k];
-            pred_lb = tree->pred_lb[k];
-            pred_ub = tree->pred_ub[k];
-            pred_stat = tree->pred_stat[k];
-            /* determine attributes in the current subproblem */
-            if (k <= pred_m)
-            {  GLPROW *row = mip->row[k];
-               type = row->type;
-               lb = row->lb;
-               ub = row->ub;
-               stat = row->stat;
-            }
-            else
-            {  GLPCOL *col = mip->col[k - pred_m];
-               type = col->type;
-               lb = col->lb;
-               ub = col->ub;
-               stat = col->stat;
-            }
-            /* save type and bounds of a row/column, if changed */
-            if (!(pred_type == type && pred_lb == lb && pred_ub == ub))
-            {  IOSBND *b;
-               b = dmp_get_atom(tree->pool, sizeof(IOSBND));
-               b->k = k;
-               b->type = (unsigned char)type;
-               b->lb = lb;
-               b->ub = ub;
-               b->next = node->b_ptr;
-               node->b_ptr = b;
-            }
-            /* save status of a row/column, if changed */
-            if (pred_stat != stat)
-            {  IOSTAT *s;
-               s = dmp_get_atom(tree->pool, sizeof(IOSTAT));
-               s->k = k;
-               s->stat = (unsigned char)stat;
-               s->next = node->s_ptr;
-               node->s_ptr = s;
-            }
-         }
-         /* save new rows added to the current subproblem */
-         xassert(node->r_ptr == NULL);
-         if (pred_m < m)
-         {  int i, len, *ind;
-            double *val;
-            ind = xcalloc(1+n, sizeof(int));
-            val = xcalloc(1+n, sizeof(double));
-            for (i = m; i > pred_m; i--)
-            {  GLPROW *row = mip->row[i];
-               IOSROW *r;
-               const char *name;
-               r = dmp_get_atom(tree->pool, sizeof(IOSROW));
-               name = glp_get_row_name(mip, i);
-               if (name == NULL)
-                  r->name = NULL;
-               else
-               {  r->name = dmp_get_atom(tree->pool, strlen(name)+1);
-                  strcpy(r->name, name);
-               }
-#if 1 /* 20/IX-2008 */
-               r->origin = row->origin;
-               r->klass = row->klass;
-#endif
-               r->type = (unsigned char)row->type;
-               r->lb = row->lb;
-               r->ub = row->ub;
-               r->ptr = NULL;
-               len = glp_get_mat_row(mip, i, ind, val);
-               for (k = 1; k <= len; k++)
-               {  IOSAIJ *a;
-                  a = dmp_get_atom(tree->pool, sizeof(IOSAIJ));
-                  a->j = ind[k];
-                  a->val = val[k];
-                  a->next = r->ptr;
-                  r->ptr = a;
-               }
-               r->rii = row->rii;
-               r->stat = (unsigned char)row->stat;
-               r->next = node->r_ptr;
-               node->r_ptr = r;
-            }
-            xfree(ind);
-            xfree(val);
-         }
+         int i, j;
+         /* save changes for rows and columns which exist in the parent
+            subproblem and new rows added to the current subproblem */
+         ios_save_chg(tree);
+         ios_spill_chg(tree);
          /* remove all rows missing in the root subproblem */
          if (m != root_m)
          {  int nrs, *num;
@@ -613,9 +473,10 @@ static IOSNPD *new_node(glp_tree *tree, IOSNPD *parent)
       node->up = parent;
       node->level = (parent == NULL ? 0 : parent->level + 1);
       node->count = 0;
-      node->b_ptr = NULL;
-      node->s_ptr = NULL;
-      node->r_ptr = NULL;
+      node->chg = NULL;
+      node->chg_len = 0;
+      node->chg_pos = -1;
+      node->lru_prev = node->lru_next = NULL;
       node->solved = 0;
 #if 0
       node->own_nn = node->own_nc = 0;
@@ -652,6 +513,8 @@ static IOSNPD *new_node(glp_tree *tree, IOSNPD *parent)
       tree->a_cnt++;
       tree->n_cnt++;
       tree->t_cnt++;
+      node->seq = tree->t_cnt;
+      ios_heap_add(tree, node);
       /* increase the number of child subproblems */
       if (parent == NULL)
          xassert(p == 1);
@@ -683,6 +546,7 @@ void ios_clone_node(glp_tree *tree, int p, int nnn, int ref[])
          node->next->prev = node->prev;
       node->prev = node->next = NULL;
       tree->a_cnt--;
+      ios_heap_del(tree, node);
       /* create clone subproblems */
       xassert(nnn > 0);
       for (k = 1; k <= nnn; k++)
@@ -732,38 +596,10 @@ void ios_delete_node(glp_tree *tree, int p)
          node->next->prev = node->prev;
       node->prev = node->next = NULL;
       tree->a_cnt--;
+      ios_heap_del(tree, node);
 loop: /* recursive deletion starts here */
-      /* delete the bound change list */
-      {  IOSBND *b;
-         while (node->b_ptr != NULL)
-         {  b = node->b_ptr;
-            node->b_ptr = b->next;
-            dmp_free_atom(tree->pool, b, sizeof(IOSBND));
-         }
-      }
-      /* delete the status change list */
-      {  IOSTAT *s;
-         while (node->s_ptr != NULL)
-         {  s = node->s_ptr;
-            node->s_ptr = s->next;
-            dmp_free_atom(tree->pool, s, sizeof(IOSTAT));
-         }
-      }
-      /* delete the row addition list */
-      while (node->r_ptr != NULL)
-      {  IOSROW *r;
-         r = node->r_ptr;
-         if (r->name != NULL)
-            dmp_free_atom(tree->pool, r->name, strlen(r->name)+1);
-         while (r->ptr != NULL)
-         {  IOSAIJ *a;
-            a = r->ptr;
-            r->ptr = a->next;
-            dmp_free_atom(tree->pool, a, sizeof(IOSAIJ));
-         }
-         node->r_ptr = r->next;
-         dmp_free_atom(tree->pool, r, sizeof(IOSROW));
-      }
+      /* delete the packed string of changes */
+      ios_drop_chg(tree, node);
 #if 0
       /* delete the edge addition list */
       /* delete the clique addition list */
@@ -860,6 +696,11 @@ void ios_delete_tree(glp_tree *tree)
       /* delete the branch-and-bound tree */
       xassert(tree->local != NULL);
       ios_delete_pool(tree, tree->local);
+      if (tree->gpool != NULL)
+         ios_gpool_delete(tree);
+      if (tree->ckpt != NULL)
+         ios_ckpt_free(tree);
+      ios_free_chg(tree);
       dmp_delete_pool(tree->pool);
       xfree(tree->orig_type);
       xfree(tree->orig_lb);
@@ -868,6 +709,11 @@ void ios_delete_tree(glp_tree *tree)
       xfree(tree->orig_prim);
       xfree(tree->orig_dual);
       xfree(tree->slot);
+      {  int k;
+         for (k = 0; k < 3; k++)
+            if (tree->heap[k].node != NULL) xfree(tree->heap[k].node);
+         xfree(tree->heap);
+      }
       if (tree->root_type != NULL) xfree(tree->root_type);
       if (tree->root_lb != NULL) xfree(tree->root_lb);
       if (tree->root_ub != NULL) xfree(tree->root_ub);
@@ -1146,6 +992,96 @@ double ios_round_bound(glp_tree *tree, double bound)
 skip: return bound;
 }
 
+/***********************************************************************
+*  NAME
+*
+*  ios_incumb - determine best known objective value
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  int ios_incumb(glp_tree *tree, double *obj);
+*
+*  DESCRIPTION
+*
+*  The routine ios_incumb determines the best objective value of all
+*  integer feasible solutions known so far, i.e. of the incumbent and
+*  of solutions found by concurrent solvers (see glp_iocp.inc_fn), and
+*  stores it to the location obj.
+*
+*  RETURNS
+*
+*  If no integer feasible solution is known, the routine returns zero;
+*  otherwise non-zero is returned. */
+
+int ios_incumb(glp_tree *tree, double *obj)
+{     glp_prob *mip = tree->mip;
+      int ret = 0;
+      if (tree->ext_obj != (mip->dir == GLP_MIN ? +DBL_MAX : -DBL_MAX))
+         ret = 1, *obj = tree->ext_obj;
+      if (mip->mip_stat == GLP_FEAS)
+      {  if (!ret || (mip->dir == GLP_MIN ? mip->mip_obj < *obj :
+             mip->mip_obj > *obj))
+            *obj = mip->mip_obj;
+         ret = 1;
+      }
+      return ret;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_cutoff - determine objective value used to prune subproblems
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  int ios_cutoff(glp_tree *tree, double *obj);
+*
+*  DESCRIPTION
+*
+*  The routine ios_cutoff determines the objective value, such that
+*  subproblems whose local bound is not better than this value cannot
+*  have integer feasible solutions of interest, and stores it to the
+*  location obj.
+*
+*  Normally this value is the best known objective value (see the
+*  routine ios_incumb). However, if the solution pool is used, it is
+*  relaxed to allow finding solutions worse than the incumbent, which
+*  still may be stored in the pool.
+*
+*  RETURNS
+*
+*  If subproblems cannot be pruned by their local bounds, the routine
+*  returns zero; otherwise non-zero is returned. */
+
+int ios_cutoff(glp_tree *tree, double *obj)
+{     glp_prob *P = tree->P;
+      int ret;
+      double dir, gap, z;
+      ret = ios_incumb(tree, obj);
+      if (ret && tree->parm->sol_pool > 0)
+      {  dir = (tree->mip->dir == GLP_MIN ? +1.0 : -1.0);
+         z = dir * (*obj);
+         /* solutions may be worse than the best one by pool_gap */
+         gap = tree->parm->pool_gap;
+         if (gap >= 1e30)
+            z = +DBL_MAX;
+         else
+            z += gap * (fabs(z) + DBL_EPSILON);
+         /* but not worse than the worst pooled one, if the pool is
+            full */
+         if (P->sp_cnt == tree->parm->sol_pool &&
+             dir * P->sp_obj[P->sp_cnt] < z)
+            z = dir * P->sp_obj[P->sp_cnt];
+         if (z == +DBL_MAX)
+            ret = 0;
+         else
+            *obj = dir * z;
+      }
+      return ret;
+}
+
 /***********************************************************************
 *  NAME
 *
@@ -1171,15 +1107,18 @@ skip: return bound;
 int ios_is_hopeful(glp_tree *tree, double bound)
 {     glp_prob *mip = tree->mip;
       int ret = 1;
-      double eps;
-      if (mip->mip_stat == GLP_FEAS)
-      {  eps = tree->parm->tol_obj * (1.0 + fabs(mip->mip_obj));
+      double eps, obj;
+      if (ios_cutoff(tree, &obj))
+      {  eps = tree->parm->tol_obj * (1.0 + fabs(obj));
+         /* if the solution pool is used, subproblems, which may have
+            solutions as good as the cutoff value, are kept */
+         if (tree->parm->sol_pool > 0) eps = - eps;
          switch (mip->dir)
          {  case GLP_MIN:
-               if (bound >= mip->mip_obj - eps) ret = 0;
+               if (bound >= obj - eps) ret = 0;
                break;
             case GLP_MAX:
-               if (bound <= mip->mip_obj + eps) ret = 0;
+               if (bound <= obj + eps) ret = 0;
                break;
             default:
                xassert(mip != mip);
@@ -1226,24 +1165,10 @@ int ios_is_hopeful(glp_tree *tree, double bound)
 *  for the best node. However, if the tree is empty, it returns zero. */
 
 int ios_best_node(glp_tree *tree)
-{     IOSNPD *node, *best = NULL;
-      switch (tree->mip->dir)
-      {  case GLP_MIN:
-            /* minimization */
-            for (node = tree->head; node != NULL; node = node->next)
-               if (best == NULL || best->bound > node->bound)
-                  best = node;
-            break;
-         case GLP_MAX:
-            /* maximization */
-            for (node = tree->head; node != NULL; node = node->next)
-               if (best == NULL || best->bound < node->bound)
-                  best = node;
-            break;
-         default:
-            xassert(tree != tree);
-      }
-      return best == NULL ? 0 : best->p;
+{     /* active subproblems are ordered by local bound in the heap
+         (see glpios12.c), so the best one is on its top */
+      IOSHEAP *heap = &tree->heap[IOS_BND];
+      return heap->size == 0 ? 0 : heap->node[1]->p;
 }
 
 /***********************************************************************
@@ -1272,12 +1197,10 @@ int ios_best_node(glp_tree *tree)
 *  The routine ios_relative_gap returns the relative mip gap. */
 
 double ios_relative_gap(glp_tree *tree)
-{     glp_prob *mip = tree->mip;
-      int p;
+{     int p;
       double best_mip, best_bnd, gap;
-      if (mip->mip_stat == GLP_FEAS)
-      {  best_mip = mip->mip_obj;
-         p = ios_best_node(tree);
+      if (ios_incumb(tree, &best_mip))
+      {  p = ios_best_node(tree);
          if (p == 0)
          {  /* the tree is empty */
             gap = 0.0;
@@ -1318,6 +1241,7 @@ int ios_solve_node(glp_tree *tree)
 {     glp_prob *mip = tree->mip;
       glp_smcp parm;
       int ret;
+      double obj;
       /* the current subproblem must exist */
       xassert(tree->curr != NULL);
       /* set some control parameters */
@@ -1342,13 +1266,13 @@ int ios_solve_node(glp_tree *tree)
          parm.out_dly = 0;
       /* if the incumbent objective value is already known, use it to
          prematurely terminate the dual simplex search */
-      if (mip->mip_stat == GLP_FEAS)
+      if (ios_cutoff(tree, &obj))
       {  switch (tree->mip->dir)
          {  case GLP_MIN:
-               parm.obj_ul = mip->mip_obj;
+               parm.obj_ul = obj;
                break;
             case GLP_MAX:
-               parm.obj_ll = mip->mip_obj;
+               parm.obj_ll = obj;
                break;
             default:
                xassert(mip != mip);
@@ -1579,6 +1503,9 @@ void ios_process_sol(glp_tree *T)
          npp_unload_sol(T->npp, T->P);
       }
       xassert(T->P != NULL);
+      /* store solution in the solution pool, if required */
+      if (T->parm->sol_pool > 0)
+         ios_spool_add(T);
       /* save solution to text file, if requested */
       if (T->save_sol != NULL)
       {  char *fn, *mark;
@@ -742,30 +742,25 @@ int ios_preprocess_node(glp_tree *tree, int max_pass)
       int m = mip->m;
       int n = mip->n;
       int i, j, nrs, *num, ret = 0;
-      double *L, *U, *l, *u;
+      double *L, *U, *l, *u, obj;
       /* the current subproblem must exist */
       xassert(tree->curr != NULL);
       /* determine original row bounds */
       L = xcalloc(1+m, sizeof(double));
       U = xcalloc(1+m, sizeof(double));
-      switch (mip->mip_stat)
-      {  case GLP_UNDEF:
-            L[0] = -DBL_MAX, U[0] = +DBL_MAX;
-            break;
-         case GLP_FEAS:
-            switch (mip->dir)
-            {  case GLP_MIN:
-                  L[0] = -DBL_MAX, U[0] = mip->mip_obj - mip->c0;
-                  break;
-               case GLP_MAX:
-                  L[0] = mip->mip_obj - mip->c0, U[0] = +DBL_MAX;
-                  break;
-               default:
-                  xassert(mip != mip);
-            }
-            break;
-         default:
-            xassert(mip != mip);
+      if (!ios_cutoff(tree, &obj))
+         L[0] = -DBL_MAX, U[0] = +DBL_MAX;
+      else
+      {  switch (mip->dir)
+         {  case GLP_MIN:
+               L[0] = -DBL_MAX, U[0] = obj - mip->c0;
+               break;
+            case GLP_MAX:
+               L[0] = obj - mip->c0, U[0] = +DBL_MAX;
+               break;
+            default:
+               xassert(mip != mip);
+         }
       }
       for (i = 1; i <= m; i++)
       {  L[i] = glp_get_row_lb(mip, i);
@@ -26,10 +26,20 @@
 #include "glpios.h"
 
 /***********************************************************************
-*  show_progress - display current progress of the search
+*  NAME
+*
+*  ios_show_progress - display current progress of the search
+*
+*  SYNOPSIS
 *
-*  This routine displays some information about current progress of the
-*  search.
+*  #include "glpios.h"
+*  void ios_show_progress(glp_tree *T, int bingo);
+*
+*  DESCRIPTION
+*
+*  The routine ios_show_progress displays some information about
+*  current progress of the search (if bingo is non-zero, the line is
+*  marked as displayed on finding a new integer feasible solution).
 *
 *  The information includes:
 *
@@ -50,7 +60,7 @@
 *  the number of completely explored subproblems, i.e. whose nodes have
 *  been removed from the tree. */
 
-static void show_progress(glp_tree *T, int bingo)
+void ios_show_progress(glp_tree *T, int bingo)
 {     int p;
       double temp;
       char best_mip[50], best_bound[50], *rho, rel_gap[50];
@@ -120,7 +130,16 @@ static int is_branch_hopeful(glp_tree *T, int p)
 }
 
 /***********************************************************************
-*  check_integrality - check integrality of basic solution
+*  NAME
+*
+*  ios_check_integrality - check integrality of basic solution
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_check_integrality(glp_tree *T);
+*
+*  DESCRIPTION
 *
 *  This routine checks if the basic solution of LP relaxation of the
 *  current subproblem satisfies to integrality conditions, i.e. that all
@@ -149,7 +168,7 @@ static int is_branch_hopeful(glp_tree *T, int p)
 *  the number of variables with the fractionality flag set, and ii_sum,
 *  which is the sum of integer infeasibilities (1). */
 
-static void check_integrality(glp_tree *T)
+void ios_check_integrality(glp_tree *T)
 {     glp_prob *mip = T->mip;
       int j, type, ii_cnt = 0;
       double lb, ub, x, temp1, temp2, ii_sum = 0.0;
@@ -255,20 +274,71 @@ static void record_solution(glp_tree *T)
       return;
 }
 
+/***********************************************************************
+*  is_better - check if LP solution is better than incumbent
+*
+*  This routine checks if the objective value of the basic solution of
+*  LP relaxation of the current subproblem is better than the objective
+*  value of the incumbent. */
+
+static int is_better(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      int ret = 1;
+      if (mip->mip_stat == GLP_FEAS)
+      {  switch (mip->dir)
+         {  case GLP_MIN:
+               ret = (mip->obj_val < mip->mip_obj);
+               break;
+            case GLP_MAX:
+               ret = (mip->obj_val > mip->mip_obj);
+               break;
+            default:
+               xassert(mip != mip);
+         }
+      }
+      return ret;
+}
+
+/***********************************************************************
+*  pool_var - choose column to split integer feasible subproblem
+*
+*  If the solution pool is used, a subproblem whose LP relaxation has
+*  integer feasible optimal solution cannot be fathomed, since it may
+*  have other integer feasible solutions to be stored in the pool. This
+*  routine chooses an integer column which is not fixed in the current
+*  subproblem to split the subproblem on it. If all integer columns are
+*  fixed, the routine returns zero. */
+
+static int pool_var(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      int j;
+      for (j = 1; j <= mip->n; j++)
+      {  GLPCOL *col = mip->col[j];
+         if (col->kind == GLP_IV && col->type != GLP_FX)
+            break;
+      }
+      return j <= mip->n ? j : 0;
+}
+
 /***********************************************************************
 *  fix_by_red_cost - fix non-basic integer columns by reduced costs
 *
 *  This routine fixes some non-basic integer columns if their reduced
 *  costs indicate that increasing (decreasing) the column at least by
 *  one involves the objective value becoming worse than the incumbent
-*  objective value. */
+*  objective value. The objective value is compared with the cutoff in
+*  the same way and with the same tolerance as local bounds of
+*  subproblems (see ios_is_hopeful). */
 
 static void fix_by_red_cost(glp_tree *T)
 {     glp_prob *mip = T->mip;
       int j, stat, fixed = 0;
-      double obj, lb, ub, dj;
+      double obj, lb, ub, dj, z;
       /* the global bound must exist */
       xassert(T->mip->mip_stat == GLP_FEAS);
+      /* and determine the cutoff value, which may differ from it */
+      if (!ios_cutoff(T, &z))
+         return;
       /* basic solution of LP relaxation must be optimal */
       xassert(mip->pbs_stat == GLP_FEAS && mip->dbs_stat == GLP_FEAS);
       /* determine the objective function value */
@@ -289,13 +359,13 @@ static void fix_by_red_cost(glp_tree *T)
                if (stat == GLP_NL)
                {  /* j-th column is non-basic on its lower bound */
                   if (dj < 0.0) dj = 0.0;
-                  if (obj + dj >= mip->mip_obj)
+                  if (!ios_is_hopeful(T, obj + dj))
                      glp_set_col_bnds(mip, j, GLP_FX, lb, lb), fixed++;
                }
                else if (stat == GLP_NU)
                {  /* j-th column is non-basic on its upper bound */
                   if (dj > 0.0) dj = 0.0;
-                  if (obj - dj >= mip->mip_obj)
+                  if (!ios_is_hopeful(T, obj - dj))
                      glp_set_col_bnds(mip, j, GLP_FX, ub, ub), fixed++;
                }
                break;
@@ -304,13 +374,13 @@ static void fix_by_red_cost(glp_tree *T)
                if (stat == GLP_NL)
                {  /* j-th column is non-basic on its lower bound */
                   if (dj > 0.0) dj = 0.0;
-                  if (obj + dj <= mip->mip_obj)
+                  if (!ios_is_hopeful(T, obj + dj))
                      glp_set_col_bnds(mip, j, GLP_FX, lb, lb), fixed++;
                }
                else if (stat == GLP_NU)
                {  /* j-th column is non-basic on its upper bound */
                   if (dj < 0.0) dj = 0.0;
-                  if (obj - dj <= mip->mip_obj)
+                  if (!ios_is_hopeful(T, obj - dj))
                      glp_set_col_bnds(mip, j, GLP_FX, ub, ub), fixed++;
                }
                break;
@@ -374,8 +444,19 @@ static int branch_on(glp_tree *T, int j, int next)
       ub = mip->col[j]->ub;
       beta = mip->col[j]->prim;
       /* determine new bounds of x[j] for down- and up-branches */
-      new_ub = floor(beta);
-      new_lb = ceil(beta);
+      if (T->non_int[j])
+      {  new_ub = floor(beta);
+         new_lb = ceil(beta);
+      }
+      else
+      {  /* x[j] is integral, that is only possible if the solution
+            pool is used (see pool_var); its current value is kept in
+            the down-branch, unless it is the upper bound of x[j] */
+         new_ub = floor(beta + 0.5);
+         if ((type == GLP_UP || type == GLP_DB) && new_ub >= ub)
+            new_ub = ub - 1.0;
+         new_lb = new_ub + 1.0;
+      }
       switch (type)
       {  case GLP_FR:
             dn_type = GLP_UP;
@@ -403,7 +484,10 @@ static int branch_on(glp_tree *T, int j, int next)
             xassert(type != type);
       }
       /* compute local bounds to LP relaxation for both branches */
-      ios_eval_degrad(T, j, &dn_lp, &up_lp);
+      if (T->non_int[j])
+         ios_eval_degrad(T, j, &dn_lp, &up_lp);
+      else
+         dn_lp = up_lp = mip->obj_val;
       /* and improve them by rounding */
       dn_bnd = ios_round_bound(T, dn_lp);
       up_bnd = ios_round_bound(T, up_lp);
@@ -431,6 +515,7 @@ static int branch_on(glp_tree *T, int j, int next)
          }
          else
             xassert(mip != mip);
+         ios_heap_update(T, T->curr);
          ret = 1;
          goto done;
       }
@@ -449,6 +534,7 @@ static int branch_on(glp_tree *T, int j, int next)
          }
          else
             xassert(mip != mip);
+         ios_heap_update(T, T->curr);
          ret = 1;
          goto done;
       }
@@ -459,7 +545,7 @@ static int branch_on(glp_tree *T, int j, int next)
       /* determine the reference number of the current subproblem */
       xassert(T->curr != NULL);
       p = T->curr->p;
-      T->curr->br_var = j;
+      T->curr->br_var = (T->non_int[j] ? j : 0);
       T->curr->br_val = beta;
       /* freeze the current subproblem */
       ios_freeze_node(T);
@@ -473,13 +559,7 @@ static int branch_on(glp_tree *T, int j, int next)
       node = T->slot[clone[1]].node;
       xassert(node != NULL);
       xassert(node->up != NULL);
-      xassert(node->b_ptr == NULL);
-      node->b_ptr = dmp_get_atom(T->pool, sizeof(IOSBND));
-      node->b_ptr->k = m + j;
-      node->b_ptr->type = (unsigned char)dn_type;
-      node->b_ptr->lb = lb;
-      node->b_ptr->ub = new_ub;
-      node->b_ptr->next = NULL;
+      ios_bnd_chg(T, node, m + j, dn_type, lb, new_ub);
       node->lp_obj = dn_lp;
       if (mip->dir == GLP_MIN)
       {  if (node->bound < dn_bnd)
@@ -491,17 +571,12 @@ static int branch_on(glp_tree *T, int j, int next)
       }
       else
          xassert(mip != mip);
+      ios_heap_update(T, node);
       /* set new lower bound of j-th column in the up-branch */
       node = T->slot[clone[2]].node;
       xassert(node != NULL);
       xassert(node->up != NULL);
-      xassert(node->b_ptr == NULL);
-      node->b_ptr = dmp_get_atom(T->pool, sizeof(IOSBND));
-      node->b_ptr->k = m + j;
-      node->b_ptr->type = (unsigned char)up_type;
-      node->b_ptr->lb = new_lb;
-      node->b_ptr->ub = ub;
-      node->b_ptr->next = NULL;
+      ios_bnd_chg(T, node, m + j, up_type, new_lb, ub);
       node->lp_obj = up_lp;
       if (mip->dir == GLP_MIN)
       {  if (node->bound < up_bnd)
@@ -513,6 +588,7 @@ static int branch_on(glp_tree *T, int j, int next)
       }
       else
          xassert(mip != mip);
+      ios_heap_update(T, node);
       /* suggest the subproblem to be solved next */
       xassert(T->child == 0);
       if (next == GLP_NO_BRNCH)
@@ -528,7 +604,16 @@ done: return ret;
 }
 
 /***********************************************************************
-*  cleanup_the_tree - prune hopeless branches from the tree
+*  NAME
+*
+*  ios_cleanup_tree - prune hopeless branches from the tree
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_cleanup_tree(glp_tree *T);
+*
+*  DESCRIPTION
 *
 *  This routine walks through the active list and checks the local
 *  bound for every active subproblem. If the local bound indicates that
@@ -536,11 +621,13 @@ done: return ret;
 *  incumbent objective value, the routine deletes such subproblem that,
 *  in turn, involves pruning the corresponding branch of the tree. */
 
-static void cleanup_the_tree(glp_tree *T)
+void ios_cleanup_tree(glp_tree *T)
 {     IOSNPD *node, *next_node;
       int count = 0;
+      double obj;
       /* the global bound must exist */
-      xassert(T->mip->mip_stat == GLP_FEAS);
+      if (!ios_incumb(T, &obj))
+         return;
       /* walk through the list of active subproblems */
       for (node = T->head; node != NULL; node = next_node)
       {  /* deleting some active problem node may involve deleting its
@@ -698,6 +785,7 @@ done: glp_delete_prob(lp);
 
 static void generate_cuts(glp_tree *T)
 {     /* generate generic cuts with built-in generators */
+      int k, nsep, sep[1+4];
       if (!(T->parm->mir_cuts == GLP_ON ||
             T->parm->gmi_cuts == GLP_ON ||
             T->parm->cov_cuts == GLP_ON ||
@@ -715,19 +803,20 @@ static void generate_cuts(glp_tree *T)
          if (added_cuts >= max_cuts) goto done;
       }
 #endif
-      /* generate and add to POOL all cuts violated by x* */
+      /* determine generators to be used */
+      nsep = 0;
       if (T->parm->gmi_cuts == GLP_ON)
       {  if (T->curr->changed < 7)
-            ios_gmi_gen(T);
+            sep[++nsep] = IOS_GMI;
       }
       if (T->parm->mir_cuts == GLP_ON)
       {  xassert(T->mir_gen != NULL);
-         ios_mir_gen(T, T->mir_gen);
+         sep[++nsep] = IOS_MIR;
       }
       if (T->parm->cov_cuts == GLP_ON)
       {  /* cover cuts works well along with mir cuts */
          /*if (T->round <= 5)*/
-            ios_cov_gen(T);
+            sep[++nsep] = IOS_COV;
       }
       if (T->parm->clq_cuts == GLP_ON)
       {  if (T->clq_gen != NULL)
@@ -738,7 +827,33 @@ static void generate_cuts(glp_tree *T)
          {  if (T->curr->level == 0 && T->curr->changed < 500 ||
                 T->curr->level >  0 && T->curr->changed < 50)
 #endif
+               sep[++nsep] = IOS_CLQ;
+         }
+      }
+#ifdef HAVE_ENV
+      if (T->parm->threads > 1 && nsep > 1)
+      {  /* run the generators concurrently */
+         ios_par_sep(T, nsep, sep);
+         goto done;
+      }
+#endif
+      /* generate and add to POOL all cuts violated by x* */
+      for (k = 1; k <= nsep; k++)
+      {  switch (sep[k])
+         {  case IOS_GMI:
+               ios_gmi_gen(T);
+               break;
+            case IOS_MIR:
+               ios_mir_gen(T, T->mir_gen);
+               break;
+            case IOS_COV:
+               ios_cov_gen(T);
+               break;
+            case IOS_CLQ:
                ios_clq_gen(T, T->clq_gen);
+               break;
+            default:
+               xassert(T != T);
          }
       }
 done: return;
@@ -876,6 +991,9 @@ void ios_driver_run(glp_tree *T, ios_driver_ctx *ctx)
 loop: /* main loop starts here */
       /* at this point the current subproblem does not exist */
       xassert(T->curr == NULL);
+      /* write checkpoint of the search, if it is time to do so */
+      if (T->parm->ckpt_file != NULL)
+         ios_ckpt_save(T, 0);
       /* if the active list is empty, the search is finished */
       if (T->head == NULL)
       {  if (T->parm->msg_lev >= GLP_MSG_DBG)
@@ -888,6 +1006,21 @@ loop: /* main loop starts here */
          ctx->ret = 0;
          goto done;
       }
+#ifdef HAVE_ENV
+      /* once the root subproblem has been branched, the rest of the
+         search can be performed by worker threads sharing the tree,
+         unless the application program needs to be called back, the
+         solution pool is used or checkpoints are written */
+      if (ctx->pred_p == 1 && T->parm->threads > 1 &&
+          T->parm->cb_func == NULL && T->parm->sol_pool == 0 &&
+          T->parm->ckpt_file == NULL)
+      {  ctx->ret = ios_par_search(T);
+         /* if no worker thread could be started, the search is
+            continued by the serial driver */
+         if (ctx->ret >= 0)
+            goto done;
+      }
+#endif
       /* select some active subproblem to continue the search */
       xassert(T->next_p == 0);
       /* let the application program select subproblem */
@@ -969,6 +1102,9 @@ select:
                xprintf("Clique cuts enabled\n");
             T->clq_gen = ios_clq_init(T);
          }
+         /* restore cuts kept in the checkpoint being resumed */
+         if (T->ckpt != NULL)
+            ios_ckpt_root(T);
       }
 #if 1 /* 18/VII-2013 */
       ctx->bad_cut = 0;
@@ -981,7 +1117,7 @@ more: /* minor loop starts here */
           T->parm->msg_lev >= GLP_MSG_ON &&
         (double)(T->parm->out_frq - 1) <=
             1000.0 * xdifftime(xtime(), T->tm_lag))
-         show_progress(T, 0);
+         ios_show_progress(T, 0);
       if (T->parm->msg_lev >= GLP_MSG_ALL &&
             xdifftime(xtime(), ctx->ttt) >= 60.0)
 #if 0 /* 16/II-2012 */
@@ -999,6 +1135,30 @@ more: /* minor loop starts here */
          ctx->ttt = xtime();
       }
 #endif
+      /* exchange the incumbent objective value with concurrent solvers;
+         the current branch may become hopeless */
+      if (T->parm->inc_fn != NULL)
+      {  glp_prob *mip = T->mip;
+         double z = T->parm->inc_fn(T->parm->inc_info,
+            mip->mip_stat == GLP_FEAS ? mip->mip_obj :
+            mip->dir == GLP_MIN ? +DBL_MAX : -DBL_MAX);
+         if (mip->dir == GLP_MIN ? z < T->ext_obj : z > T->ext_obj)
+            T->ext_obj = z;
+         if (!is_branch_hopeful(T, ctx->p))
+         {  if (T->parm->msg_lev >= GLP_MSG_DBG)
+               xprintf("Current branch became hopeless and can be prune"
+                  "d\n");
+            goto fath;
+         }
+      }
+      /* check if the search is requested to be terminated */
+      if (T->parm->stop_fn != NULL &&
+          T->parm->stop_fn(T->parm->stop_info))
+      {  if (T->parm->msg_lev >= GLP_MSG_DBG)
+            xprintf("Termination requested; search terminated\n");
+         ctx->ret = GLP_ESTOP;
+         goto done;
+      }
       /* check the mip gap */
       if (T->parm->mip_gap > 0.0 &&
           ios_relative_gap(T) <= T->parm->mip_gap)
@@ -1082,7 +1242,8 @@ prepro:
       else if (ctx->p_stat == GLP_INFEAS && ctx->d_stat == GLP_FEAS)
       {  /* LP relaxation has no primal solution which is better than
             the incumbent objective value */
-         xassert(T->mip->mip_stat == GLP_FEAS);
+         xassert(T->mip->mip_stat == GLP_FEAS ||
+            T->parm->inc_fn != NULL);
          if (T->parm->msg_lev >= GLP_MSG_DBG)
             xprintf("LP relaxation has no solution better than incumben"
                "t objective value\n");
@@ -1121,6 +1282,7 @@ prepro:
          }
          else
             xassert(T->mip != T->mip);
+         ios_heap_update(T, T->curr);
          if (T->parm->msg_lev >= GLP_MSG_DBG)
             xprintf("Local bound is %.9e\n", bound);
       }
@@ -1160,9 +1322,19 @@ rowgen:
          }
       }
       /* check if the basic solution is integer feasible */
-      check_integrality(T);
+      ios_check_integrality(T);
       /* if the basic solution satisfies to all integrality conditions,
          it is a new, better integer feasible solution */
+      if (T->curr->ii_cnt == 0 && T->parm->sol_pool > 0 &&
+          !is_better(T))
+      {  /* it is not better than the incumbent, since pruning is
+            relaxed while the solution pool is used; however, it may be
+            stored in the pool */
+         if (T->parm->msg_lev >= GLP_MSG_DBG)
+            xprintf("Integer feasible solution found\n");
+         ios_spool_lp(T);
+         goto pool;
+      }
       if (T->curr->ii_cnt == 0)
       {  if (T->parm->msg_lev >= GLP_MSG_DBG)
             xprintf("New integer feasible solution found\n");
@@ -1170,7 +1342,7 @@ rowgen:
             display_cut_info(T);
          record_solution(T);
          if (T->parm->msg_lev >= GLP_MSG_ON)
-            show_progress(T, 1);
+            ios_show_progress(T, 1);
 #if 1 /* 11/VII-2013 */
          ios_process_sol(T);
 #endif
@@ -1189,7 +1361,7 @@ bingo:
          }
          /* since the current subproblem has been fathomed, prune its
             branch */
-         goto fath;
+         goto pool;
       }
       /* at this point basic solution to LP relaxation of the current
          subproblem is optimal, but integer infeasible */
@@ -1248,6 +1420,20 @@ heur:
          }
       }
 #endif
+      /* try to improve the incumbent with sub-MIP heuristics */
+      if (T->parm->rins_heur || T->parm->lb_heur)
+      {  xassert(T->reason == 0);
+         T->reason = GLP_IHEUR;
+         ios_sub_heur(T);
+         T->reason = 0;
+         /* check if the current branch became hopeless */
+         if (!is_branch_hopeful(T, ctx->p))
+         {  if (T->parm->msg_lev >= GLP_MSG_DBG)
+               xprintf("Current branch became hopeless and can be prune"
+                  "d\n");
+            goto fath;
+         }
+      }
 #if 1 /* 24/X-2015 */
       /* try to find solution with a simple rounding heuristic */
       if (T->parm->sr_heur)
@@ -1304,6 +1490,16 @@ cutgen:
          generate_cuts(T);
          T->reason = 0;
       }
+      /* re-activate violated cuts from the global cut pool (unlike
+         the built-in generators this is cheap, so it is done at every
+         node) */
+      if (T->gpool != NULL && (ctx->bad_cut == 0 ||
+          (T->curr->level == 0 && ctx->bad_cut <= 3)))
+      {  xassert(T->reason == 0);
+         T->reason = GLP_ICUTGEN;
+         ios_gpool_sep(T);
+         T->reason = 0;
+      }
       /* if the local cut pool is not empty, select useful cuts and add
          them to the current subproblem */
       if (T->local->size > 0)
@@ -1312,7 +1508,9 @@ cutgen:
          ios_process_cuts(T);
          T->reason = 0;
       }
-      /* clear the local cut pool */
+      /* save cuts in the global cut pool and clear the local one */
+      if (T->gpool != NULL && T->local->size > 0)
+         ios_gpool_add(T);
       ios_clear_pool(T, T->local);
       /* perform re-optimization, if necessary */
       if (T->reopt)
@@ -1326,6 +1524,17 @@ cutgen:
          display_cut_info(T);
       /* update history information used on pseudocost branching */
       if (T->pcost != NULL) ios_pcost_update(T);
+      /* if the search is resumed, split the root subproblem into the
+         subproblems kept in the checkpoint */
+      if (T->curr->level == 0 && T->ckpt != NULL)
+      {  ctx->ret = ios_ckpt_split(T);
+         if (ctx->ret == 0)
+         {  ctx->pred_p = 0;
+            goto loop;
+         }
+         else if (ctx->ret == 2)
+            goto fath;
+      }
       /* it's time to perform branching */
       xassert(T->br_var == 0);
       xassert(T->br_sel == 0);
@@ -1348,7 +1557,7 @@ branch:
          by the branching technique option */
       if (T->br_var == 0)
          T->br_var = ios_choose_var(T, &T->br_sel);
-      /* perform actual branching */
+split: /* perform actual branching */
       ctx->curr_p = T->curr->p;
       ctx->ret = branch_on(T, T->br_var, T->br_sel);
       T->br_var = T->br_sel = 0;
@@ -1375,6 +1584,17 @@ branch:
       }
       else
          xassert(ctx->ret != ctx->ret);
+pool: /* integer feasible solution to LP relaxation of the current
+         subproblem has been found; if the solution pool is used, the
+         subproblem may have other integer feasible solutions, so it is
+         split on some integer column which is not fixed yet */
+      if (T->parm->sol_pool > 0)
+      {  T->br_var = pool_var(T);
+         if (T->br_var != 0)
+         {  T->br_sel = GLP_DN_BRNCH;
+            goto split;
+         }
+      }
 fath: /* the current subproblem has been fathomed */
       if (T->parm->msg_lev >= GLP_MSG_DBG)
          xprintf("Node %d fathomed\n", ctx->p);
@@ -1384,13 +1604,18 @@ fath: /* the current subproblem has been fathomed */
       ios_delete_node(T, ctx->p);
       /* if a new integer feasible solution has just been found, other
          branches may become hopeless and therefore must be pruned */
-      if (T->mip->mip_stat == GLP_FEAS) cleanup_the_tree(T);
+      if (T->mip->mip_stat == GLP_FEAS || T->parm->inc_fn != NULL)
+         ios_cleanup_tree(T);
       /* new subproblem selection is needed due to backtracking */
       ctx->pred_p = 0;
       goto loop;
 done: /* display progress of the search on exit from the solver */
       if (T->parm->msg_lev >= GLP_MSG_ON)
-         show_progress(T, 0);
+         ios_show_progress(T, 0);
+      /* write final checkpoint, so the search can be resumed if it has
+         been terminated prematurely */
+      if (T->parm->ckpt_file != NULL)
+         ios_ckpt_save(T, 1);
       if (T->mir_gen != NULL)
          ios_mir_term(T->mir_gen), T->mir_gen = NULL;
       if (T->clq_gen != NULL)
@@ -24,6 +24,9 @@
 
 #include "glpenv.h"
 #include "glpios.h"
+#ifdef HAVE_ENV
+#include <pthread.h>
+#endif
 
 /***********************************************************************
 *  NAME
@@ -72,6 +75,10 @@ int ios_choose_var(glp_tree *T, int *next)
       {  /* hybrid pseudocost heuristic */
          j = ios_pcost_branch(T, next);
       }
+      else if (T->parm->br_tech == GLP_BR_RLB)
+      {  /* reliability branching */
+         j = ios_rel_branch(T, next);
+      }
       else
          xassert(T != T);
       return j;
@@ -498,6 +505,10 @@ void ios_pcost_update(glp_tree *tree)
       /* determine branching variable x[j], which was used in the
          parent subproblem to create the current subproblem */
       j = tree->curr->up->br_var;
+      /* j = 0 means that the parent subproblem has been split on an
+         integral column to collect solutions into the solution pool,
+         so no degradation is observed */
+      if (j == 0) goto skip;
       xassert(1 <= j && j <= tree->n);
       /* determine the change dx[j] = new x[j] - old x[j],
          where new x[j] is a value of x[j] in optimal solution to LP
@@ -538,6 +549,30 @@ void ios_pcost_free(glp_tree *tree)
       return;
 }
 
+void ios_pcost_get(glp_tree *tree, int j, int cnt[2], double sum[2])
+{     /* obtain history information for variable x[j]; index 0 means
+         down-branches, index 1 means up-branches */
+      struct csa *csa = tree->pcost;
+      xassert(csa != NULL);
+      xassert(1 <= j && j <= tree->n);
+      cnt[0] = csa->dn_cnt[j], sum[0] = csa->dn_sum[j];
+      cnt[1] = csa->up_cnt[j], sum[1] = csa->up_sum[j];
+      return;
+}
+
+void ios_pcost_set(glp_tree *tree, int j, const int cnt[2],
+      const double sum[2])
+{     /* restore history information for variable x[j] (see above) */
+      struct csa *csa;
+      if (tree->pcost == NULL)
+         tree->pcost = ios_pcost_init(tree);
+      csa = tree->pcost;
+      xassert(1 <= j && j <= tree->n);
+      csa->dn_cnt[j] = cnt[0], csa->dn_sum[j] = sum[0];
+      csa->up_cnt[j] = cnt[1], csa->up_sum[j] = sum[1];
+      return;
+}
+
 static double eval_psi(glp_tree *T, int j, int brnch)
 {     /* compute estimation of pseudocost of variable x[j] for down-
          or up-branch */
@@ -661,4 +696,371 @@ done: *_next = sel;
       return jjj;
 }
 
+/***********************************************************************
+*  Reliability branching
+*
+*  Pseudocosts of a variable are considered as reliable if both its
+*  down- and up-pseudocosts have been observed at least rel_lim times.
+*  Candidates are looked through in decreasing order of their scores
+*  computed with current pseudocosts (uninitialized pseudocosts are
+*  replaced by averages); for candidates whose pseudocosts are not
+*  reliable strong branching is performed, i.e. LP relaxations of both
+*  branches are re-optimized with at most sb_it_lim iterations of the
+*  dual simplex, and the resulting degradations are used as the scores
+*  and as new observations of the pseudocosts. The search stops if the
+*  best score has not been improved for sb_look candidates in a row.
+*  If rel_lim is zero, all pseudocosts are considered as reliable, so
+*  candidates are chosen by pseudocosts only, and uninitialized ones
+*  are replaced by averages.
+*
+*  Strong branching uses the threads allowed by the control parameter
+*  threads, which is shared with the other parallel parts of the solver
+*  (presolving, cut generation and tree search); up to threads
+*  unreliable candidates are evaluated at once, each on a private copy
+*  of the LP relaxation, so the choice depends on the number of threads,
+*  but not on timing. If the parallel tree search is used, candidates
+*  are evaluated serially by each search thread.
+*
+*  This technique is described in:
+*
+*  T.Achterberg, T.Koch, A.Martin. Branching rules revisited. Operations
+*  Research Letters 33 (2005), pp. 42-54. */
+
+typedef struct
+{     /* strong branching evaluator */
+      glp_prob *P;
+      /* LP relaxation of the current subproblem */
+      glp_prob *lp;
+      /* private copy of P (created on the first use) */
+      int it_lim;
+      /* simplex iteration limit per branch */
+      const int *list; /* int list[1+nl]; */
+      int nl;
+      /* candidates to be evaluated */
+      int first, step;
+      /* the evaluator processes list[first], list[first+step], ... */
+      double *dn, *up; /* double dn[1+nl], up[1+nl]; */
+      /* degradations of the objective in down- and up-branches */
+      int it_cnt;
+      /* number of simplex iterations performed */
+} SBEVAL;
+
+static double sb_degrad(SBEVAL *E, int j, int kase)
+{     /* perform strong branching on column x[j] and return degradation
+         of the objective (DBL_MAX means that the branch either has no
+         primal feasible solution or cannot improve the incumbent) */
+      glp_prob *P = E->P, *lp = E->lp;
+      GLPCOL *col = lp->col[j];
+      glp_smcp parm;
+      int i, ret, type = col->type, it_cnt = lp->it_cnt;
+      double lb = col->lb, ub = col->ub, beta = P->col[j]->prim, l, u,
+         degrad;
+      /* introduce new bound of x[j] */
+      l = (type == GLP_FR || type == GLP_UP ? -DBL_MAX : lb);
+      u = (type == GLP_FR || type == GLP_LO ? +DBL_MAX : ub);
+      if (kase < 0)
+         u = floor(beta);
+      else
+         l = ceil(beta);
+      if (l == -DBL_MAX)
+         glp_set_col_bnds(lp, j, GLP_UP, 0.0, u);
+      else if (u == +DBL_MAX)
+         glp_set_col_bnds(lp, j, GLP_LO, l, 0.0);
+      else if (l != u)
+         glp_set_col_bnds(lp, j, GLP_DB, l, u);
+      else
+         glp_set_col_bnds(lp, j, GLP_FX, l, u);
+      /* re-optimize with limited number of iterations */
+      glp_init_smcp(&parm);
+      parm.msg_lev = GLP_MSG_OFF;
+      parm.meth = GLP_DUAL;
+      parm.it_lim = E->it_lim;
+      parm.out_dly = 1000;
+      if (P->mip_stat == GLP_FEAS)
+      {  /* the incumbent value is used to terminate the search */
+         if (P->dir == GLP_MIN)
+            parm.obj_ul = P->mip_obj;
+         else
+            parm.obj_ll = P->mip_obj;
+      }
+      ret = glp_simplex(lp, &parm);
+      E->it_cnt += lp->it_cnt - it_cnt;
+      if (ret == GLP_EOBJUL || ret == GLP_EOBJLL)
+      {  /* the branch cannot have better integer feasible solution */
+         degrad = DBL_MAX;
+      }
+      else if (ret == 0 || ret == GLP_EITLIM)
+      {  if (glp_get_prim_stat(lp) == GLP_NOFEAS)
+            degrad = DBL_MAX;
+         else if (glp_get_dual_stat(lp) == GLP_FEAS)
+         {  /* see eval_degrad */
+            if (P->dir == GLP_MIN)
+               degrad = lp->obj_val - P->obj_val;
+            else
+               degrad = P->obj_val - lp->obj_val;
+            if (degrad < 1e-6 * (1.0 + 0.001 * fabs(P->obj_val)))
+               degrad = 0.0;
+         }
+         else
+            degrad = 0.0;
+      }
+      else
+      {  /* the simplex solver failed */
+         degrad = 0.0;
+      }
+      /* restore bounds of x[j] and the basis of P */
+      glp_set_col_bnds(lp, j, type, lb, ub);
+      for (i = 1; i <= lp->m; i++)
+         glp_set_row_stat(lp, i, P->row[i]->stat);
+      for (i = 1; i <= lp->n; i++)
+         glp_set_col_stat(lp, i, P->col[i]->stat);
+      return degrad;
+}
+
+static void sb_eval(SBEVAL *E)
+{     /* perform strong branching on candidates assigned */
+      int t;
+      if (E->lp == NULL)
+      {  E->lp = glp_create_prob();
+         glp_copy_prob(E->lp, E->P, GLP_OFF);
+      }
+      for (t = E->first; t <= E->nl; t += E->step)
+      {  E->dn[t] = sb_degrad(E, E->list[t], -1);
+         E->up[t] = sb_degrad(E, E->list[t], +1);
+      }
+      return;
+}
+
+#ifdef HAVE_ENV
+static void *sb_thread(void *arg)
+{     /* strong branching thread routine; the thread has its own
+         environment, so the copy of P is created and deleted in the
+         thread (see glpios13.c) */
+      SBEVAL *E = arg;
+      glp_term_out(GLP_OFF);
+      sb_eval(E);
+      glp_delete_prob(E->lp);
+      E->lp = NULL;
+      glp_free_env();
+      return NULL;
+}
+#endif
+
+static void strong_branch(glp_prob *P, SBEVAL *E, int nthreads)
+{     /* perform strong branching on candidates E[0].list[1, ..., nl]
+         using up to nthreads threads; E[0] is used by the calling thread
+         and keeps its copy of P between calls */
+      int k;
+      if (nthreads > E[0].nl) nthreads = E[0].nl;
+      for (k = 0; k < nthreads; k++)
+      {  if (k > 0)
+         {  E[k] = E[0];
+            E[k].lp = NULL;
+            E[k].it_cnt = 0;
+         }
+         E[k].first = 1 + k, E[k].step = nthreads;
+      }
+#ifdef HAVE_ENV
+      if (nthreads > 1)
+      {  pthread_t *tid;
+         glp_bfcp bfcp;
+         char *run;
+         /* glp_copy_prob called by the threads would otherwise create
+            the basis factorization driver of P in foreign environment */
+         glp_get_bfcp(P, &bfcp);
+         tid = xcalloc(nthreads, sizeof(pthread_t));
+         run = xcalloc(nthreads, sizeof(char));
+         for (k = 1; k < nthreads; k++)
+            run[k] = (char)(pthread_create(&tid[k], NULL, sb_thread,
+               &E[k]) == 0);
+         sb_eval(&E[0]);
+         for (k = 1; k < nthreads; k++)
+         {  if (run[k])
+               pthread_join(tid[k], NULL);
+            else
+            {  /* the thread failed to start; evaluate its candidates
+                  on the copy of the calling thread */
+               E[k].lp = E[0].lp;
+               sb_eval(&E[k]);
+            }
+            E[0].it_cnt += E[k].it_cnt;
+         }
+         xfree(tid);
+         xfree(run);
+         return;
+      }
+#else
+      xassert(P == E[0].P);
+#endif
+      for (k = 0; k < nthreads; k++)
+      {  if (k > 0) E[k].lp = E[0].lp;
+         sb_eval(&E[k]);
+         if (k > 0) E[0].it_cnt += E[k].it_cnt;
+      }
+      return;
+}
+
+struct cand
+{     /* branching candidate */
+      int j;
+      /* column number */
+      double score;
+      /* score estimated with pseudocosts */
+};
+
+static int fcmp(const void *a1, const void *b1)
+{     /* compare candidates in decreasing order of scores */
+      const struct cand *a = a1, *b = b1;
+      if (a->score > b->score) return -1;
+      if (a->score < b->score) return +1;
+      return a->j - b->j;
+}
+
+static double score(double d1, double d2)
+{     /* compute product score of degradations */
+      if (d1 < 1e-6) d1 = 1e-6;
+      if (d2 < 1e-6) d2 = 1e-6;
+      return d1 * d2;
+}
+
+int ios_rel_branch(glp_tree *T, int *_next)
+{     /* choose branching variable with reliability branching */
+      const glp_iocp *parm = T->parm;
+      struct csa *csa;
+      struct cand *cand;
+      SBEVAL *E;
+      int n = T->n, nc, nl, nthreads, t, s, j, jjj, sel, look, cnt,
+         *list;
+      double beta, f, d1, d2, dd_dn, dd_up, psi_dn, psi_up, sc, best,
+         dmax;
+      /* initialize the working arrays */
+      if (T->pcost == NULL)
+         T->pcost = ios_pcost_init(T);
+      csa = T->pcost;
+      /* compute average pseudocosts to replace uninitialized ones */
+      psi_dn = psi_up = 0.0;
+      for (j = 1, s = t = 0; j <= n; j++)
+      {  if (csa->dn_cnt[j] > 0)
+            s++, psi_dn += csa->dn_sum[j] / (double)csa->dn_cnt[j];
+         if (csa->up_cnt[j] > 0)
+            t++, psi_up += csa->up_sum[j] / (double)csa->up_cnt[j];
+      }
+      psi_dn = (s == 0 ? 1.0 : psi_dn / (double)s);
+      psi_up = (t == 0 ? 1.0 : psi_up / (double)t);
+      /* build the list of candidates ordered by pseudocost scores */
+      cand = xcalloc(1+n, sizeof(struct cand));
+      nc = 0;
+      for (j = 1; j <= n; j++)
+      {  if (!glp_ios_can_branch(T, j)) continue;
+         beta = T->mip->col[j]->prim;
+         f = beta - floor(beta);
+         d1 = f * (csa->dn_cnt[j] == 0 ? psi_dn :
+            csa->dn_sum[j] / (double)csa->dn_cnt[j]);
+         d2 = (1.0 - f) * (csa->up_cnt[j] == 0 ? psi_up :
+            csa->up_sum[j] / (double)csa->up_cnt[j]);
+         nc++;
+         cand[nc].j = j;
+         cand[nc].score = score(d1, d2);
+      }
+      xassert(nc > 0);
+      qsort(&cand[1], nc, sizeof(struct cand), fcmp);
+      /* prepare strong branching evaluators */
+      nthreads = parm->threads;
+      list = xcalloc(1+nthreads, sizeof(int));
+      E = xcalloc(nthreads, sizeof(SBEVAL));
+      E[0].P = T->mip;
+      E[0].lp = NULL;
+      E[0].it_lim = parm->sb_it_lim;
+      E[0].list = list;
+      E[0].dn = xcalloc(1+nthreads, sizeof(double));
+      E[0].up = xcalloc(1+nthreads, sizeof(double));
+      E[0].nl = 0;
+      E[0].it_cnt = 0;
+      /* nothing has been chosen so far */
+      jjj = 0, sel = 0, best = -1.0, dmax = 0.0, look = cnt = 0;
+      dd_dn = dd_up = 0.0;
+      /* look through the candidates by segments, each of which contains
+         up to nthreads candidates with unreliable pseudocosts */
+      t = 1;
+      while (t <= nc && look < parm->sb_look)
+      {  /* determine the segment cand[t, ..., s-1] */
+         nl = 0;
+         for (s = t; s <= nc; s++)
+         {  j = cand[s].j;
+            if (csa->dn_cnt[j] < parm->rel_lim ||
+                csa->up_cnt[j] < parm->rel_lim)
+            {  if (nl == nthreads || nl == parm->sb_look - look) break;
+               list[++nl] = j;
+            }
+         }
+         /* perform strong branching on unreliable candidates */
+         if (nl > 0)
+         {  E[0].nl = nl;
+            strong_branch(T->mip, E, nthreads);
+            cnt += nl;
+         }
+         /* process candidates of the segment in the original order */
+         for (nl = 0; t < s && look < parm->sb_look; t++)
+         {  j = cand[t].j;
+            beta = T->mip->col[j]->prim;
+            f = beta - floor(beta);
+            if (nl < E[0].nl && list[nl+1] == j)
+            {  /* strong branching has been performed */
+               nl++;
+               d1 = E[0].dn[nl], d2 = E[0].up[nl];
+               if (d1 == DBL_MAX || d2 == DBL_MAX)
+               {  /* one of the branches can be pruned right now */
+                  jjj = j;
+                  sel = (d1 == DBL_MAX ? GLP_DN_BRNCH : GLP_UP_BRNCH);
+                  goto done;
+               }
+               /* degradations are new observations of pseudocosts */
+               csa->dn_cnt[j]++, csa->dn_sum[j] += d1 / f;
+               csa->up_cnt[j]++, csa->up_sum[j] += d2 / (1.0 - f);
+            }
+            else
+            {  /* estimate degradations with reliable pseudocosts (if
+                  rel_lim = 0, they may be uninitialized) */
+               d1 = f * (csa->dn_cnt[j] == 0 ? psi_dn :
+                  csa->dn_sum[j] / (double)csa->dn_cnt[j]);
+               d2 = (1.0 - f) * (csa->up_cnt[j] == 0 ? psi_up :
+                  csa->up_sum[j] / (double)csa->up_cnt[j]);
+            }
+            sc = score(d1, d2);
+            if (best < sc)
+            {  best = sc, jjj = j, look = 0;
+               dmax = (d1 > d2 ? d1 : d2);
+               dd_dn = d1, dd_up = d2;
+               /* continue the search from a subproblem, where
+                  degradation is less than in other one */
+               sel = (d1 <= d2 ? GLP_DN_BRNCH : GLP_UP_BRNCH);
+            }
+            else
+               look++;
+         }
+         E[0].nl = 0;
+         t = s;
+      }
+      if (dmax == 0.0)
+      {  /* no degradation is indicated; choose a variable having most
+            fractional value */
+         jjj = branch_mostf(T, &sel);
+      }
+done: if (parm->msg_lev >= GLP_MSG_DBG)
+      {  xprintf("ios_rel_branch: column %d chosen to branch on; %d ca"
+            "ndidates evaluated by strong branching\n", jjj, cnt);
+         xprintf("ios_rel_branch: estimated degradations are %.9e and "
+            "%.9e\n", dd_dn, dd_up);
+      }
+      T->mip->it_cnt += E[0].it_cnt;
+      if (E[0].lp != NULL) glp_delete_prob(E[0].lp);
+      xfree(E[0].dn);
+      xfree(E[0].up);
+      xfree(E);
+      xfree(list);
+      xfree(cand);
+      *_next = sel;
+      return jjj;
+}
+
 /* eof */
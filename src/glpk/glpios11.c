@@ -43,6 +43,19 @@
 *  to the current subproblem or just discards it. All cuts are assumed
 *  to be locally valid. On exit the local cut pool remains unchanged.
 *
+*  Cuts having the same left-hand side are recognized by hashing, and
+*  only the strongest of them is analyzed. A cut is not added if it is
+*  nearly parallel to some cut already added, i.e. if the cosine of
+*  angle between normals to the cut planes a1 * x = b1 and a2 * x = b2
+*
+*     cos phi = (a1' * a2) / (||a1|| * ||a2||)
+*
+*  exceeds 0.90 [1]. To avoid comparing every pair of cuts, the cuts
+*  added are kept in buckets by their columns, so a candidate is only
+*  compared with cuts having a common column (cuts with disjoint support
+*  are orthogonal), and the dot products are accumulated over common
+*  columns only.
+*
 *  REFERENCES
 *
 *  1. E.Balas, S.Ceria, G.Cornuejols, "Mixed 0-1 Programming by
@@ -64,6 +77,12 @@ struct info
       /* cut efficacy (normalized residual) */
       double deg;
       /* lower bound to objective degradation */
+      double norm;
+      /* Euclidean norm of the vector of cut coefficients */
+      unsigned int hash;
+      /* hash code of the left-hand side; 0 means duplicate cut */
+      int link;
+      /* next cut in the same hash chain */
 };
 
 static int fcmp(const void *arg1, const void *arg2)
@@ -79,15 +98,18 @@ static int fcmp(const void *arg1, const void *arg2)
       return 0;
 }
 
-static double parallel(IOSCUT *a, IOSCUT *b, double work[]);
+static int same_lhs(IOSCUT *a, IOSCUT *b, double work[]);
+
+static int stronger(IOSCUT *a, IOSCUT *b);
 
 void ios_process_cuts(glp_tree *T)
 {     IOSPOOL *pool;
       IOSCUT *cut;
       IOSAIJ *aij;
       struct info *info;
-      int k, kk, max_cuts, len, ret, *ind;
-      double *val, *work;
+      int k, kk, max_cuts, len, ret, nnz, ns, hsize, *ind, *htab,
+         *head, *next, *who, *seen, *sel;
+      double *val, *work, *coef, *dot;
       /* the current subproblem must exist */
       xassert(T->curr != NULL);
       /* the pool must exist and be non-empty */
@@ -104,10 +126,45 @@ void ios_process_cuts(glp_tree *T)
       for (k = 0, cut = pool->head; cut != NULL; cut = cut->next)
          k++, info[k].cut = cut, info[k].flag = 0;
       xassert(k == pool->size);
+      /* find cuts having the same left-hand side; only the strongest
+         of them remains a candidate */
+      for (hsize = 1; hsize < pool->size + pool->size; hsize += hsize);
+      htab = xcalloc(hsize, sizeof(int));
+      for (kk = 0; kk < hsize; kk++) htab[kk] = 0;
+      for (k = 1; k <= pool->size; k++)
+      {  int *ptr;
+         info[k].hash = ios_cut_hash(info[k].cut);
+         for (ptr = &htab[info[k].hash & (hsize-1)]; *ptr != 0;
+            ptr = &info[*ptr].link)
+         {  kk = *ptr;
+            if (info[kk].hash == info[k].hash &&
+                same_lhs(info[kk].cut, info[k].cut, work))
+               break;
+         }
+         if (*ptr == 0)
+         {  /* the left-hand side is new */
+            info[k].link = 0, *ptr = k;
+         }
+         else if (stronger(info[k].cut, info[kk].cut))
+         {  /* cut k replaces cut kk in the hash chain */
+            info[k].link = info[kk].link, *ptr = k;
+            info[kk].hash = 0;
+         }
+         else
+         {  /* cut k is a duplicate */
+            info[k].hash = 0;
+         }
+      }
+      xfree(htab);
       /* estimate efficiency of all cuts in the cut pool */
       for (k = 1; k <= pool->size; k++)
       {  double temp, dy, dz;
          cut = info[k].cut;
+         if (info[k].hash == 0)
+         {  /* duplicate cut is not analyzed */
+            info[k].eff = info[k].deg = 0.0;
+            continue;
+         }
          /* build the vector of cut coefficients and compute its
             Euclidean norm */
          len = 0; temp = 0.0;
@@ -117,6 +174,7 @@ void ios_process_cuts(glp_tree *T)
             temp += aij->val * aij->val;
          }
          if (temp < DBL_EPSILON * DBL_EPSILON) temp = DBL_EPSILON;
+         info[k].norm = sqrt(temp);
          /* transform the cut to express it only through non-basic
             (auxiliary and structural) variables */
          len = glp_transform_row(T->mip, len, ind, val);
@@ -162,6 +220,24 @@ void ios_process_cuts(glp_tree *T)
          as candidates to be added to the current subproblem */
       max_cuts = (T->curr->level == 0 ? 90 : 10);
       if (max_cuts > pool->size) max_cuts = pool->size;
+      /* allocate buckets of cuts added to the current subproblem;
+         bucket j is a list of elements e, where who[e] is the number
+         of cut having column j, and coef[e] is its coefficient */
+      nnz = 0;
+      for (k = 1; k <= max_cuts; k++)
+      {  for (aij = info[k].cut->ptr; aij != NULL; aij = aij->next)
+            nnz++;
+      }
+      head = xcalloc(1+T->n, sizeof(int));
+      for (k = 1; k <= T->n; k++) head[k] = 0;
+      next = xcalloc(1+nnz, sizeof(int));
+      who = xcalloc(1+nnz, sizeof(int));
+      coef = xcalloc(1+nnz, sizeof(double));
+      seen = xcalloc(1+max_cuts, sizeof(int));
+      dot = xcalloc(1+max_cuts, sizeof(double));
+      sel = xcalloc(1+max_cuts, sizeof(int));
+      for (k = 1; k <= max_cuts; k++) seen[k] = 0;
+      nnz = 0;
       /* add cuts to the current subproblem */
 #if 0
       xprintf("*** adding cuts ***\n");
@@ -170,15 +246,30 @@ void ios_process_cuts(glp_tree *T)
       {  int i, len;
          /* if this cut seems to be inefficient, skip it */
          if (info[k].deg < 0.01 && info[k].eff < 0.01) continue;
-         /* if the angle between this cut and every other cut included
+         /* if the angle between this cut and some other cut included
             in the current subproblem is small, skip this cut */
-         for (kk = 1; kk < k; kk++)
-         {  if (info[kk].flag)
-            {  if (parallel(info[k].cut, info[kk].cut, work) > 0.90)
-                  break;
+         ns = 0;
+         for (aij = info[k].cut->ptr; aij != NULL; aij = aij->next)
+         {  for (kk = head[aij->j]; kk != 0; kk = next[kk])
+            {  if (seen[who[kk]] != k)
+               {  seen[who[kk]] = k;
+                  sel[++ns] = who[kk];
+                  dot[who[kk]] = 0.0;
+               }
+               dot[who[kk]] += aij->val * coef[kk];
             }
          }
-         if (kk < k) continue;
+         for (kk = 1; kk <= ns; kk++)
+         {  if (dot[sel[kk]] / (info[k].norm * info[sel[kk]].norm) >
+                0.90) break;
+         }
+         if (kk <= ns) continue;
+         /* put this cut into buckets of its columns */
+         for (aij = info[k].cut->ptr; aij != NULL; aij = aij->next)
+         {  nnz++;
+            who[nnz] = k, coef[nnz] = aij->val;
+            next[nnz] = head[aij->j], head[aij->j] = nnz;
+         }
          /* add this cut to the current subproblem */
 #if 0
          xprintf("eff = %g; deg = %g\n", info[k].eff, info[k].deg);
@@ -197,6 +288,13 @@ void ios_process_cuts(glp_tree *T)
          glp_set_row_bnds(T->mip, i, cut->type, cut->rhs, cut->rhs);
       }
       /* free working arrays */
+      xfree(head);
+      xfree(next);
+      xfree(who);
+      xfree(coef);
+      xfree(seen);
+      xfree(dot);
+      xfree(sel);
       xfree(info);
       xfree(ind);
       xfree(val);
@@ -246,37 +344,59 @@ static double efficacy(glp_tree *T, IOSCUT *cut)
 #endif
 
 /***********************************************************************
-*  Given two cuts a1 * x >= b1 (<= b1) and a2 * x >= b2 (<= b2) the
-*  routine parallel computes the cosine of angle between the cut planes
-*  a1 * x = b1 and a2 * x = b2 (which is the acute angle between two
-*  normals to these planes) in the space of structural variables as
-*  follows:
-*
-*     cos phi = (a1' * a2) / (||a1|| * ||a2||),
-*
-*  where (a1' * a2) is a dot product of vectors of cut coefficients,
-*  ||a1|| and ||a2|| are Euclidean norms of vectors a1 and a2.
-*
-*  Note that requirement cos phi = 0 forces the cuts to be orthogonal,
-*  i.e. with disjoint support, while requirement cos phi <= 0.999 means
-*  only avoiding duplicate (parallel) cuts [1]. */
+*  The routine ios_cut_hash computes a hash code of the left-hand side
+*  of a cut, which does not depend on the order of its coefficients.
+*  Zero code is never returned. */
 
-static double parallel(IOSCUT *a, IOSCUT *b, double work[])
+unsigned int ios_cut_hash(IOSCUT *cut)
 {     IOSAIJ *aij;
-      double s = 0.0, sa = 0.0, sb = 0.0, temp;
-      for (aij = a->ptr; aij != NULL; aij = aij->next)
-      {  work[aij->j] = aij->val;
-         sa += aij->val * aij->val;
+      unsigned int h = cut->type, t;
+      unsigned char *b;
+      int k;
+      for (aij = cut->ptr; aij != NULL; aij = aij->next)
+      {  t = 2166136261U ^ (unsigned int)aij->j;
+         b = (unsigned char *)&aij->val;
+         for (k = 0; k < (int)sizeof(double); k++)
+            t = (t ^ b[k]) * 16777619U;
+         h += t;
       }
+      return h == 0 ? 1 : h;
+}
+
+/***********************************************************************
+*  The routine same_lhs checks if two cuts have the same type and the
+*  same coefficients. The working array work[1+n] should be zero on
+*  entry; it remains zero on exit. */
+
+static int same_lhs(IOSCUT *a, IOSCUT *b, double work[])
+{     IOSAIJ *aij;
+      int len = 0, ret = 1;
+      if (a->type != b->type)
+         return 0;
+      for (aij = a->ptr; aij != NULL; aij = aij->next)
+         len++, work[aij->j] = aij->val;
       for (aij = b->ptr; aij != NULL; aij = aij->next)
-      {  s += work[aij->j] * aij->val;
-         sb += aij->val * aij->val;
+      {  if (work[aij->j] != aij->val) ret = 0;
+         len--;
       }
+      if (len != 0) ret = 0;
       for (aij = a->ptr; aij != NULL; aij = aij->next)
          work[aij->j] = 0.0;
-      temp = sqrt(sa) * sqrt(sb);
-      if (temp < DBL_EPSILON * DBL_EPSILON) temp = DBL_EPSILON;
-      return s / temp;
+      return ret;
+}
+
+/***********************************************************************
+*  The routine stronger checks if cut a having the same left-hand side
+*  as cut b is stronger than the latter. */
+
+static int stronger(IOSCUT *a, IOSCUT *b)
+{     xassert(a->type == b->type);
+      if (a->type == GLP_LO)
+         return a->rhs > b->rhs;
+      else if (a->type == GLP_UP)
+         return a->rhs < b->rhs;
+      else
+         return 0;
 }
 
 /* eof */
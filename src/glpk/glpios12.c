@@ -81,26 +81,205 @@ int ios_choose_node(glp_tree *T)
       return p;
 }
 
+/***********************************************************************
+*  Active subproblems are kept in addressable binary heaps, so the best
+*  subproblem with respect to each selection criterion is available in
+*  constant time, and inserting, removing or re-ordering a subproblem
+*  takes O(log a_cnt) time. Ties are broken by sequential numbers of
+*  subproblems, so the selection is exactly the same as if the active
+*  list were scanned from its head. */
+
+static double heap_key(glp_tree *T, int k, IOSNPD *node)
+{     /* compute key of subproblem in heap[k] (the less the better) */
+      double key;
+      if (k == IOS_BND)
+         key = (T->mip->dir == GLP_MIN ? + node->bound :
+            - node->bound);
+      else if (k == IOS_FEAS)
+         key = (node->up == NULL ? -DBL_MAX : node->up->ii_sum);
+      else
+      {  xassert(k == IOS_PROJ);
+         if (node->up == NULL)
+            key = -DBL_MAX;
+         else
+         {  /* see best_proj */
+            key = node->up->bound + T->proj_deg * node->up->ii_sum;
+            if (T->mip->dir == GLP_MAX) key = - key;
+         }
+      }
+      return key;
+}
+
+static int heap_less(glp_tree *T, int k, IOSNPD *a, IOSNPD *b)
+{     /* check if subproblem a precedes subproblem b in heap[k] */
+      double key_a = heap_key(T, k, a), key_b = heap_key(T, k, b);
+      if (key_a < key_b) return 1;
+      if (key_a > key_b) return 0;
+      return a->seq < b->seq;
+}
+
+static void sift_up(glp_tree *T, int k, int i)
+{     /* move i-th subproblem of heap[k] towards the top */
+      IOSHEAP *heap = &T->heap[k];
+      IOSNPD *node = heap->node[i];
+      while (i > 1 && heap_less(T, k, node, heap->node[i / 2]))
+      {  heap->node[i] = heap->node[i / 2];
+         heap->node[i]->pos[k] = i;
+         i /= 2;
+      }
+      heap->node[i] = node;
+      node->pos[k] = i;
+      return;
+}
+
+static void sift_down(glp_tree *T, int k, int i)
+{     /* move i-th subproblem of heap[k] towards the bottom */
+      IOSHEAP *heap = &T->heap[k];
+      IOSNPD *node = heap->node[i];
+      int c;
+      for (;;)
+      {  c = i + i;
+         if (c > heap->size) break;
+         if (c < heap->size &&
+             heap_less(T, k, heap->node[c+1], heap->node[c])) c++;
+         if (!heap_less(T, k, heap->node[c], node)) break;
+         heap->node[i] = heap->node[c];
+         heap->node[i]->pos[k] = i;
+         i = c;
+      }
+      heap->node[i] = node;
+      node->pos[k] = i;
+      return;
+}
+
+static void heap_ins(glp_tree *T, int k, IOSNPD *node)
+{     /* insert subproblem into heap[k] */
+      IOSHEAP *heap = &T->heap[k];
+      if (heap->size == heap->max)
+      {  /* enlarge the array */
+         int max = heap->max;
+         IOSNPD **save = heap->node;
+         heap->max = (max == 0 ? 20 : max + max);
+         xassert(heap->max > max);
+         heap->node = xcalloc(1+heap->max, sizeof(IOSNPD *));
+         if (save != NULL)
+         {  memcpy(&heap->node[1], &save[1], max * sizeof(IOSNPD *));
+            xfree(save);
+         }
+      }
+      heap->node[++(heap->size)] = node;
+      sift_up(T, k, heap->size);
+      return;
+}
+
+static void heap_rem(glp_tree *T, int k, IOSNPD *node)
+{     /* remove subproblem from heap[k] */
+      IOSHEAP *heap = &T->heap[k];
+      IOSNPD *last;
+      int i = node->pos[k];
+      xassert(1 <= i && i <= heap->size && heap->node[i] == node);
+      node->pos[k] = 0;
+      if (i < heap->size)
+      {  /* move the last subproblem to the vacant position */
+         last = heap->node[heap->size--];
+         heap->node[i] = last;
+         last->pos[k] = i;
+         sift_up(T, k, i);
+         sift_down(T, k, last->pos[k]);
+      }
+      else
+         heap->size--;
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_heap_add - add active subproblem to the heaps
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_heap_add(glp_tree *T, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_heap_add adds a new subproblem, which has been just
+*  appended to the active list, to the heaps of active subproblems. */
+
+void ios_heap_add(glp_tree *T, IOSNPD *node)
+{     node->pos[IOS_BND] = node->pos[IOS_FEAS] = node->pos[IOS_PROJ] = 0;
+      heap_ins(T, IOS_BND, node);
+      if (T->parm->bt_tech == GLP_BT_BPH)
+      {  heap_ins(T, IOS_FEAS, node);
+         if (T->heap[IOS_PROJ].size > 0)
+            heap_ins(T, IOS_PROJ, node);
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_heap_del - remove active subproblem from the heaps
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_heap_del(glp_tree *T, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_heap_del removes a subproblem, which is being removed
+*  from the active list, from the heaps of active subproblems. */
+
+void ios_heap_del(glp_tree *T, IOSNPD *node)
+{     int k;
+      for (k = 0; k < 3; k++)
+         if (node->pos[k] != 0) heap_rem(T, k, node);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_heap_update - restore the heaps after changing local bound
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_heap_update(glp_tree *T, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_heap_update should be called each time the local
+*  bound of an active subproblem has been changed. (Other keys depend
+*  only on the parent subproblem, which is inactive and therefore does
+*  not change.) */
+
+void ios_heap_update(glp_tree *T, IOSNPD *node)
+{     int i = node->pos[IOS_BND];
+      xassert(i != 0);
+      sift_up(T, IOS_BND, i);
+      sift_down(T, IOS_BND, node->pos[IOS_BND]);
+      return;
+}
+
 static int most_feas(glp_tree *T)
 {     /* select subproblem whose parent has minimal sum of integer
          infeasibilities */
-      IOSNPD *node;
-      int p;
-      double best;
-      p = 0, best = DBL_MAX;
-      for (node = T->head; node != NULL; node = node->next)
-      {  xassert(node->up != NULL);
-         if (best > node->up->ii_sum)
-            p = node->p, best = node->up->ii_sum;
-      }
-      return p;
+      IOSHEAP *heap = &T->heap[IOS_FEAS];
+      xassert(heap->size > 0);
+      xassert(heap->node[1]->up != NULL);
+      return heap->node[1]->p;
 }
 
 static int best_proj(glp_tree *T)
 {     /* select subproblem using the best projection heuristic */
-      IOSNPD *root, *node;
-      int p;
-      double best, deg, obj;
+      IOSNPD *root;
+      IOSHEAP *heap = &T->heap[IOS_PROJ];
+      int i;
+      double deg;
       /* the global bound must exist */
       xassert(T->mip->mip_stat == GLP_FEAS);
       /* obtain pointer to the root node, which must exist */
@@ -110,66 +289,66 @@ static int best_proj(glp_tree *T)
          of the sum of integer infeasibilities */
       xassert(root->ii_sum > 0.0);
       deg = (T->mip->mip_obj - root->bound) / root->ii_sum;
-      /* nothing has been selected so far */
-      p = 0, best = DBL_MAX;
-      /* walk through the list of active subproblems */
-      for (node = T->head; node != NULL; node = node->next)
-      {  xassert(node->up != NULL);
-         /* obj estimates optimal objective value if the sum of integer
-            infeasibilities were zero */
-         obj = node->up->bound + deg * node->up->ii_sum;
-         if (T->mip->dir == GLP_MAX) obj = - obj;
-         /* select the subproblem which has the best estimated optimal
-            objective value */
-         if (best > obj) p = node->p, best = obj;
+      /* obj = up->bound + deg * up->ii_sum estimates optimal objective
+         value if the sum of integer infeasibilities were zero; since
+         deg changes only when a better integer feasible solution has
+         been found, the heap ordered by obj is rebuilt from scratch
+         only in that case */
+      if (heap->size == 0 || T->proj_deg != deg)
+      {  IOSHEAP *feas = &T->heap[IOS_FEAS];
+         xassert(feas->size > 0);
+         if (heap->max < feas->size)
+         {  if (heap->node != NULL) xfree(heap->node);
+            heap->max = feas->max;
+            heap->node = xcalloc(1+heap->max, sizeof(IOSNPD *));
+         }
+         T->proj_deg = deg;
+         heap->size = feas->size;
+         for (i = 1; i <= heap->size; i++)
+         {  heap->node[i] = feas->node[i];
+            heap->node[i]->pos[IOS_PROJ] = i;
+         }
+         for (i = heap->size / 2; i >= 1; i--)
+            sift_down(T, IOS_PROJ, i);
       }
-      return p;
+      xassert(heap->node[1]->up != NULL);
+      return heap->node[1]->p;
+}
+
+static void scan_band(glp_tree *T, int i, double lim, IOSNPD **best)
+{     /* walk through subproblems in the subtree of heap[IOS_BND] rooted
+         at i-th position whose keys do not exceed lim */
+      IOSHEAP *heap = &T->heap[IOS_BND];
+      IOSNPD *node;
+      while (i <= heap->size)
+      {  node = heap->node[i];
+         if (heap_key(T, IOS_BND, node) > lim) break;
+         xassert(node->up != NULL);
+         if (*best == NULL ||
+             (*best)->up->ii_sum > node->up->ii_sum ||
+             ((*best)->up->ii_sum == node->up->ii_sum &&
+              (*best)->seq > node->seq)) *best = node;
+         scan_band(T, i + i, lim, best);
+         i = i + i + 1;
+      }
+      return;
 }
 
 static int best_node(glp_tree *T)
 {     /* select subproblem with best local bound */
-      IOSNPD *node, *best = NULL;
+      IOSHEAP *heap = &T->heap[IOS_BND];
+      IOSNPD *best = NULL;
       double bound, eps;
-      switch (T->mip->dir)
-      {  case GLP_MIN:
-            bound = +DBL_MAX;
-            for (node = T->head; node != NULL; node = node->next)
-               if (bound > node->bound) bound = node->bound;
-            xassert(bound != +DBL_MAX);
-            eps = 1e-10 * (1.0 + fabs(bound));
-            for (node = T->head; node != NULL; node = node->next)
-            {  if (node->bound <= bound + eps)
-               {  xassert(node->up != NULL);
-                  if (best == NULL ||
-#if 1
-                  best->up->ii_sum > node->up->ii_sum) best = node;
-#else
-                  best->lp_obj > node->lp_obj) best = node;
-#endif
-               }
-            }
-            break;
-         case GLP_MAX:
-            bound = -DBL_MAX;
-            for (node = T->head; node != NULL; node = node->next)
-               if (bound < node->bound) bound = node->bound;
-            xassert(bound != -DBL_MAX);
-            eps = 1e-10 * (1.0 + fabs(bound));
-            for (node = T->head; node != NULL; node = node->next)
-            {  if (node->bound >= bound - eps)
-               {  xassert(node->up != NULL);
-                  if (best == NULL ||
-#if 1
-                  best->up->ii_sum > node->up->ii_sum) best = node;
-#else
-                  best->lp_obj < node->lp_obj) best = node;
-#endif
-               }
-            }
-            break;
-         default:
-            xassert(T != T);
-      }
+      xassert(heap->size > 0);
+      /* the best local bound is the key of the top subproblem (in the
+         minimization sense) */
+      bound = heap_key(T, IOS_BND, heap->node[1]);
+      xassert(bound != +DBL_MAX);
+      eps = 1e-10 * (1.0 + fabs(bound));
+      /* among subproblems whose local bounds are within eps from the
+         best one select the subproblem whose parent has minimal sum of
+         integer infeasibilities */
+      scan_band(T, 1, bound + eps, &best);
       xassert(best != NULL);
       return best->p;
 }
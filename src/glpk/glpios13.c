@@ -0,0 +1,1094 @@
+/* glpios13.c (parallel branch-and-bound search) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include <pthread.h>
+#include <time.h>
+#include "glpenv.h"
+#include "glpios.h"
+
+/***********************************************************************
+*  The parallel search continues the branch-and-bound method after the
+*  root subproblem has been completely processed and branched by the
+*  serial driver (preprocessing, cut generation, heuristics).
+*
+*  The branch-and-bound tree itself is the pool of active subproblems
+*  shared by the worker threads. It is protected by a lock, and a worker
+*  holding the lock selects a subproblem with ios_choose_node as the
+*  serial driver does, removes it from the active list and the heaps
+*  (so other workers cannot select it), and obtains bounds of columns
+*  in the subproblem. Then the lock is released and the worker solves
+*  LP relaxation of the subproblem on its private copy of the root
+*  subproblem, checks integrality, and chooses a variable to branch on.
+*  Finally, the worker takes the lock again and stores the results in
+*  the tree: either the subproblem is deleted (fathomed), or its child
+*  subproblems are created with ios_clone_node. Like the serial driver
+*  the worker continues with a child suggested by the branching
+*  heuristic, if any, keeping it for itself; otherwise it selects a
+*  subproblem from the active list.
+*
+*  The tree is allocated in the environment of the calling thread, so a
+*  worker uses that environment while it holds the lock, and its own
+*  environment otherwise.
+*
+*  For branching each worker uses a private tree object, which refers
+*  to the private copy of the problem and has only components used by
+*  the branching routines (see glpios09.c), so all branching techniques
+*  are available. Pseudocosts collected on processing the root
+*  subproblem are copied to each worker, which then updates its own
+*  copy. Cuts added to the root subproblem are kept in the private
+*  copies, unless cut sharing is disabled, in which case the workers
+*  solve weaker LP relaxations without them.
+*
+*  The objective value of the incumbent is published through an atomic
+*  variable, so a worker can prune a subproblem and terminate the dual
+*  simplex without locking. New integer feasible solutions are stored
+*  and hopeless subproblems are pruned under the lock.
+*
+*  The calling thread does not process subproblems. It waits for the
+*  workers to finish, displays progress of the search, and checks the
+*  time limit and termination requests, so the terminal output and the
+*  callback routine stop_fn are used only in the calling thread.
+*
+*  In deterministic mode the search proceeds in rounds. At the start of
+*  a round each worker, in the order of workers, is given a subproblem
+*  (unless it keeps a child from the previous round), and the incumbent
+*  value used to prune subproblems is fixed for the round. When all the
+*  workers have processed their subproblems, the results are stored in
+*  the tree in the order of workers. So the search does not depend on
+*  thread timing and two runs with the same number of threads give the
+*  same result. */
+
+#define PAR_WAIT 100
+/* maximal time (in milliseconds) the calling thread waits for events
+   before checking the time limit and termination requests */
+
+typedef struct PARCLD PARCLD;
+typedef struct PARWRK PARWRK;
+typedef struct PARSCH PARSCH;
+
+struct PARCLD
+{     /* child subproblem to be created */
+      int type;
+      double lb, ub;
+      /* new type and bounds of the branching column */
+      double lp_obj;
+      /* objective value estimated with the dual ratio test */
+      double bound;
+      /* local bound of the child subproblem */
+};
+
+struct PARWRK
+{     /* worker thread */
+      PARSCH *S;
+      /* search the worker belongs to */
+      int id;
+      /* worker number, 0 <= id < nthreads */
+      pthread_t tid;
+      /* worker thread */
+      void *env;
+      /* the worker's own environment saved while it holds the lock */
+      int cnt;
+      /* number of subproblems processed by the worker */
+      /*--------------------------------------------------------------*/
+      /* subproblem held by the worker */
+      int p;
+      /* reference number of the subproblem, 0 if none */
+      int solved;
+      /* set if the subproblem has been processed, but the results are
+         not stored in the tree yet */
+      double z_cut;
+      /* incumbent value (for minimization) used to prune the
+         subproblem, +DBL_MAX if none */
+      unsigned char *type; /* unsigned char type[1+n]; */
+      double *lb, *ub; /* double lb[1+n], ub[1+n]; */
+      /* types and bounds of columns in the subproblem */
+      unsigned char *fixed; /* unsigned char fixed[1+n]; */
+      /* fixed[j] is set if bounds of column j have been changed while
+         processing the subproblem, because one branch was hopeless */
+      IOSNPD curr, up;
+      /* descriptors of the subproblem and its parent used by the
+         private tree; only components used by the branching routines
+         are valid */
+      /*--------------------------------------------------------------*/
+      /* results of processing the subproblem */
+      int fail;
+      /* set if LP relaxation could not be solved */
+      int br_j;
+      /* branching column, 0 if the subproblem has been fathomed */
+      int nc;
+      /* number of child subproblems to be created (0 or 2) */
+      PARCLD cld[2];
+      /* child subproblems */
+      int next;
+      /* child subproblem to be processed next by the worker, 1 <= next
+         <= nc, or 0 if a subproblem should be selected from the active
+         list */
+      int found;
+      /* set if LP relaxation has integer feasible optimal solution */
+      double *x; /* double x[1+n]; */
+      double z;
+      /* that solution and its objective value */
+      int it_cnt;
+      /* number of simplex iterations not accounted yet */
+      int *ind, *chg_type; /* int ind[1+n], chg_type[1+n]; */
+      double *chg_lb, *chg_ub; /* double chg_lb[1+n], chg_ub[1+n]; */
+      /* working arrays used to save changes of child subproblems */
+      unsigned char *row_type; /* unsigned char row_type[1+m]; */
+      double *row_lb, *row_ub; /* double row_lb[1+m], row_ub[1+m]; */
+      /* types and bounds of rows in the root subproblem, which are
+         restored after preprocessing */
+      /*--------------------------------------------------------------*/
+      /* private data; allocated in the worker's environment */
+      glp_prob *lp;
+      /* private copy of the root subproblem */
+      glp_iocp parm;
+      /* control parameters used by the private tree */
+      glp_tree tree;
+      /* private tree */
+};
+
+struct PARSCH
+{     /* parallel search */
+      glp_tree *T;
+      /* branch-and-bound tree */
+      void *env;
+      /* environment of the calling thread, to which the tree belongs */
+      int n;
+      /* number of columns */
+      double dir;
+      /* +1 for minimization, -1 for maximization */
+      int det;
+      /* deterministic mode flag */
+      int nthreads;
+      /* number of workers */
+      PARWRK *wrk; /* PARWRK wrk[nthreads]; */
+      /* workers */
+      pthread_mutex_t lock;
+      /* lock protecting the tree and all the fields below */
+      pthread_cond_t cond;
+      /* condition the workers wait on for subproblems to appear or for
+         the end of the round (deterministic mode) */
+      pthread_cond_t wake;
+      /* condition the calling thread waits on */
+      double incumb;
+      /* objective value of the incumbent (for minimization), +DBL_MAX
+         if not found yet; it is written under the lock, but may be
+         read atomically without locking */
+      int busy;
+      /* number of workers holding subproblems */
+      int idle;
+      /* number of workers waiting for subproblems */
+      int nodes;
+      /* number of subproblems processed */
+      int bingo;
+      /* set if a better integer feasible solution has been found, but
+         not displayed yet */
+      int quit;
+      /* set when the search is finished */
+      int ret;
+      /* code returned by the search */
+      /*--------------------------------------------------------------*/
+      /* deterministic mode */
+      int gen, arrived;
+      /* round number and number of workers finished the round */
+};
+
+static double get_incumb(PARSCH *S)
+{     /* obtain the incumbent objective value */
+      double z;
+#ifdef HAVE_ATOMIC
+      __atomic_load(&S->incumb, &z, __ATOMIC_ACQUIRE);
+#else
+      pthread_mutex_lock(&S->lock);
+      z = S->incumb;
+      pthread_mutex_unlock(&S->lock);
+#endif
+      return z;
+}
+
+static void update_incumb(PARSCH *S)
+{     /* exchange the incumbent objective value with concurrent solvers
+         and publish it; must be called under the lock */
+      glp_tree *T = S->T;
+      glp_prob *mip = T->mip;
+      double z;
+      if (T->parm->inc_fn != NULL)
+      {  z = T->parm->inc_fn(T->parm->inc_info,
+            mip->mip_stat == GLP_FEAS ? mip->mip_obj :
+            S->dir * DBL_MAX);
+         if (S->dir * z < S->dir * T->ext_obj)
+            T->ext_obj = z;
+      }
+      z = (ios_incumb(T, &z) ? S->dir * z : +DBL_MAX);
+#ifdef HAVE_ATOMIC
+      __atomic_store(&S->incumb, &z, __ATOMIC_RELEASE);
+#else
+      S->incumb = z;
+#endif
+      return;
+}
+
+/**********************************************************************/
+/* shared tree; all routines in this section must be called under the
+   lock */
+
+static void lock_tree(PARWRK *W)
+{     /* take the lock and switch to the environment of the tree */
+      pthread_mutex_lock(&W->S->lock);
+      W->env = tls_get_ptr();
+      tls_set_ptr(W->S->env);
+      return;
+}
+
+static void unlock_tree(PARWRK *W)
+{     /* switch to the worker's environment and release the lock */
+      tls_set_ptr(W->env);
+      pthread_mutex_unlock(&W->S->lock);
+      return;
+}
+
+static void take_node(PARWRK *W, int p)
+{     /* remove active subproblem from the active list and the heaps,
+         so it cannot be selected by other workers, and obtain bounds of
+         columns in it; the subproblem is still counted in T->a_cnt as
+         the current one is in the serial driver */
+      PARSCH *S = W->S;
+      glp_tree *T = S->T;
+      IOSNPD *node = T->slot[p].node;
+      xassert(W->p == 0);
+      xassert(node != NULL && node->count == 0 && node->up != NULL);
+      if (node->prev == NULL)
+         T->head = node->next;
+      else
+         node->prev->next = node->next;
+      if (node->next == NULL)
+         T->tail = node->prev;
+      else
+         node->next->prev = node->prev;
+      node->prev = node->next = NULL;
+      ios_heap_del(T, node);
+      ios_node_bnds(T, node, W->type, W->lb, W->ub);
+      W->p = p;
+      W->solved = 0;
+      W->curr.level = node->level;
+      W->curr.lp_obj = node->lp_obj;
+      W->curr.bound = node->bound;
+      W->up.br_var = node->up->br_var;
+      W->up.br_val = node->up->br_val;
+      W->up.lp_obj = node->up->lp_obj;
+      W->z_cut = S->incumb;
+      S->busy++;
+      return;
+}
+
+static IOSNPD *put_node(PARWRK *W)
+{     /* return subproblem held by the worker to the active list */
+      PARSCH *S = W->S;
+      glp_tree *T = S->T;
+      IOSNPD *node = T->slot[W->p].node;
+      xassert(node != NULL);
+      node->prev = T->tail;
+      node->next = NULL;
+      if (T->head == NULL)
+         T->head = node;
+      else
+         T->tail->next = node;
+      T->tail = node;
+      W->p = 0;
+      S->busy--;
+      return node;
+}
+
+static void release_node(PARWRK *W)
+{     /* return unprocessed subproblem to the active list and the heaps
+         on terminating the search */
+      glp_tree *T = W->S->T;
+      if (W->p != 0)
+         ios_heap_add(T, put_node(W));
+      return;
+}
+
+static void show_held(PARSCH *S, int bingo)
+{     /* display progress of the search; the subproblems held by the
+         workers are temporarily put to the heaps, so the best bound is
+         correct */
+      glp_tree *T = S->T;
+      int k;
+      for (k = 0; k < S->nthreads; k++)
+      {  if (S->wrk[k].p != 0)
+            ios_heap_add(T, T->slot[S->wrk[k].p].node);
+      }
+      ios_show_progress(T, bingo);
+      for (k = 0; k < S->nthreads; k++)
+      {  if (S->wrk[k].p != 0)
+            ios_heap_del(T, T->slot[S->wrk[k].p].node);
+      }
+      return;
+}
+
+static int gap_reached(PARSCH *S)
+{     /* check if the relative gap tolerance has been reached */
+      glp_tree *T = S->T;
+      int k, p;
+      double best_mip, best_bnd, bound;
+      if (T->parm->mip_gap <= 0.0 || !ios_incumb(T, &best_mip))
+         return 0;
+      best_bnd = +DBL_MAX;
+      p = ios_best_node(T);
+      if (p != 0)
+         best_bnd = S->dir * T->slot[p].node->bound;
+      for (k = 0; k < S->nthreads; k++)
+      {  p = S->wrk[k].p;
+         if (p == 0) continue;
+         bound = S->dir * T->slot[p].node->bound;
+         if (best_bnd > bound) best_bnd = bound;
+      }
+      if (best_bnd == +DBL_MAX)
+         return 1;
+      return fabs(best_mip - S->dir * best_bnd) /
+         (fabs(best_mip) + DBL_EPSILON) <= T->parm->mip_gap;
+}
+
+static void store_sol(PARWRK *W)
+{     /* store integer feasible solution found by the worker, if it is
+         better than the incumbent (as record_solution in glpios03.c
+         does) */
+      PARSCH *S = W->S;
+      glp_tree *T = S->T;
+      glp_prob *mip = T->mip;
+      GLPAIJ *aij;
+      int i, j;
+      double sum;
+      if (mip->mip_stat == GLP_FEAS &&
+          S->dir * W->z >= S->dir * mip->mip_obj)
+         return;
+      mip->mip_stat = GLP_FEAS;
+      mip->mip_obj = W->z;
+      for (j = 1; j <= S->n; j++)
+         mip->col[j]->mipx = W->x[j];
+      for (i = 1; i <= mip->m; i++)
+      {  sum = 0.0;
+         for (aij = mip->row[i]->ptr; aij != NULL; aij = aij->r_next)
+            sum += aij->val * aij->col->mipx;
+         mip->row[i]->mipx = sum;
+      }
+      T->sol_cnt++;
+      ios_process_sol(T);
+      S->bingo = 1;
+      return;
+}
+
+static void store_node(PARWRK *W)
+{     /* store results of processing the subproblem in the tree */
+      PARSCH *S = W->S;
+      glp_tree *T = S->T;
+      IOSNPD *node;
+      int j, k, len, p = W->p, ref[1+2];
+      xassert(p != 0 && W->solved);
+      W->solved = 0;
+      W->cnt++, S->nodes++;
+      T->mip->it_cnt += W->it_cnt, W->it_cnt = 0;
+      if (W->fail)
+      {  /* the search cannot be continued */
+         release_node(W);
+         if (!S->quit) S->quit = 1, S->ret = GLP_EFAIL;
+         return;
+      }
+      if (W->found)
+         store_sol(W);
+      node = put_node(W);
+      if (W->nc == 0)
+      {  /* the subproblem has been fathomed */
+         ios_delete_node(T, p);
+      }
+      else
+      {  /* create child subproblems as branch_on in glpios03.c does;
+            besides the branching column each child inherits bounds of
+            columns changed in the subproblem */
+         node->lp_obj = W->curr.lp_obj;
+         node->bound = W->curr.bound;
+         node->ii_cnt = W->curr.ii_cnt;
+         node->ii_sum = W->curr.ii_sum;
+         node->br_var = W->br_j;
+         node->br_val = W->lp->col[W->br_j]->prim;
+         ios_clone_node(T, p, W->nc, ref);
+         for (k = 1; k <= W->nc; k++)
+         {  PARCLD *cld = &W->cld[k-1];
+            node = T->slot[ref[k]].node;
+            len = 0;
+            for (j = 1; j <= S->n; j++)
+            {  if (j == W->br_j)
+               {  len++;
+                  W->chg_type[len] = cld->type;
+                  W->chg_lb[len] = cld->lb, W->chg_ub[len] = cld->ub;
+               }
+               else if (W->fixed[j])
+               {  len++;
+                  W->chg_type[len] = W->type[j];
+                  W->chg_lb[len] = W->lb[j], W->chg_ub[len] = W->ub[j];
+               }
+               else
+                  continue;
+               W->ind[len] = T->root_m + j;
+            }
+            ios_bnds_chg(T, node, len, W->ind, W->chg_type, W->chg_lb,
+               W->chg_ub);
+            node->lp_obj = cld->lp_obj;
+            node->bound = cld->bound;
+            ios_heap_update(T, node);
+         }
+         /* continue with the suggested child, if any */
+         if (W->next != 0)
+            take_node(W, ref[W->next]);
+      }
+      update_incumb(S);
+      if (W->found || T->parm->inc_fn != NULL)
+         ios_cleanup_tree(T);
+      if (S->quit) return;
+      if (gap_reached(S))
+         S->quit = 1, S->ret = GLP_EMIPGAP;
+      return;
+}
+
+static void finish(PARSCH *S, int ret)
+{     /* terminate the search */
+      if (!S->quit) S->quit = 1, S->ret = ret;
+      pthread_cond_broadcast(&S->cond);
+      pthread_cond_signal(&S->wake);
+      return;
+}
+
+/**********************************************************************/
+/* processing subproblem; the routines in this section are called by
+   the worker without locking */
+
+static void set_children(PARWRK *W, int j, int sel)
+{     /* determine child subproblems created by branching on column j
+         (as branch_on in glpios03.c does) */
+      PARSCH *S = W->S;
+      glp_tree *tree = &W->tree;
+      GLPCOL *col = W->lp->col[j];
+      PARCLD cld[2];
+      int k, bad[2];
+      double beta = col->prim, dn_lp, up_lp;
+      xassert(tree->non_int[j]);
+      cld[0].lb = col->lb, cld[0].ub = floor(beta);
+      cld[1].lb = ceil(beta), cld[1].ub = col->ub;
+      switch (col->type)
+      {  case GLP_FR:
+            cld[0].type = GLP_UP, cld[1].type = GLP_LO;
+            break;
+         case GLP_LO:
+            cld[0].type = (col->lb == cld[0].ub ? GLP_FX : GLP_DB);
+            cld[1].type = GLP_LO;
+            break;
+         case GLP_UP:
+            cld[0].type = GLP_UP;
+            cld[1].type = (cld[1].lb == col->ub ? GLP_FX : GLP_DB);
+            break;
+         case GLP_DB:
+            cld[0].type = (col->lb == cld[0].ub ? GLP_FX : GLP_DB);
+            cld[1].type = (cld[1].lb == col->ub ? GLP_FX : GLP_DB);
+            break;
+         default:
+            xassert(col != col);
+      }
+      /* compute local bounds for both branches */
+      ios_eval_degrad(tree, j, &dn_lp, &up_lp);
+      cld[0].lp_obj = dn_lp, cld[1].lp_obj = up_lp;
+      for (k = 0; k <= 1; k++)
+      {  cld[k].bound = ios_round_bound(tree, cld[k].lp_obj);
+         if (S->dir * cld[k].bound < S->dir * W->curr.bound)
+            cld[k].bound = W->curr.bound;
+         bad[k] = !ios_is_hopeful(tree, cld[k].bound);
+      }
+      /* hopeless branches are not created */
+      W->br_j = j, W->nc = 0, W->next = 0;
+      for (k = 0; k <= 1; k++)
+      {  if (bad[k]) continue;
+         W->cld[W->nc++] = cld[k];
+         if (sel == (k == 0 ? GLP_DN_BRNCH : GLP_UP_BRNCH))
+            W->next = W->nc;
+      }
+      if (W->nc == 0) W->br_j = 0;
+      return;
+}
+
+static void change_bnds(PARWRK *W, int j, int type, double lb,
+      double ub)
+{     /* change type and bounds of column j in the subproblem */
+      W->type[j] = (unsigned char)type;
+      W->lb[j] = lb, W->ub[j] = ub;
+      W->fixed[j] = 1;
+      return;
+}
+
+static int preprocess(PARWRK *W)
+{     /* perform basic preprocessing of the subproblem (see the routine
+         ios_preprocess_node); returns non-zero if the subproblem is
+         infeasible */
+      glp_prob *lp = W->lp;
+      int i, j, ret;
+      ret = ios_preprocess_node(&W->tree, 10);
+      /* relaxed row bounds are valid only for the subproblem, so they
+         are restored */
+      for (i = 1; i <= lp->m; i++)
+      {  GLPROW *row = lp->row[i];
+         if (row->type != W->row_type[i] || row->lb != W->row_lb[i] ||
+             row->ub != W->row_ub[i])
+            glp_set_row_bnds(lp, i, W->row_type[i], W->row_lb[i],
+               W->row_ub[i]);
+      }
+      if (ret) return ret;
+      /* tightened column bounds are kept for the child subproblems */
+      for (j = 1; j <= lp->n; j++)
+      {  GLPCOL *col = lp->col[j];
+         if (col->type != W->type[j] || col->lb != W->lb[j] ||
+             col->ub != W->ub[j])
+            change_bnds(W, j, col->type, col->lb, col->ub);
+      }
+      return 0;
+}
+
+static void fix_by_red_cost(PARWRK *W)
+{     /* fix non-basic integer columns by reduced costs (as the routine
+         fix_by_red_cost in glpios03.c does) */
+      PARSCH *S = W->S;
+      glp_prob *lp = W->lp;
+      int j;
+      double dj;
+      for (j = 1; j <= S->n; j++)
+      {  GLPCOL *col = lp->col[j];
+         if (col->kind != GLP_IV) continue;
+         /* reduced cost for minimization */
+         dj = S->dir * col->dual;
+         if (col->stat == GLP_NL)
+         {  if (dj < 0.0) dj = 0.0;
+            if (!ios_is_hopeful(&W->tree, lp->obj_val + S->dir * dj))
+            {  glp_set_col_bnds(lp, j, GLP_FX, col->lb, col->lb);
+               change_bnds(W, j, GLP_FX, col->lb, col->lb);
+            }
+         }
+         else if (col->stat == GLP_NU)
+         {  if (dj > 0.0) dj = 0.0;
+            if (!ios_is_hopeful(&W->tree, lp->obj_val - S->dir * dj))
+            {  glp_set_col_bnds(lp, j, GLP_FX, col->ub, col->ub);
+               change_bnds(W, j, GLP_FX, col->ub, col->ub);
+            }
+         }
+      }
+      return;
+}
+
+static void round_heur(PARWRK *W)
+{     /* try to find integer feasible solution by simple rounding (as
+         the routine round_heur in glpios03.c does); the solution, if
+         better than the incumbent, is stored in x and z */
+      PARSCH *S = W->S;
+      glp_prob *lp = W->lp;
+      int i, j, type;
+      double sum, z;
+      GLPAIJ *aij;
+      z = lp->c0;
+      for (j = 1; j <= S->n; j++)
+      {  GLPCOL *col = lp->col[j];
+         if (col->kind == GLP_IV)
+            W->x[j] = floor(col->prim + 0.5);
+         else if (col->type == GLP_FX)
+            W->x[j] = col->prim;
+         else
+            return;
+         z += col->coef * W->x[j];
+      }
+      if (S->dir * z >= W->z_cut)
+         return;
+      /* check that no original constraints are violated */
+      for (i = 1; i <= S->T->orig_m; i++)
+      {  type = S->T->orig_type[i];
+         if (type == GLP_FR) continue;
+         sum = 0.0;
+         for (aij = lp->row[i]->ptr; aij != NULL; aij = aij->r_next)
+            sum += aij->val * W->x[aij->col->j];
+         if (type == GLP_LO || type == GLP_DB || type == GLP_FX)
+         {  if (sum < S->T->orig_lb[i] - 1e-9) return;
+         }
+         if (type == GLP_UP || type == GLP_DB || type == GLP_FX)
+         {  if (sum > S->T->orig_ub[i] + 1e-9) return;
+         }
+      }
+      W->found = 1;
+      W->z = z;
+      /* the solution is used to prune the subproblem */
+      W->z_cut = S->dir * z;
+      W->tree.ext_obj = z;
+      return;
+}
+
+static void solve_node(PARWRK *W)
+{     /* process subproblem held by the worker */
+      PARSCH *S = W->S;
+      glp_tree *tree = &W->tree;
+      glp_prob *lp = W->lp;
+      glp_smcp smcp;
+      int j, sel, ret, it_cnt;
+      double obj, bound;
+      W->fail = W->found = 0;
+      memset(W->fixed, 0, 1+S->n);
+loop: W->br_j = W->nc = W->next = 0;
+      /* in deterministic mode the incumbent value is fixed for the
+         round */
+      if (!S->det)
+      {  obj = get_incumb(S);
+         if (W->z_cut > obj) W->z_cut = obj;
+      }
+      tree->ext_obj = S->dir * W->z_cut;
+      if (!ios_is_hopeful(tree, W->curr.bound))
+         goto done;
+      /* set bounds of columns in the private copy */
+      for (j = 1; j <= S->n; j++)
+      {  GLPCOL *col = lp->col[j];
+         if (col->type != W->type[j] || col->lb != W->lb[j] ||
+             col->ub != W->ub[j])
+            glp_set_col_bnds(lp, j, W->type[j], W->lb[j], W->ub[j]);
+      }
+      if (W->parm.pp_tech == GLP_PP_ALL && preprocess(W))
+         goto done;
+      /* re-optimize LP relaxation starting from the basis of the
+         subproblem processed last (see ios_solve_node) */
+      glp_init_smcp(&smcp);
+      smcp.msg_lev = GLP_MSG_OFF;
+      smcp.meth = GLP_DUALP;
+      if (ios_cutoff(tree, &obj))
+      {  if (lp->dir == GLP_MIN)
+            smcp.obj_ul = obj;
+         else
+            smcp.obj_ll = obj;
+      }
+      it_cnt = lp->it_cnt;
+      ret = glp_simplex(lp, &smcp);
+      W->it_cnt += lp->it_cnt - it_cnt;
+      if (!(ret == 0 || ret == GLP_EOBJLL || ret == GLP_EOBJUL) ||
+          lp->dbs_stat == GLP_NOFEAS)
+      {  W->fail = 1;
+         goto done;
+      }
+      /* LP relaxation has no primal feasible solution, or no solution
+         better than the incumbent */
+      if (!(lp->pbs_stat == GLP_FEAS && lp->dbs_stat == GLP_FEAS))
+         goto done;
+      W->curr.lp_obj = lp->obj_val;
+      bound = ios_round_bound(tree, lp->obj_val);
+      if (S->dir * W->curr.bound < S->dir * bound)
+         W->curr.bound = bound;
+      if (!ios_is_hopeful(tree, W->curr.bound))
+         goto done;
+      if (tree->pcost != NULL) ios_pcost_update(tree);
+      /* check integrality */
+      ios_check_integrality(tree);
+      if (W->curr.ii_cnt == 0)
+      {  W->found = 1;
+         W->z = lp->obj_val;
+         for (j = 1; j <= S->n; j++)
+         {  GLPCOL *col = lp->col[j];
+            W->x[j] = (col->kind == GLP_IV ? floor(col->prim + 0.5) :
+               col->prim);
+         }
+         goto done;
+      }
+      if (W->z_cut != +DBL_MAX)
+         fix_by_red_cost(W);
+      if (W->parm.sr_heur && !W->found)
+      {  round_heur(W);
+         if (W->found && !ios_is_hopeful(tree, W->curr.bound))
+            goto done;
+      }
+      /* choose column to branch on */
+      j = ios_choose_var(tree, &sel);
+      set_children(W, j, sel);
+      if (W->nc == 1)
+      {  /* other branch is hopeless, so the subproblem is modified and
+            re-optimized as the serial driver does */
+         PARCLD *cld = &W->cld[0];
+         change_bnds(W, j, cld->type, cld->lb, cld->ub);
+         W->curr.lp_obj = cld->lp_obj;
+         W->curr.bound = cld->bound;
+         goto loop;
+      }
+done: W->solved = 1;
+      return;
+}
+
+/**********************************************************************/
+/* worker threads */
+
+static void run_free(PARWRK *W)
+{     /* process subproblems until the search is finished */
+      PARSCH *S = W->S;
+      glp_tree *T = S->T;
+      lock_tree(W);
+      while (!S->quit)
+      {  if (W->p == 0)
+         {  if (T->head != NULL)
+               take_node(W, ios_choose_node(T));
+            else if (S->busy == 0)
+            {  /* all subproblems have been explored */
+               finish(S, 0);
+               break;
+            }
+            else
+            {  /* wait for other workers to create new subproblems */
+               S->idle++;
+               pthread_cond_wait(&S->cond, &S->lock);
+               S->idle--;
+               continue;
+            }
+         }
+         unlock_tree(W);
+         solve_node(W);
+         lock_tree(W);
+         store_node(W);
+         if (S->quit)
+            finish(S, S->ret);
+         else if (S->bingo)
+            pthread_cond_signal(&S->wake);
+         if (S->idle > 0 && T->head != NULL)
+            pthread_cond_broadcast(&S->cond);
+      }
+      release_node(W);
+      unlock_tree(W);
+      return;
+}
+
+static void end_round(PARSCH *S)
+{     /* store results of the round and give subproblems to the workers
+         for the next round; called by the last worker finished the
+         round */
+      glp_tree *T = S->T;
+      int k;
+      for (k = 0; k < S->nthreads; k++)
+      {  if (S->wrk[k].p != 0 && S->wrk[k].solved)
+            store_node(&S->wrk[k]);
+      }
+      if (S->quit)
+      {  for (k = 0; k < S->nthreads; k++)
+            release_node(&S->wrk[k]);
+         return;
+      }
+      for (k = 0; k < S->nthreads; k++)
+      {  if (S->wrk[k].p == 0 && T->head != NULL)
+            take_node(&S->wrk[k], ios_choose_node(T));
+         /* the incumbent value is the same for all the workers */
+         S->wrk[k].z_cut = S->incumb;
+      }
+      if (S->busy == 0)
+      {  /* all subproblems have been explored */
+         S->quit = 1, S->ret = 0;
+      }
+      if (S->bingo || S->quit)
+         pthread_cond_signal(&S->wake);
+      return;
+}
+
+static void run_det(PARWRK *W)
+{     /* process subproblems in rounds until the search is finished */
+      PARSCH *S = W->S;
+      int gen;
+      lock_tree(W);
+      for (;;)
+      {  /* wait for other workers to finish the round */
+         if (++S->arrived < S->nthreads)
+         {  gen = S->gen;
+            while (gen == S->gen)
+               pthread_cond_wait(&S->cond, &S->lock);
+         }
+         else
+         {  end_round(S);
+            S->arrived = 0, S->gen++;
+            pthread_cond_broadcast(&S->cond);
+         }
+         if (S->quit) break;
+         if (W->p != 0)
+         {  unlock_tree(W);
+            solve_node(W);
+            lock_tree(W);
+         }
+      }
+      unlock_tree(W);
+      return;
+}
+
+static void init_worker(PARWRK *W)
+{     /* create private copy of the root subproblem and private tree in
+         the worker's environment */
+      PARSCH *S = W->S;
+      glp_tree *T = S->T, *tree = &W->tree;
+      glp_prob *lp;
+      int i, j, n = S->n, *num, cnt[2];
+      double sum[2];
+      pthread_mutex_lock(&S->lock);
+      lp = W->lp = glp_create_prob();
+      glp_copy_prob(lp, T->mip, GLP_OFF);
+      if (!T->parm->share_cuts && lp->m > T->orig_m)
+      {  /* remove cuts generated for the root subproblem */
+         num = talloc(1+lp->m, int);
+         for (i = T->orig_m+1; i <= lp->m; i++)
+            num[i - T->orig_m] = i;
+         glp_del_rows(lp, lp->m - T->orig_m, num);
+         tfree(num);
+      }
+      W->type = talloc(1+n, unsigned char);
+      W->lb = talloc(1+n, double);
+      W->ub = talloc(1+n, double);
+      W->x = talloc(1+n, double);
+      W->fixed = talloc(1+n, unsigned char);
+      W->ind = talloc(1+n, int);
+      W->chg_type = talloc(1+n, int);
+      W->chg_lb = talloc(1+n, double);
+      W->chg_ub = talloc(1+n, double);
+      W->row_type = talloc(1+lp->m, unsigned char);
+      W->row_lb = talloc(1+lp->m, double);
+      W->row_ub = talloc(1+lp->m, double);
+      for (i = 1; i <= lp->m; i++)
+      {  W->row_type[i] = (unsigned char)lp->row[i]->type;
+         W->row_lb[i] = lp->row[i]->lb;
+         W->row_ub[i] = lp->row[i]->ub;
+      }
+      /* the private tree is used only to choose branching variables
+         and to compute local bounds, so output and parallel strong
+         branching are disabled */
+      memcpy(&W->parm, T->parm, sizeof(glp_iocp));
+      W->parm.msg_lev = GLP_MSG_OFF;
+      W->parm.threads = 1;
+      W->parm.inc_fn = NULL;
+      memset(tree, 0, sizeof(glp_tree));
+      tree->n = n;
+      tree->mip = tree->P = lp;
+      tree->parm = &W->parm;
+      tree->curr = &W->curr;
+      W->curr.up = &W->up;
+      tree->non_int = talloc(1+n, unsigned char);
+      memset(tree->non_int, 0, 1+n);
+      tree->iwrk = talloc(1+n, int);
+      tree->dwrk = talloc(1+n, double);
+      if (T->pcost != NULL)
+      {  tree->pcost = ios_pcost_init(tree);
+         for (j = 1; j <= n; j++)
+         {  ios_pcost_get(T, j, cnt, sum);
+            ios_pcost_set(tree, j, cnt, sum);
+         }
+      }
+      pthread_mutex_unlock(&S->lock);
+      return;
+}
+
+static void free_worker(PARWRK *W)
+{     glp_tree *tree = &W->tree;
+      if (tree->pcost != NULL)
+         ios_pcost_free(tree);
+      tfree(tree->non_int);
+      tfree(tree->iwrk);
+      tfree(tree->dwrk);
+      glp_delete_prob(W->lp);
+      tfree(W->type);
+      tfree(W->lb);
+      tfree(W->ub);
+      tfree(W->x);
+      tfree(W->fixed);
+      tfree(W->ind);
+      tfree(W->chg_type);
+      tfree(W->chg_lb);
+      tfree(W->chg_ub);
+      tfree(W->row_type);
+      tfree(W->row_lb);
+      tfree(W->row_ub);
+      return;
+}
+
+static void *worker_thread(void *arg)
+{     /* worker thread routine; the thread has its own environment,
+         which is created on the first call to the library and freed
+         on exit */
+      PARWRK *W = arg;
+      glp_term_out(GLP_OFF);
+      init_worker(W);
+      if (W->S->det)
+         run_det(W);
+      else
+         run_free(W);
+      free_worker(W);
+      glp_free_env();
+      return NULL;
+}
+
+/**********************************************************************/
+
+static void supervise(PARSCH *S)
+{     /* wait for the workers to finish the search displaying progress
+         and checking the time limit and termination requests; called
+         in the calling thread under the lock */
+      glp_tree *T = S->T;
+      const glp_iocp *parm = T->parm;
+      struct timespec ts;
+      while (!S->quit)
+      {  if (parm->msg_lev >= GLP_MSG_ON)
+         {  if (S->bingo)
+               show_held(S, 1);
+            else if ((double)(parm->out_frq - 1) <=
+               1000.0 * xdifftime(xtime(), T->tm_lag))
+               show_held(S, 0);
+         }
+         S->bingo = 0;
+         if (parm->tm_lim < INT_MAX &&
+            (double)(parm->tm_lim - 1) <=
+            1000.0 * xdifftime(xtime(), T->tm_beg))
+         {  if (parm->msg_lev >= GLP_MSG_DBG)
+               xprintf("Time limit exhausted; search terminated\n");
+            finish(S, GLP_ETMLIM);
+            break;
+         }
+         if (parm->stop_fn != NULL && parm->stop_fn(parm->stop_info))
+         {  if (parm->msg_lev >= GLP_MSG_DBG)
+               xprintf("Termination requested; search terminated\n");
+            finish(S, GLP_ESTOP);
+            break;
+         }
+         clock_gettime(CLOCK_REALTIME, &ts);
+         ts.tv_nsec += PAR_WAIT * 1000000L;
+         if (ts.tv_nsec >= 1000000000L)
+            ts.tv_sec++, ts.tv_nsec -= 1000000000L;
+         pthread_cond_timedwait(&S->wake, &S->lock, &ts);
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_par_search - continue the search with several worker threads
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  int ios_par_search(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_par_search continues the branch-and-bound search
+*  with T->parm->threads worker threads sharing the tree (see comments
+*  at the beginning of this file). The root subproblem should have been
+*  branched, and the current subproblem should not exist.
+*
+*  On exit the best integer feasible solution found, if any, is stored
+*  to T->mip as the serial driver does, and the tree contains active
+*  subproblems which have not been explored, if the search has been
+*  terminated prematurely.
+*
+*  RETURNS
+*
+*  0           the search has been completed;
+*
+*  GLP_EMIPGAP the relative mip gap tolerance has been reached;
+*
+*  GLP_ETMLIM  the time limit has been exceeded;
+*
+*  GLP_ESTOP   the search has been terminated on request;
+*
+*  GLP_EFAIL   the search has been terminated due to the solver
+*              failure;
+*
+*  -1          no worker thread could be started, so the search should
+*              be continued by the serial driver. */
+
+int ios_par_search(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      const glp_iocp *parm = T->parm;
+      PARSCH _S, *S = &_S;
+      glp_bfcp bfcp;
+      int k, nthreads = parm->threads;
+      char *buf;
+      xassert(T->curr == NULL);
+      xassert(T->slot[1].node != NULL && T->slot[1].node->count > 0);
+      /* glp_copy_prob called by the workers would create the basis
+         factorization driver in foreign environment, if it does not
+         exist yet */
+      glp_get_bfcp(mip, &bfcp);
+      memset(S, 0, sizeof(PARSCH));
+      S->T = T;
+      S->env = tls_get_ptr();
+      S->n = mip->n;
+      S->dir = (mip->dir == GLP_MIN ? +1.0 : -1.0);
+      S->det = parm->det_mode;
+      S->wrk = xcalloc(nthreads, sizeof(PARWRK));
+      memset(S->wrk, 0, nthreads * sizeof(PARWRK));
+      T->child = 0;
+      update_incumb(S);
+      pthread_mutex_init(&S->lock, NULL);
+      pthread_cond_init(&S->cond, NULL);
+      pthread_cond_init(&S->wake, NULL);
+      /* start workers */
+      pthread_mutex_lock(&S->lock);
+      S->nthreads = nthreads;
+      for (k = 0; k < nthreads; k++)
+      {  S->wrk[k].S = S;
+         S->wrk[k].id = k;
+         if (pthread_create(&S->wrk[k].tid, NULL, worker_thread,
+            &S->wrk[k]) != 0)
+         {  /* use only threads started so far */
+            break;
+         }
+      }
+      S->nthreads = k;
+      if (S->nthreads > 0)
+      {  if (parm->msg_lev >= GLP_MSG_ALL)
+            xprintf("Parallel search with %d threads%s...\n",
+               S->nthreads, S->det ? " (deterministic mode)" : "");
+         supervise(S);
+      }
+      pthread_mutex_unlock(&S->lock);
+      for (k = 0; k < S->nthreads; k++)
+         pthread_join(S->wrk[k].tid, NULL);
+      pthread_mutex_destroy(&S->lock);
+      pthread_cond_destroy(&S->cond);
+      pthread_cond_destroy(&S->wake);
+      if (S->nthreads == 0)
+      {  xfree(S->wrk);
+         return -1;
+      }
+      if (S->bingo && parm->msg_lev >= GLP_MSG_ON)
+         ios_show_progress(T, 1);
+      if (parm->msg_lev >= GLP_MSG_ALL)
+      {  buf = xmalloc(20 + 12 * S->nthreads);
+         buf[0] = '\0';
+         for (k = 0; k < S->nthreads; k++)
+            sprintf(buf + strlen(buf), "%s%d", k == 0 ? "" : ", ",
+               S->wrk[k].cnt);
+         xprintf("Parallel search: %d subproblems processed (%s)\n",
+            S->nodes, buf);
+         xfree(buf);
+      }
+      xfree(S->wrk);
+      return S->ret;
+}
+
+/* eof */
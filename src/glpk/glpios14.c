@@ -0,0 +1,744 @@
+/* glpios14.c (compact storage of subproblem changes) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include <stdio.h>
+#include "glpenv.h"
+#include "glpios.h"
+
+/***********************************************************************
+*  Each subproblem (except the root) keeps changes made to its parent
+*  subproblem as a packed byte string, which is a sequence of records.
+*  Every record starts with a header (unsigned number, see below), the
+*  low three bits of which is a code:
+*
+*  1, ..., 5   status of row/column k is changed to the code;
+*
+*  0           type and bounds of row/column k are changed; the header
+*              is followed by a byte of flags and the bounds;
+*
+*  6           the same as 0 along with status given in the flags;
+*
+*  7           a new row is added; the header is followed by the row
+*              name, flags, bounds, scale factor and coefficients.
+*
+*  For codes 0 to 6 the rest of the header is the difference between k
+*  and the number of row/column in the previous record (records go in
+*  increasing order of k), so in most cases the header takes one byte.
+*
+*  The byte of flags contains the type in bits 0-2, the status in bits
+*  4-6, and bit 3 means that the bounds, which have integral values of
+*  small magnitude, are stored as signed numbers rather than doubles.
+*  Only bounds that are meaningful for the type are stored.
+*
+*  Unsigned numbers are stored with 7 bits per byte, least significant
+*  bits first, the high bit of every byte but the last being set.
+*
+*  Packed strings that have not been used for a long time can be moved
+*  to a temporary file if their total size exceeds the limit specified
+*  by the control parameter node_mem. Strings in memory are kept in the
+*  list ordered by the time of last use (the least recently used one is
+*  the first), so strings of subproblems close to the root, which are
+*  used each time any subproblem is revived, are never moved. A string
+*  moved to the file is read back when the subproblem or one of its
+*  descendants is revived, while its copy is kept in the file, so it is
+*  not written again unless the subproblem is frozen once more. Space
+*  occupied in the file by strings of deleted subproblems is not reused
+*  (the file is deleted on exit from the solver). */
+
+#define F_INT  0x08  /* bounds are stored as signed numbers */
+
+/**********************************************************************/
+
+static void need(glp_tree *tree, int len)
+{     /* make sure the working buffer has room for len more bytes */
+      if (tree->pk_max - tree->pk_len < len)
+      {  int max = tree->pk_max;
+         unsigned char *save = tree->pk_buf;
+         tree->pk_max = max + max;
+         if (tree->pk_max < tree->pk_len + len)
+            tree->pk_max = tree->pk_len + len + 100;
+         tree->pk_buf = xcalloc(tree->pk_max, sizeof(unsigned char));
+         if (save != NULL)
+         {  memcpy(tree->pk_buf, save, tree->pk_len);
+            xfree(save);
+         }
+      }
+      return;
+}
+
+static void put_num(glp_tree *tree, unsigned int x)
+{     /* store unsigned number */
+      need(tree, 5);
+      while (x >= 0x80)
+      {  tree->pk_buf[tree->pk_len++] = (unsigned char)(x | 0x80);
+         x >>= 7;
+      }
+      tree->pk_buf[tree->pk_len++] = (unsigned char)x;
+      return;
+}
+
+static void put_dbl(glp_tree *tree, double x)
+{     /* store double */
+      need(tree, sizeof(double));
+      memcpy(&tree->pk_buf[tree->pk_len], &x, sizeof(double));
+      tree->pk_len += sizeof(double);
+      return;
+}
+
+static void put_int(glp_tree *tree, double x)
+{     /* store integral value of small magnitude as signed number */
+      int t = (int)x;
+      put_num(tree, t >= 0 ? (unsigned int)t << 1 :
+         ((unsigned int)(-(t+1)) << 1) | 1);
+      return;
+}
+
+static int is_small(double x)
+{     /* check if the value can be stored as signed number */
+      if (!(-1e9 <= x && x <= +1e9)) return 0;
+      if (x != (double)(int)x) return 0;
+      /* negative zero must be kept as is */
+      if (x == 0.0 && 1.0 / x < 0.0) return 0;
+      return 1;
+}
+
+static void put_bnds(glp_tree *tree, int type, int stat, double lb,
+      double ub)
+{     /* store flags and bounds */
+      int flags = type | (stat << 4);
+      if (is_small(lb) && is_small(ub)) flags |= F_INT;
+      need(tree, 1);
+      tree->pk_buf[tree->pk_len++] = (unsigned char)flags;
+      if (type == GLP_LO || type == GLP_DB || type == GLP_FX)
+      {  if (flags & F_INT)
+            put_int(tree, lb);
+         else
+            put_dbl(tree, lb);
+      }
+      if (type == GLP_UP || type == GLP_DB)
+      {  if (flags & F_INT)
+            put_int(tree, ub);
+         else
+            put_dbl(tree, ub);
+      }
+      return;
+}
+
+static unsigned int get_num(const unsigned char **ptr)
+{     /* fetch unsigned number */
+      const unsigned char *p = *ptr;
+      unsigned int x = 0;
+      int s = 0;
+      for (;;)
+      {  x |= (unsigned int)(*p & 0x7F) << s;
+         if (!(*p++ & 0x80)) break;
+         s += 7;
+      }
+      *ptr = p;
+      return x;
+}
+
+static double get_dbl(const unsigned char **ptr)
+{     /* fetch double */
+      double x;
+      memcpy(&x, *ptr, sizeof(double));
+      *ptr += sizeof(double);
+      return x;
+}
+
+static double get_val(const unsigned char **ptr, int flags)
+{     /* fetch bound */
+      unsigned int x;
+      if (!(flags & F_INT))
+         return get_dbl(ptr);
+      x = get_num(ptr);
+      return x & 1 ? - (double)(x >> 1) - 1.0 : (double)(x >> 1);
+}
+
+static void get_bnds(const unsigned char **ptr, int *type, int *stat,
+      double *lb, double *ub)
+{     /* fetch flags and bounds */
+      int flags = *(*ptr)++;
+      *type = flags & 0x07;
+      *stat = (flags >> 4) & 0x07;
+      *lb = *ub = 0.0;
+      if (*type == GLP_LO || *type == GLP_DB || *type == GLP_FX)
+         *lb = get_val(ptr, flags);
+      if (*type == GLP_UP || *type == GLP_DB)
+         *ub = get_val(ptr, flags);
+      if (*type == GLP_FX)
+         *ub = *lb;
+      return;
+}
+
+/**********************************************************************/
+
+static void lru_del(glp_tree *tree, IOSNPD *node)
+{     /* remove subproblem from the list of strings in memory */
+      if (node->lru_prev == NULL)
+         tree->lru_head = node->lru_next;
+      else
+         node->lru_prev->lru_next = node->lru_next;
+      if (node->lru_next == NULL)
+         tree->lru_tail = node->lru_prev;
+      else
+         node->lru_next->lru_prev = node->lru_prev;
+      node->lru_prev = node->lru_next = NULL;
+      return;
+}
+
+static void lru_add(glp_tree *tree, IOSNPD *node)
+{     /* add subproblem to the end of the list of strings in memory */
+      node->lru_prev = tree->lru_tail;
+      node->lru_next = NULL;
+      if (tree->lru_head == NULL)
+         tree->lru_head = node;
+      else
+         tree->lru_tail->lru_next = node;
+      tree->lru_tail = node;
+      return;
+}
+
+static unsigned char *get_mem(glp_tree *tree, int len)
+{     /* allocate memory for packed string */
+      tree->chg_mem += len;
+      if (len <= 256)
+         return dmp_get_atom(tree->pool, len);
+      else
+         return xcalloc(len, sizeof(unsigned char));
+}
+
+static void free_mem(glp_tree *tree, unsigned char *chg, int len)
+{     /* free memory allocated to packed string */
+      tree->chg_mem -= len;
+      if (len <= 256)
+         dmp_free_atom(tree->pool, chg, len);
+      else
+         xfree(chg);
+      return;
+}
+
+static void store(glp_tree *tree, IOSNPD *node)
+{     /* store contents of the working buffer as packed string of the
+         subproblem */
+      xassert(node->chg == NULL && node->chg_len == 0);
+      node->chg_pos = -1;
+      if (tree->pk_len == 0) return;
+      node->chg_len = tree->pk_len;
+      node->chg = get_mem(tree, tree->pk_len);
+      memcpy(node->chg, tree->pk_buf, tree->pk_len);
+      lru_add(tree, node);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_save_chg - save changes of current subproblem
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_save_chg(glp_tree *tree);
+*
+*  DESCRIPTION
+*
+*  The routine ios_save_chg packs changes of the current non-root
+*  subproblem made to its parent subproblem, whose attributes are saved
+*  in the arrays pred_type, pred_lb, pred_ub and pred_stat, and stores
+*  them as packed string of the current subproblem. */
+
+void ios_save_chg(glp_tree *tree)
+{     glp_prob *mip = tree->mip;
+      IOSNPD *node = tree->curr;
+      int m = mip->m;
+      int n = mip->n;
+      int pred_m = tree->pred_m;
+      int i, k, t, len, last, type, stat, *ind;
+      double lb, ub, *val;
+      xassert(node != NULL && node->up != NULL);
+      xassert(pred_m <= m);
+      tree->pk_len = 0;
+      /* rows and columns which exist in the parent subproblem */
+      last = 0;
+      for (k = 1; k <= pred_m + n; k++)
+      {  if (k <= pred_m)
+         {  GLPROW *row = mip->row[k];
+            type = row->type, lb = row->lb, ub = row->ub;
+            stat = row->stat;
+         }
+         else
+         {  GLPCOL *col = mip->col[k - pred_m];
+            type = col->type, lb = col->lb, ub = col->ub;
+            stat = col->stat;
+         }
+         if (!(tree->pred_type[k] == type && tree->pred_lb[k] == lb &&
+               tree->pred_ub[k] == ub))
+         {  /* type and bounds, and possibly status, changed */
+            t = (tree->pred_stat[k] != stat);
+            put_num(tree, ((unsigned int)(k - last) << 3) |
+               (t ? 6 : 0));
+            put_bnds(tree, type, t ? stat : 0, lb, ub);
+            last = k;
+         }
+         else if (tree->pred_stat[k] != stat)
+         {  /* status changed */
+            put_num(tree, ((unsigned int)(k - last) << 3) | stat);
+            last = k;
+         }
+      }
+      /* new rows added to the current subproblem */
+      if (pred_m < m)
+      {  ind = xcalloc(1+n, sizeof(int));
+         val = xcalloc(1+n, sizeof(double));
+         for (i = pred_m+1; i <= m; i++)
+         {  GLPROW *row = mip->row[i];
+            const char *name = glp_get_row_name(mip, i);
+            put_num(tree, 7);
+            if (name == NULL)
+               put_num(tree, 0);
+            else
+            {  len = strlen(name);
+               put_num(tree, len+1);
+               need(tree, len);
+               memcpy(&tree->pk_buf[tree->pk_len], name, len);
+               tree->pk_len += len;
+            }
+            need(tree, 2);
+            tree->pk_buf[tree->pk_len++] = row->origin;
+            tree->pk_buf[tree->pk_len++] = row->klass;
+            put_bnds(tree, row->type, row->stat, row->lb, row->ub);
+            put_dbl(tree, row->rii);
+            len = glp_get_mat_row(mip, i, ind, val);
+            put_num(tree, len);
+            /* coefficients are stored in reverse order to add them to
+               the row in the same order as before */
+            for (k = len; k >= 1; k--)
+            {  put_num(tree, ind[k]);
+               put_dbl(tree, val[k]);
+            }
+         }
+         xfree(ind);
+         xfree(val);
+      }
+      store(tree, node);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_bnd_chg - save bound change of new subproblem
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_bnd_chg(glp_tree *tree, IOSNPD *node, int k, int type,
+*     double lb, double ub);
+*
+*  DESCRIPTION
+*
+*  The routine ios_bnd_chg stores the change of type and bounds of k-th
+*  row/column as the only change of a new subproblem, which is just
+*  created by cloning its parent. */
+
+void ios_bnd_chg(glp_tree *tree, IOSNPD *node, int k, int type,
+      double lb, double ub)
+{     xassert(node->chg == NULL && node->chg_len == 0);
+      xassert(k >= 1);
+      tree->pk_len = 0;
+      put_num(tree, (unsigned int)k << 3);
+      put_bnds(tree, type, 0, lb, ub);
+      store(tree, node);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_bnds_chg - save bound changes of new subproblem
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_bnds_chg(glp_tree *tree, IOSNPD *node, int len,
+*     const int ind[], const int type[], const double lb[],
+*     const double ub[]);
+*
+*  DESCRIPTION
+*
+*  The routine ios_bnds_chg stores changes of types and bounds of rows/
+*  columns ind[1], ..., ind[len], which must go in increasing order, as
+*  the only changes of a new subproblem, which is just created by
+*  cloning its parent. New type and bounds of row/column ind[t] are
+*  type[t], lb[t] and ub[t]. */
+
+void ios_bnds_chg(glp_tree *tree, IOSNPD *node, int len,
+      const int ind[], const int type[], const double lb[],
+      const double ub[])
+{     int t, last;
+      xassert(node->chg == NULL && node->chg_len == 0);
+      tree->pk_len = 0;
+      last = 0;
+      for (t = 1; t <= len; t++)
+      {  xassert(ind[t] > last);
+         put_num(tree, (unsigned int)(ind[t] - last) << 3);
+         put_bnds(tree, type[t], 0, lb[t], ub[t]);
+         last = ind[t];
+      }
+      store(tree, node);
+      return;
+}
+
+/**********************************************************************/
+
+static void spill_error(glp_tree *tree)
+{     /* disable moving strings to the file */
+      if (tree->parm->msg_lev >= GLP_MSG_ERR)
+         xprintf("Unable to use temporary file to store subproblems\n");
+      tree->chg_lim = 0;
+      return;
+}
+
+static int spill(glp_tree *tree, IOSNPD *node)
+{     /* move packed string of the subproblem to the file */
+      FILE *fp = tree->spill;
+      if (node->chg_pos < 0)
+      {  if (fseek(fp, 0, SEEK_END) != 0) return 1;
+         node->chg_pos = ftell(fp);
+         if (node->chg_pos < 0) return 1;
+         if (fwrite(node->chg, 1, node->chg_len, fp) !=
+            (size_t)node->chg_len)
+         {  node->chg_pos = -1;
+            return 1;
+         }
+         tree->spill_size += node->chg_len;
+      }
+      lru_del(tree, node);
+      free_mem(tree, node->chg, node->chg_len);
+      node->chg = NULL;
+      return 0;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_spill_chg - move packed strings to temporary file
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_spill_chg(glp_tree *tree);
+*
+*  DESCRIPTION
+*
+*  The routine ios_spill_chg checks if the total size of packed strings
+*  kept in memory exceeds the limit, in which case it moves the least
+*  recently used strings to the temporary file until their size becomes
+*  less than three quarters of the limit. */
+
+void ios_spill_chg(glp_tree *tree)
+{     IOSNPD *node;
+      if (tree->chg_lim == 0 || tree->chg_mem <= tree->chg_lim)
+         goto done;
+      if (tree->spill == NULL)
+      {  tree->spill = tmpfile();
+         if (tree->spill == NULL)
+         {  spill_error(tree);
+            goto done;
+         }
+         if (tree->parm->msg_lev >= GLP_MSG_ALL)
+            xprintf("Subproblem data exceed %d Kb; using temporary fi"
+               "le\n", tree->parm->node_mem);
+      }
+      while (tree->chg_mem > tree->chg_lim - tree->chg_lim / 4)
+      {  node = tree->lru_head;
+         if (node == NULL) break;
+         if (spill(tree, node) != 0)
+         {  spill_error(tree);
+            break;
+         }
+         tree->spill_cnt++;
+      }
+done: return;
+}
+
+static void fetch(glp_tree *tree, IOSNPD *node)
+{     /* bring packed string of the subproblem back to memory and mark
+         it as used most recently */
+      if (node->chg_len == 0)
+         ;
+      else if (node->chg != NULL)
+      {  lru_del(tree, node);
+         lru_add(tree, node);
+      }
+      else
+      {  xassert(tree->spill != NULL && node->chg_pos >= 0);
+         node->chg = get_mem(tree, node->chg_len);
+         if (fseek(tree->spill, node->chg_pos, SEEK_SET) != 0 ||
+             fread(node->chg, 1, node->chg_len, tree->spill) !=
+             (size_t)node->chg_len)
+            xerror("ios_revive_node: unable to read subproblem data fr"
+               "om temporary file\n");
+         lru_add(tree, node);
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_load_chg - apply changes of subproblem
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_load_chg(glp_tree *tree, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_load_chg applies changes of the specified subproblem
+*  to the problem object, which is assumed to correspond to the parent
+*  subproblem, bringing its packed string back to memory if necessary.
+*  New rows get the level of the specified subproblem. */
+
+void ios_load_chg(glp_tree *tree, IOSNPD *node)
+{     glp_prob *mip = tree->mip;
+      int m = mip->m;
+      int n = mip->n;
+      const unsigned char *ptr, *end;
+      int i, j, k, len, code, type, stat, *ind = NULL;
+      unsigned int h;
+      double lb, ub, rii, *val = NULL;
+      fetch(tree, node);
+      ptr = node->chg, end = ptr + node->chg_len;
+      k = 0;
+      while (ptr < end)
+      {  h = get_num(&ptr);
+         code = h & 7;
+         if (code == 7)
+         {  /* add new row */
+            if (ind == NULL)
+            {  ind = xcalloc(1+n, sizeof(int));
+               val = xcalloc(1+n, sizeof(double));
+            }
+            i = glp_add_rows(mip, 1);
+            len = get_num(&ptr);
+            if (len > 0)
+            {  char name[255+1];
+               len--;
+               xassert(len <= 255);
+               memcpy(name, ptr, len);
+               name[len] = '\0';
+               ptr += len;
+               glp_set_row_name(mip, i, name);
+            }
+            xassert(mip->row[i]->level == 0);
+            mip->row[i]->level = node->level;
+            mip->row[i]->origin = *ptr++;
+            mip->row[i]->klass = *ptr++;
+            get_bnds(&ptr, &type, &stat, &lb, &ub);
+            glp_set_row_bnds(mip, i, type, lb, ub);
+            rii = get_dbl(&ptr);
+            len = get_num(&ptr);
+            for (j = 1; j <= len; j++)
+            {  ind[j] = get_num(&ptr);
+               val[j] = get_dbl(&ptr);
+            }
+            glp_set_mat_row(mip, i, len, ind, val);
+            glp_set_rii(mip, i, rii);
+            glp_set_row_stat(mip, i, stat);
+            continue;
+         }
+         k += (int)(h >> 3);
+         if (code == 0 || code == 6)
+         {  /* change type and bounds */
+            get_bnds(&ptr, &type, &stat, &lb, &ub);
+            if (k <= m)
+               glp_set_row_bnds(mip, k, type, lb, ub);
+            else
+               glp_set_col_bnds(mip, k-m, type, lb, ub);
+         }
+         else
+            stat = code;
+         if (code != 0)
+         {  /* change status */
+            if (k <= m)
+               glp_set_row_stat(mip, k, stat);
+            else
+               glp_set_col_stat(mip, k-m, stat);
+         }
+      }
+      xassert(ptr == end);
+      if (ind != NULL)
+      {  xfree(ind);
+         xfree(val);
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_node_bnds - determine bounds of columns of subproblem
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_node_bnds(glp_tree *tree, IOSNPD *node, unsigned char
+*     type[], double lb[], double ub[]);
+*
+*  DESCRIPTION
+*
+*  The routine ios_node_bnds determines types and bounds of columns in
+*  the specified subproblem, which should not be current, applying the
+*  changes of all subproblems on the path from the root to it to the
+*  attributes of the root subproblem, and stores them in locations
+*  type[j], lb[j] and ub[j], j = 1, ..., n. The problem object is not
+*  changed. */
+
+void ios_node_bnds(glp_tree *tree, IOSNPD *node, unsigned char type[],
+      double lb[], double ub[])
+{     int n = tree->n;
+      int m = tree->root_m;
+      IOSNPD **path, *nd;
+      const unsigned char *ptr, *end;
+      int j, k, t, len, code, stat;
+      unsigned int h;
+      double l, u;
+      xassert(node != tree->curr);
+      xassert(tree->root_type != NULL);
+      for (j = 1; j <= n; j++)
+      {  type[j] = tree->root_type[m+j];
+         lb[j] = tree->root_lb[m+j];
+         ub[j] = tree->root_ub[m+j];
+      }
+      /* the path from the root to the subproblem */
+      path = xcalloc(1+node->level, sizeof(IOSNPD *));
+      for (nd = node; nd != NULL; nd = nd->up)
+         path[nd->level] = nd;
+      xassert(path[0] == tree->slot[1].node);
+      for (t = 1; t <= node->level; t++)
+      {  nd = path[t];
+         fetch(tree, nd);
+         ptr = nd->chg, end = ptr + nd->chg_len;
+         /* row and column numbers refer to the parent subproblem, and
+            new rows go after all other changes */
+         k = 0;
+         while (ptr < end)
+         {  h = get_num(&ptr);
+            code = h & 7;
+            if (code == 7)
+            {  /* skip new row */
+               len = get_num(&ptr);
+               if (len > 0) ptr += len-1;
+               ptr += 2;
+               get_bnds(&ptr, &code, &stat, &l, &u);
+               ptr += sizeof(double);
+               len = get_num(&ptr);
+               for (j = 1; j <= len; j++)
+               {  get_num(&ptr);
+                  ptr += sizeof(double);
+               }
+               m++;
+               continue;
+            }
+            k += (int)(h >> 3);
+            if (code == 0 || code == 6)
+            {  get_bnds(&ptr, &code, &stat, &l, &u);
+               if (k > m)
+               {  type[k-m] = (unsigned char)code;
+                  lb[k-m] = l, ub[k-m] = u;
+               }
+            }
+         }
+         xassert(ptr == end);
+      }
+      xfree(path);
+      /* packed strings on the path have been brought back to memory */
+      ios_spill_chg(tree);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_drop_chg - delete changes of subproblem
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_drop_chg(glp_tree *tree, IOSNPD *node);
+*
+*  DESCRIPTION
+*
+*  The routine ios_drop_chg deletes the packed string of the specified
+*  subproblem. */
+
+void ios_drop_chg(glp_tree *tree, IOSNPD *node)
+{     if (node->chg != NULL)
+      {  lru_del(tree, node);
+         free_mem(tree, node->chg, node->chg_len);
+      }
+      node->chg = NULL;
+      node->chg_len = 0;
+      node->chg_pos = -1;
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_free_chg - free storage of packed strings
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_free_chg(glp_tree *tree);
+*
+*  DESCRIPTION
+*
+*  The routine ios_free_chg frees the memory allocated to packed strings
+*  outside the memory pool of the tree as well as the working buffer,
+*  and deletes the temporary file. It is called on deleting the tree,
+*  when the subproblems themselves are deleted along with the pool. */
+
+void ios_free_chg(glp_tree *tree)
+{     IOSNPD *node;
+      for (node = tree->lru_head; node != NULL; node = node->lru_next)
+      {  if (node->chg_len > 256)
+            xfree(node->chg);
+      }
+      tree->lru_head = tree->lru_tail = NULL;
+      if (tree->pk_buf != NULL)
+         xfree(tree->pk_buf);
+      tree->pk_buf = NULL;
+      tree->pk_len = tree->pk_max = 0;
+      if (tree->spill != NULL)
+         fclose(tree->spill);
+      tree->spill = NULL;
+      return;
+}
+
+/* eof */
@@ -0,0 +1,239 @@
+/* glpios15.c (parallel cut separation) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include <pthread.h>
+#include "glpenv.h"
+#include "glpios.h"
+
+/***********************************************************************
+*  Built-in cut generators only read the LP relaxation of the current
+*  subproblem, so they can be run concurrently on the same snapshot of
+*  the current point, provided that the problem object is not changed
+*  until all of them have finished. The basis factorization is used by
+*  the Gomory cut generator only.
+*
+*  Each generator is run on a shallow copy of the tree, which has its
+*  own memory pool and local cut pool, so cuts are added to the private
+*  pool without locking. On completion the cuts are copied to a buffer
+*  allocated with malloc (it is created and freed in different threads
+*  each having its own environment, see glpios13.c), and the calling
+*  thread appends them to the local cut pool in the order, in which the
+*  generators were listed. Therefore the result does not depend on the
+*  number of threads and their timing, and it is exactly the same as if
+*  the generators were called one after another. */
+
+typedef struct SEPCUT SEPCUT;
+typedef struct SEPTASK SEPTASK;
+typedef struct SEPWRK SEPWRK;
+
+struct SEPCUT
+{     /* cut copied from private pool */
+      unsigned char klass, type;
+      /* cut class and type */
+      double rhs;
+      /* right-hand side */
+      int beg, len;
+      /* coefficients are ind[beg+1, ..., beg+len] and val[beg+1, ...,
+         beg+len] of the task */
+};
+
+struct SEPTASK
+{     /* cut generator task */
+      int sep;
+      /* generator (IOS_GMI, IOS_MIR, IOS_COV, or IOS_CLQ) */
+      int nc;
+      /* number of cuts generated */
+      SEPCUT *cut; /* SEPCUT cut[nc]; */
+      int *ind; /* int ind[1+nnz]; */
+      double *val; /* double val[1+nnz]; */
+      /* cuts generated (allocated with malloc) */
+};
+
+struct SEPWRK
+{     /* worker thread */
+      glp_tree *T;
+      /* branch-and-bound tree */
+      SEPTASK *task; /* SEPTASK task[1+ntask]; */
+      int ntask;
+      /* all tasks */
+      int first, step;
+      /* the worker runs task[first], task[first+step], ... */
+      pthread_t tid;
+      /* worker thread (not used for worker 0) */
+};
+
+static void save_cuts(SEPTASK *task, IOSPOOL *pool)
+{     /* copy cuts from private pool to the task buffer */
+      IOSCUT *cut;
+      IOSAIJ *aij;
+      int k, nnz;
+      task->nc = 0;
+      task->cut = NULL, task->ind = NULL, task->val = NULL;
+      if (pool->size == 0)
+         goto done;
+      nnz = 0;
+      for (cut = pool->head; cut != NULL; cut = cut->next)
+      {  for (aij = cut->ptr; aij != NULL; aij = aij->next)
+            nnz++;
+      }
+      task->cut = malloc(pool->size * sizeof(SEPCUT));
+      task->ind = malloc((1+nnz) * sizeof(int));
+      task->val = malloc((1+nnz) * sizeof(double));
+      if (task->cut == NULL || task->ind == NULL || task->val == NULL)
+      {  /* cuts are not necessary, so they are just discarded */
+         free(task->cut), free(task->ind), free(task->val);
+         task->cut = NULL, task->ind = NULL, task->val = NULL;
+         goto done;
+      }
+      nnz = 0;
+      for (cut = pool->head; cut != NULL; cut = cut->next)
+      {  SEPCUT *c = &task->cut[task->nc++];
+         /* built-in generators do not assign names to cuts */
+         xassert(cut->name == NULL);
+         c->klass = cut->klass, c->type = cut->type;
+         c->rhs = cut->rhs;
+         c->beg = nnz, c->len = 0;
+         for (aij = cut->ptr; aij != NULL; aij = aij->next)
+            c->len++;
+         /* coefficient list is built by ios_add_row in reverse order,
+            so it is stored backwards to be restored exactly */
+         k = nnz + c->len;
+         for (aij = cut->ptr; aij != NULL; aij = aij->next, k--)
+            task->ind[k] = aij->j, task->val[k] = aij->val;
+         nnz += c->len;
+      }
+done: return;
+}
+
+static void run_task(glp_tree *T, SEPTASK *task)
+{     /* run cut generator on private copy of the tree */
+      glp_tree S = *T;
+      S.pool = dmp_create_pool();
+      S.local = ios_create_pool(&S);
+      switch (task->sep)
+      {  case IOS_GMI:
+            ios_gmi_gen(&S);
+            break;
+         case IOS_MIR:
+            ios_mir_gen(&S, S.mir_gen);
+            break;
+         case IOS_COV:
+            ios_cov_gen(&S);
+            break;
+         case IOS_CLQ:
+            ios_clq_gen(&S, S.clq_gen);
+            break;
+         default:
+            xassert(task != task);
+      }
+      save_cuts(task, S.local);
+      ios_delete_pool(&S, S.local);
+      dmp_delete_pool(S.pool);
+      return;
+}
+
+static void run_worker(SEPWRK *W)
+{     /* run tasks assigned to the worker */
+      int k;
+      for (k = W->first; k <= W->ntask; k += W->step)
+         run_task(W->T, &W->task[k]);
+      return;
+}
+
+static void *worker_thread(void *arg)
+{     /* worker thread routine */
+      SEPWRK *W = arg;
+      glp_term_out(GLP_OFF);
+      run_worker(W);
+      glp_free_env();
+      return NULL;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_par_sep - run built-in cut generators concurrently
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_par_sep(glp_tree *T, int nsep, const int sep[]);
+*
+*  DESCRIPTION
+*
+*  The routine ios_par_sep runs the built-in cut generators sep[1],
+*  ..., sep[nsep] (IOS_GMI, IOS_MIR, IOS_COV, IOS_CLQ) for the current
+*  point using up to T->parm->threads threads and appends the cuts
+*  generated to the local cut pool in the order of the generators (see
+*  comments at the beginning of this file). */
+
+void ios_par_sep(glp_tree *T, int nsep, const int sep[])
+{     SEPTASK *task;
+      SEPWRK *wrk;
+      glp_bfcp bfcp;
+      int k, t, nthreads, nwrk;
+      xassert(T->reason == GLP_ICUTGEN);
+      xassert(nsep >= 1);
+      nthreads = T->parm->threads;
+      if (nthreads > nsep) nthreads = nsep;
+      task = xcalloc(1+nsep, sizeof(SEPTASK));
+      for (k = 1; k <= nsep; k++)
+         task[k].sep = sep[k];
+      wrk = xcalloc(nthreads, sizeof(SEPWRK));
+      for (t = 0; t < nthreads; t++)
+      {  wrk[t].T = T;
+         wrk[t].task = task, wrk[t].ntask = nsep;
+         wrk[t].first = 1 + t, wrk[t].step = nthreads;
+      }
+      /* make sure the basis factorization driver exists, since it is
+         lazily created on the first access */
+      glp_get_bfcp(T->mip, &bfcp);
+      /* start workers; tasks of the workers failed to start are run
+         by the calling thread */
+      for (nwrk = 1; nwrk < nthreads; nwrk++)
+      {  if (pthread_create(&wrk[nwrk].tid, NULL, worker_thread,
+               &wrk[nwrk]) != 0)
+            break;
+      }
+      run_worker(&wrk[0]);
+      for (t = nwrk; t < nthreads; t++)
+         run_worker(&wrk[t]);
+      for (t = 1; t < nwrk; t++)
+         pthread_join(wrk[t].tid, NULL);
+      /* add cuts to the local cut pool */
+      for (k = 1; k <= nsep; k++)
+      {  for (t = 0; t < task[k].nc; t++)
+         {  SEPCUT *c = &task[k].cut[t];
+            ios_add_row(T, T->local, NULL, c->klass, 0, c->len,
+               &task[k].ind[c->beg], &task[k].val[c->beg], c->type,
+               c->rhs);
+         }
+         free(task[k].cut), free(task[k].ind), free(task[k].val);
+      }
+      xfree(task);
+      xfree(wrk);
+      return;
+}
+
+/* eof */
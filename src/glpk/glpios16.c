@@ -0,0 +1,380 @@
+/* glpios16.c (global cut pool) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "glpenv.h"
+#include "glpios.h"
+
+/***********************************************************************
+*  The global cut pool keeps cuts, which have passed through the local
+*  cut pool, i.e. have been generated by the built-in generators or by
+*  the application program, or have been re-activated from the global
+*  pool itself. Since cuts are only locally valid in general, each cut
+*  is stored along with the subproblem, where it was generated, and may
+*  be re-activated only in the subtree rooted at that subproblem. Cuts
+*  having the same left-hand side are recognized by hashing; only the
+*  strongest one of them is kept in the pool.
+*
+*  On each round of cut generation cuts valid for the current
+*  subproblem and violated at the current point are copied to the local
+*  cut pool, where they compete with new cuts (see ios_process_cuts).
+*  Every check a cut passes without being violated increases its age;
+*  if the pool is full, the oldest cuts are evicted first, and of cuts
+*  of the same age ones with smaller efficacy go first.
+*
+*  Cut names are not kept in the pool. */
+
+#define EPS 1e-5
+/* minimal efficacy of a cut to be re-activated */
+
+static IOSGCUT *find_cut(IOSGPOOL *gpool, IOSCUT *cut,
+      unsigned int hash)
+{     /* find cut with the same left-hand side in the pool */
+      IOSGCUT *gcut;
+      IOSAIJ *aij;
+      double *work = gpool->work;
+      int k, len = 0;
+      for (gcut = gpool->htab[hash & (gpool->hsize-1)]; gcut != NULL;
+         gcut = gcut->link)
+      {  if (gcut->hash == hash && gcut->type == cut->type)
+            break;
+      }
+      if (gcut == NULL)
+         goto done;
+      for (aij = cut->ptr; aij != NULL; aij = aij->next)
+         len++, work[aij->j] = aij->val;
+      for (; gcut != NULL; gcut = gcut->link)
+      {  if (!(gcut->hash == hash && gcut->type == cut->type &&
+               gcut->len == len)) continue;
+         for (k = 1; k <= len; k++)
+         {  if (work[gcut->ind[k]] != gcut->val[k])
+               break;
+         }
+         if (k > len) break;
+      }
+      for (aij = cut->ptr; aij != NULL; aij = aij->next)
+         work[aij->j] = 0.0;
+done: return gcut;
+}
+
+static void remove_cut(IOSGPOOL *gpool, IOSGCUT *gcut)
+{     /* remove cut from the pool */
+      IOSGCUT **ptr;
+      for (ptr = &gpool->htab[gcut->hash & (gpool->hsize-1)];
+         *ptr != gcut; ptr = &(*ptr)->link)
+         xassert(*ptr != NULL);
+      *ptr = gcut->link;
+      if (gcut->prev == NULL)
+         gpool->head = gcut->next;
+      else
+         gcut->prev->next = gcut->next;
+      if (gcut->next == NULL)
+         gpool->tail = gcut->prev;
+      else
+         gcut->next->prev = gcut->prev;
+      xfree(gcut->ind);
+      xfree(gcut->val);
+      xfree(gcut);
+      gpool->size--;
+      return;
+}
+
+static int fcmp(const void *arg1, const void *arg2)
+{     /* order cuts to be evicted */
+      const IOSGCUT *a = *(IOSGCUT * const *)arg1;
+      const IOSGCUT *b = *(IOSGCUT * const *)arg2;
+      if (a->age > b->age) return -1;
+      if (a->age < b->age) return +1;
+      if (a->eff < b->eff) return -1;
+      if (a->eff > b->eff) return +1;
+      return 0;
+}
+
+static void evict_cuts(IOSGPOOL *gpool)
+{     /* remove oldest and least efficient cuts to free a quarter of
+         the pool */
+      IOSGCUT *gcut, **list;
+      int k, cnt;
+      list = xcalloc(1+gpool->size, sizeof(IOSGCUT *));
+      k = 0;
+      for (gcut = gpool->head; gcut != NULL; gcut = gcut->next)
+         list[++k] = gcut;
+      xassert(k == gpool->size);
+      qsort(&list[1], k, sizeof(IOSGCUT *), fcmp);
+      cnt = gpool->size - (gpool->max - gpool->max / 4);
+      for (k = 1; k <= cnt; k++)
+         remove_cut(gpool, list[k]);
+      gpool->removed += cnt;
+      xfree(list);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_gpool_create - create global cut pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  IOSGPOOL *ios_gpool_create(glp_tree *T);
+*
+*  RETURNS
+*
+*  The routine returns a pointer to the global cut pool, which is empty
+*  and may contain up to T->parm->cut_pool cuts. */
+
+IOSGPOOL *ios_gpool_create(glp_tree *T)
+{     IOSGPOOL *gpool;
+      int k;
+      xassert(T->parm->cut_pool > 0);
+      gpool = xmalloc(sizeof(IOSGPOOL));
+      gpool->size = 0;
+      gpool->max = T->parm->cut_pool;
+      for (gpool->hsize = 16; gpool->hsize < gpool->max;
+         gpool->hsize += gpool->hsize);
+      gpool->htab = xcalloc(gpool->hsize, sizeof(IOSGCUT *));
+      for (k = 0; k < gpool->hsize; k++)
+         gpool->htab[k] = NULL;
+      gpool->head = gpool->tail = NULL;
+      gpool->work = xcalloc(1+T->n, sizeof(double));
+      for (k = 1; k <= T->n; k++)
+         gpool->work[k] = 0.0;
+      gpool->added = gpool->dupl = gpool->reused = gpool->removed = 0;
+      return gpool;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_gpool_sep - re-activate cuts from the global cut pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_gpool_sep(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_gpool_sep adds to the local cut pool every cut from
+*  the global cut pool, which is valid for the current subproblem and
+*  violated at the current point (optimal solution to LP relaxation of
+*  the current subproblem). */
+
+void ios_gpool_sep(glp_tree *T)
+{     IOSGPOOL *gpool = T->gpool;
+      IOSNPD *node;
+      GLPCOL **col = T->mip->col;
+      IOSGCUT *gcut;
+      int k, lo, hi, mid, *path;
+      double s;
+      xassert(gpool != NULL);
+      xassert(T->curr != NULL);
+      if (gpool->size == 0)
+         goto done;
+      /* sequential numbers of subproblems on the path from the root to
+         the current subproblem increase, because a subproblem is
+         created after its parent */
+      path = xcalloc(1+T->curr->level, sizeof(int));
+      for (node = T->curr; node != NULL; node = node->up)
+         path[node->level] = node->seq;
+      for (gcut = gpool->head; gcut != NULL; gcut = gcut->next)
+      {  gcut->age++;
+         /* check if the cut is valid for the current subproblem */
+         lo = 0, hi = T->curr->level;
+         while (lo < hi)
+         {  mid = (lo + hi) / 2;
+            if (path[mid] < gcut->seq)
+               lo = mid + 1;
+            else
+               hi = mid;
+         }
+         if (path[lo] != gcut->seq)
+            continue;
+         /* check if the cut is violated */
+         s = 0.0;
+         for (k = 1; k <= gcut->len; k++)
+            s += gcut->val[k] * col[gcut->ind[k]]->prim;
+         if (gcut->type == GLP_LO)
+            s = gcut->rhs - s;
+         else if (gcut->type == GLP_UP)
+            s = s - gcut->rhs;
+         else
+            s = fabs(s - gcut->rhs);
+         if (s / gcut->norm < EPS * (1.0 + fabs(gcut->rhs)))
+            continue;
+         /* re-activate the cut */
+         ios_add_row(T, T->local, NULL, gcut->klass, 0, gcut->len,
+            gcut->ind, gcut->val, gcut->type, gcut->rhs);
+         gcut->eff = s / gcut->norm;
+         gcut->age = 0;
+         gcut->act = T->curr->seq;
+         gpool->reused++;
+      }
+      xfree(path);
+done: return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_gpool_add - store cuts from the local cut pool in the global
+*  cut pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_gpool_add(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_gpool_add stores all cuts from the local cut pool in
+*  the global cut pool as valid in the subtree rooted at the current
+*  subproblem. If the global pool already contains a cut with the same
+*  left-hand side, which is valid for the current subproblem and is not
+*  weaker, the new cut is considered as a duplicate; otherwise the cut
+*  in the global pool is replaced. Cuts re-activated from the global
+*  pool for the current subproblem are skipped, and each cut in the
+*  pool is counted as a duplicate only once. If the global pool becomes
+*  full, some cuts are evicted from it. The local cut pool remains
+*  unchanged. */
+
+void ios_gpool_add(glp_tree *T)
+{     IOSGPOOL *gpool = T->gpool;
+      GLPCOL **col = T->mip->col;
+      IOSCUT *cut;
+      IOSGCUT *gcut, *same;
+      IOSAIJ *aij;
+      IOSNPD *node;
+      unsigned int hash;
+      int k, dupl;
+      double s, t;
+      xassert(gpool != NULL);
+      xassert(T->curr != NULL);
+      for (cut = T->local->head; cut != NULL; cut = cut->next)
+      {  hash = ios_cut_hash(cut);
+         same = find_cut(gpool, cut, hash);
+         dupl = 0;
+         if (same != NULL && same->act == T->curr->seq)
+         {  /* the cut has been re-activated from the pool */
+            continue;
+         }
+         if (same != NULL)
+         {  /* check if the cut in the pool is valid here */
+            for (node = T->curr; node != NULL; node = node->up)
+            {  if (node->seq <= same->seq) break;
+            }
+            if (node != NULL && node->seq == same->seq &&
+               (cut->type == GLP_LO ? same->rhs >= cut->rhs :
+                cut->type == GLP_UP ? same->rhs <= cut->rhs :
+                same->rhs == cut->rhs))
+            {  /* the new cut is a duplicate */
+               if (!same->dupl)
+                  gpool->dupl++, same->dupl = 1;
+               continue;
+            }
+            /* the new cut replaces the cut in the pool */
+            if (!same->dupl)
+               gpool->dupl++;
+            remove_cut(gpool, same);
+            dupl = 1;
+         }
+         else
+            gpool->added++;
+         /* add new cut to the pool */
+         gcut = xmalloc(sizeof(IOSGCUT));
+         gcut->seq = T->curr->seq;
+         gcut->hash = hash;
+         gcut->klass = cut->klass;
+         gcut->type = cut->type;
+         gcut->rhs = cut->rhs;
+         gcut->len = 0;
+         for (aij = cut->ptr; aij != NULL; aij = aij->next)
+            gcut->len++;
+         gcut->ind = xcalloc(1+gcut->len, sizeof(int));
+         gcut->val = xcalloc(1+gcut->len, sizeof(double));
+         k = 0, s = t = 0.0;
+         for (aij = cut->ptr; aij != NULL; aij = aij->next)
+         {  k++;
+            gcut->ind[k] = aij->j;
+            gcut->val[k] = aij->val;
+            s += aij->val * col[aij->j]->prim;
+            t += aij->val * aij->val;
+         }
+         gcut->norm = sqrt(t);
+         if (gcut->norm < DBL_EPSILON) gcut->norm = DBL_EPSILON;
+         if (cut->type == GLP_LO)
+            s = cut->rhs - s;
+         else if (cut->type == GLP_UP)
+            s = s - cut->rhs;
+         else
+            s = fabs(s - cut->rhs);
+         gcut->eff = (s > 0.0 ? s / gcut->norm : 0.0);
+         gcut->age = 0;
+         gcut->act = 0;
+         gcut->dupl = dupl;
+         gcut->link = gpool->htab[hash & (gpool->hsize-1)];
+         gpool->htab[hash & (gpool->hsize-1)] = gcut;
+         gcut->prev = gpool->tail;
+         gcut->next = NULL;
+         if (gcut->prev == NULL)
+            gpool->head = gcut;
+         else
+            gcut->prev->next = gcut;
+         gpool->tail = gcut;
+         gpool->size++;
+      }
+      /* if the pool is full, evict some cuts */
+      if (gpool->size > gpool->max)
+         evict_cuts(gpool);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_gpool_delete - delete global cut pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_gpool_delete(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_gpool_delete deletes the global cut pool and frees
+*  all the memory allocated to it. */
+
+void ios_gpool_delete(glp_tree *T)
+{     IOSGPOOL *gpool = T->gpool;
+      xassert(gpool != NULL);
+      while (gpool->head != NULL)
+         remove_cut(gpool, gpool->head);
+      xfree(gpool->htab);
+      xfree(gpool->work);
+      xfree(gpool);
+      T->gpool = NULL;
+      return;
+}
+
+/* eof */
@@ -0,0 +1,272 @@
+/* glpios17.c (solution pool) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "glpenv.h"
+#include "glpios.h"
+#include "glpnpp.h"
+
+/***********************************************************************
+*  The solution pool keeps up to sol_pool best integer feasible
+*  solutions found by the search, which are stored in the problem
+*  object passed to glp_intopt (in terms of its columns), so they are
+*  available after the search has been finished.
+*
+*  Two pooled solutions must differ in at least pool_div integer
+*  columns; if a new solution is too close to a pooled one, only the
+*  better of them is kept. Besides, the objective value of a pooled
+*  solution may not be worse than the best known objective value by
+*  more than pool_gap (relative).
+*
+*  While the pool is used, subproblems are pruned only if they cannot
+*  have a solution that would be stored in the pool (see ios_cutoff),
+*  and integer feasible solutions of LP relaxations which are not
+*  better than the incumbent are stored in the pool as well. */
+
+static double limit(glp_tree *T, double z)
+{     /* determine the worst objective value (multiplied by dir) of a
+         solution that may be pooled, if the best one is z */
+      double gap = T->parm->pool_gap;
+      if (gap >= 1e30)
+         return +DBL_MAX;
+      return z + gap * (fabs(z) + DBL_EPSILON);
+}
+
+static int distance(glp_prob *P, const double x[], const double y[],
+      int max)
+{     /* determine the number of integer columns, in which solutions x
+         and y differ; the counting stops on reaching max */
+      int j, d = 0;
+      for (j = 1; j <= P->n && d < max; j++)
+      {  if (P->col[j]->kind == GLP_IV && fabs(x[j] - y[j]) > 0.5)
+            d++;
+      }
+      return d;
+}
+
+static void remove_sol(glp_prob *P, int k)
+{     /* remove k-th solution from the pool */
+      int n = P->sp_n;
+      memmove(&P->sp_obj[k], &P->sp_obj[k+1],
+         (P->sp_cnt - k) * sizeof(double));
+      memmove(&P->sp_x[(k-1)*n+1], &P->sp_x[k*n+1],
+         (P->sp_cnt - k) * n * sizeof(double));
+      P->sp_cnt--;
+      return;
+}
+
+static void add_sol(glp_tree *T, double obj, const double x[])
+{     /* store solution x with objective value obj in the pool */
+      glp_prob *P = T->P;
+      int n = P->n, k, kk;
+      double dir = (P->dir == GLP_MIN ? +1.0 : -1.0), z, best;
+      xassert(T->parm->sol_pool > 0);
+      if (P->sp_max == 0)
+      {  /* create the pool on storing the first solution */
+         P->sp_max = T->parm->sol_pool;
+         P->sp_cnt = 0;
+         P->sp_n = n;
+         P->sp_obj = xcalloc(1+P->sp_max, sizeof(double));
+         P->sp_x = xcalloc(1+P->sp_max*n, sizeof(double));
+      }
+      xassert(P->sp_n == n);
+      z = dir * obj;
+      /* the solution must be close enough to the best known one */
+      best = z;
+      if (ios_incumb(T, &obj) && dir * obj < best)
+         best = dir * obj;
+      if (P->sp_cnt > 0 && dir * P->sp_obj[1] < best)
+         best = dir * P->sp_obj[1];
+      if (z > limit(T, best))
+         goto done;
+      /* the solution must not be too close to a better pooled one */
+      for (k = 1; k <= P->sp_cnt; k++)
+      {  if (dir * P->sp_obj[k] <= z && distance(P, x,
+               &P->sp_x[(k-1)*n], T->parm->pool_div) <
+               T->parm->pool_div)
+            goto done;
+      }
+      /* remove worse pooled solutions which are too close to the new
+         one or not close enough to the best one */
+      for (k = P->sp_cnt; k >= 1; k--)
+      {  if (dir * P->sp_obj[k] > limit(T, best) ||
+             distance(P, x, &P->sp_x[(k-1)*n], T->parm->pool_div) <
+               T->parm->pool_div)
+            remove_sol(P, k);
+      }
+      /* if the pool is full, the worst solution is removed */
+      if (P->sp_cnt == P->sp_max)
+      {  if (dir * P->sp_obj[P->sp_cnt] <= z)
+            goto done;
+         P->sp_cnt--;
+      }
+      /* insert the new solution keeping the order */
+      for (kk = P->sp_cnt + 1; kk > 1; kk--)
+      {  if (dir * P->sp_obj[kk-1] <= z)
+            break;
+      }
+      for (k = P->sp_cnt; k >= kk; k--)
+      {  P->sp_obj[k+1] = P->sp_obj[k];
+         memcpy(&P->sp_x[k*n+1], &P->sp_x[(k-1)*n+1],
+            n * sizeof(double));
+      }
+      P->sp_obj[kk] = dir * z;
+      memcpy(&P->sp_x[(kk-1)*n+1], &x[1], n * sizeof(double));
+      P->sp_cnt++;
+done: return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_spool_add - store new incumbent in solution pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_spool_add(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_spool_add stores the integer feasible solution just
+*  stored in the problem object passed to glp_intopt (which is the new
+*  incumbent) in the solution pool. */
+
+void ios_spool_add(glp_tree *T)
+{     glp_prob *P = T->P;
+      double *x;
+      int j;
+      xassert(P->mip_stat == GLP_FEAS);
+      x = talloc(1+P->n, double);
+      for (j = 1; j <= P->n; j++)
+         x[j] = P->col[j]->mipx;
+      add_sol(T, P->mip_obj, x);
+      tfree(x);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_spool_lp - store integer feasible solution of LP relaxation in
+*  solution pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_spool_lp(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_spool_lp stores the optimal basic solution of LP
+*  relaxation of the current subproblem, which is integer feasible, but
+*  not better than the incumbent, in the solution pool.
+*
+*  If the MIP presolver is used, the solution has to be recovered for
+*  the original problem, for which the postprocessor works on the MIP
+*  solution components; so these components are saved and restored
+*  after the solution has been recovered. */
+
+void ios_spool_lp(glp_tree *T)
+{     glp_prob *mip = T->mip, *P = T->P;
+      int m = mip->m, n = mip->n, i, j, stat, P_stat;
+      double *save, *x, obj, P_obj;
+      if (T->npp == NULL)
+      {  /* the solution is obtained for the original problem */
+         xassert(P == mip);
+         x = talloc(1+n, double);
+         for (j = 1; j <= n; j++)
+         {  GLPCOL *col = mip->col[j];
+            x[j] = (col->kind == GLP_IV ? floor(col->prim + 0.5) :
+               col->prim);
+         }
+         add_sol(T, mip->obj_val, x);
+         tfree(x);
+         goto done;
+      }
+      /* save the incumbent of the transformed and original problems */
+      save = talloc(1+m+n+P->m+P->n, double);
+      for (i = 1; i <= m; i++)
+         save[i] = mip->row[i]->mipx;
+      for (j = 1; j <= n; j++)
+         save[m+j] = mip->col[j]->mipx;
+      for (i = 1; i <= P->m; i++)
+         save[m+n+i] = P->row[i]->mipx;
+      for (j = 1; j <= P->n; j++)
+         save[m+n+P->m+j] = P->col[j]->mipx;
+      stat = mip->mip_stat, obj = mip->mip_obj;
+      P_stat = P->mip_stat, P_obj = P->mip_obj;
+      /* recover the solution for the original problem */
+      mip->mip_stat = GLP_FEAS;
+      mip->mip_obj = mip->obj_val;
+      for (i = 1; i <= m; i++)
+         mip->row[i]->mipx = mip->row[i]->prim;
+      for (j = 1; j <= n; j++)
+      {  GLPCOL *col = mip->col[j];
+         col->mipx = (col->kind == GLP_IV ? floor(col->prim + 0.5) :
+            col->prim);
+      }
+      npp_postprocess(T->npp, mip);
+      npp_unload_sol(T->npp, P);
+      ios_spool_add(T);
+      /* restore the incumbent */
+      for (i = 1; i <= m; i++)
+         mip->row[i]->mipx = save[i];
+      for (j = 1; j <= n; j++)
+         mip->col[j]->mipx = save[m+j];
+      for (i = 1; i <= P->m; i++)
+         P->row[i]->mipx = save[m+n+i];
+      for (j = 1; j <= P->n; j++)
+         P->col[j]->mipx = save[m+n+P->m+j];
+      mip->mip_stat = stat, mip->mip_obj = obj;
+      P->mip_stat = P_stat, P->mip_obj = P_obj;
+      tfree(save);
+done: return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_spool_free - delete solution pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_spool_free(glp_prob *P);
+*
+*  DESCRIPTION
+*
+*  The routine ios_spool_free deletes the solution pool kept in the
+*  specified problem object, if it exists. */
+
+void ios_spool_free(glp_prob *P)
+{     if (P->sp_max != 0)
+      {  xfree(P->sp_obj);
+         xfree(P->sp_x);
+      }
+      P->sp_max = P->sp_cnt = P->sp_n = 0;
+      P->sp_obj = P->sp_x = NULL;
+      return;
+}
+
+/* eof */
@@ -0,0 +1,271 @@
+/* glpios18.c (sub-MIP heuristics) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "glpenv.h"
+#include "glpios.h"
+
+/***********************************************************************
+*  Both heuristics implemented in this file restrict the original MIP
+*  to some neighborhood of the incumbent and solve the resulting sub-
+*  MIP with the same solver, whose effort is limited by the node and
+*  time limits glp_iocp.sub_nodes and glp_iocp.sub_tm_lim. The sub-MIP
+*  is built from the original rows and bounds of columns, i.e. cuts and
+*  local bounds of the current subproblem are not used. The incumbent
+*  value is passed to the sub-MIP as that found by a concurrent solver
+*  (see glp_iocp.inc_fn), so only subproblems which can improve the
+*  incumbent are explored. */
+
+#define RINS_MIN 0.30
+/* RINS is not applied if less than 30% of integer columns are fixed,
+   since the sub-MIP would not be much easier than the original MIP */
+
+#define LB_SIZE 10
+/* local branching neighborhood size, i.e. maximal number of binary
+   columns, whose values may differ from ones in the incumbent */
+
+static double sub_incumb(void *info, double obj)
+{     /* pass the incumbent value to the sub-MIP */
+      glp_tree *T = info;
+      double z;
+      xassert(ios_incumb(T, &z));
+      return z;
+}
+
+static void sub_callback(glp_tree *tree, void *info)
+{     /* terminate the sub-MIP search if the node limit is reached */
+      glp_tree *T = info;
+      int total;
+      if (glp_ios_reason(tree) == GLP_ISELECT)
+      {  glp_ios_tree_size(tree, NULL, NULL, &total);
+         if (total >= T->parm->sub_nodes)
+            glp_ios_terminate(tree);
+      }
+      return;
+}
+
+static glp_prob *create_sub(glp_tree *T)
+{     /* create sub-MIP, which is a copy of the original MIP */
+      glp_prob *mip = T->mip;
+      glp_prob *sub;
+      int m = T->orig_m;
+      int n = T->n;
+      int i, j, k, *num;
+      sub = glp_create_prob();
+      glp_copy_prob(sub, mip, GLP_OFF);
+      /* remove cuts */
+      if (mip->m > m)
+      {  num = xcalloc(1+mip->m-m, sizeof(int));
+         for (i = 1; i <= mip->m-m; i++)
+            num[i] = m+i;
+         glp_del_rows(sub, mip->m-m, num);
+         xfree(num);
+      }
+      /* restore original bounds of rows and columns */
+      for (i = 1; i <= m; i++)
+         glp_set_row_bnds(sub, i, T->orig_type[i], T->orig_lb[i],
+            T->orig_ub[i]);
+      for (j = 1; j <= n; j++)
+      {  k = m+j;
+         glp_set_col_bnds(sub, j, T->orig_type[k], T->orig_lb[k],
+            T->orig_ub[k]);
+      }
+      return sub;
+}
+
+static void solve_sub(glp_tree *T, glp_prob *sub, const char *name)
+{     /* solve sub-MIP and pass its solution to the solver */
+      glp_iocp parm;
+      double *x, tm_lim;
+      int j, ret;
+      glp_init_iocp(&parm);
+      parm.msg_lev = GLP_MSG_OFF;
+      parm.presolve = GLP_ON;
+      parm.sr_heur = T->parm->sr_heur;
+      parm.cb_func = sub_callback;
+      parm.cb_info = T;
+      parm.cb_reasons = GLP_FSELECT;
+      parm.inc_fn = sub_incumb;
+      parm.inc_info = T;
+      /* the sub-MIP search should not exceed the remaining time */
+      tm_lim = (double)T->parm->sub_tm_lim;
+      if (T->parm->tm_lim < INT_MAX)
+      {  double rem = (double)T->parm->tm_lim -
+            1000.0 * xdifftime(xtime(), T->tm_beg);
+         if (tm_lim > rem) tm_lim = rem;
+      }
+      if (tm_lim < 1.0)
+         goto done;
+      parm.tm_lim = (int)tm_lim;
+      ret = glp_intopt(sub, &parm);
+      if (T->parm->msg_lev >= GLP_MSG_DBG)
+         xprintf("%s: sub-MIP ret = %d, status = %d\n", name, ret,
+            sub->mip_stat);
+      if (!(sub->mip_stat == GLP_OPT || sub->mip_stat == GLP_FEAS))
+         goto done;
+      x = xcalloc(1+T->n, sizeof(double));
+      for (j = 1; j <= T->n; j++)
+         x[j] = sub->col[j]->mipx;
+      glp_ios_heur_sol(T, x);
+      xfree(x);
+done: return;
+}
+
+/***********************************************************************
+*  rins_heur - relaxation induced neighborhood search
+*
+*  This routine fixes all integer columns, whose values in optimal
+*  solution to LP relaxation of the current subproblem coincide with
+*  their values in the incumbent, and searches the remaining space.
+*
+*  REFERENCES
+*
+*  E.Danna, E.Rothberg, C.Le Pape. "Exploring relaxation induced
+*  neighborhoods to improve MIP solutions." Math. Program., Ser. A 102,
+*  pp. 71-90 (2005). */
+
+static void rins_heur(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      glp_prob *sub;
+      int n = T->n;
+      int j, nint, nfix;
+      double x;
+      sub = create_sub(T);
+      nint = nfix = 0;
+      for (j = 1; j <= n; j++)
+      {  GLPCOL *col = mip->col[j];
+         if (col->kind != GLP_IV) continue;
+         nint++;
+         x = col->mipx;
+         if (fabs(col->prim - x) <= T->parm->tol_int)
+         {  glp_set_col_bnds(sub, j, GLP_FX, x, x);
+            nfix++;
+         }
+      }
+      if (T->parm->msg_lev >= GLP_MSG_DBG)
+         xprintf("RINS: %d of %d integer columns fixed\n", nfix, nint);
+      if (nfix < nint && (double)nfix >= RINS_MIN * (double)nint)
+         solve_sub(T, sub, "RINS");
+      glp_delete_prob(sub);
+      return;
+}
+
+/***********************************************************************
+*  lb_heur - local branching
+*
+*  This routine adds to the original MIP the local branching constraint
+*
+*     sum (1 - x[j]) + sum x[j] <= k,
+*    j in J1         j in J0
+*
+*  where J1 and J0 are sets of binary columns having values 1 and 0 in
+*  the incumbent, respectively, and searches the resulting space.
+*
+*  REFERENCES
+*
+*  M.Fischetti, A.Lodi. "Local branching." Math. Program., Ser. B 98,
+*  pp. 23-47 (2003). */
+
+static void lb_heur(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      glp_prob *sub;
+      int m = T->orig_m;
+      int n = T->n;
+      int i, j, k, len, n1, *ind;
+      double *val;
+      ind = xcalloc(1+n, sizeof(int));
+      val = xcalloc(1+n, sizeof(double));
+      len = n1 = 0;
+      for (j = 1; j <= n; j++)
+      {  GLPCOL *col = mip->col[j];
+         k = m+j;
+         if (!(col->kind == GLP_IV && T->orig_type[k] == GLP_DB &&
+               T->orig_lb[k] == 0.0 && T->orig_ub[k] == 1.0))
+            continue;
+         len++;
+         ind[len] = j;
+         if (col->mipx != 0.0)
+            val[len] = -1.0, n1++;
+         else
+            val[len] = +1.0;
+      }
+      if (T->parm->msg_lev >= GLP_MSG_DBG)
+         xprintf("Local branching: %d binary columns\n", len);
+      /* the neighborhood should not cover the whole space */
+      if (len > LB_SIZE)
+      {  sub = create_sub(T);
+         i = glp_add_rows(sub, 1);
+         glp_set_row_bnds(sub, i, GLP_UP, 0.0, (double)(LB_SIZE - n1));
+         glp_set_mat_row(sub, i, len, ind, val);
+         solve_sub(T, sub, "Local branching");
+         glp_delete_prob(sub);
+      }
+      xfree(ind);
+      xfree(val);
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_sub_heur - sub-MIP heuristics
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_sub_heur(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_sub_heur tries to improve the incumbent with RINS
+*  (if glp_iocp.rins_heur is on) and local branching (if glp_iocp.
+*  lb_heur is on). It is called once for each subproblem after its LP
+*  relaxation has been solved for the first time, and it applies the
+*  heuristics to the root subproblem and then to every sub_freq-th
+*  subproblem. Local branching is applied only if the incumbent has
+*  been changed since its last application. */
+
+void ios_sub_heur(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      xassert(glp_get_status(mip) == GLP_OPT);
+      if (T->curr->solved != 1)
+         goto done;
+      /* both heuristics improve the incumbent */
+      if (mip->mip_stat != GLP_FEAS)
+         goto done;
+      if (T->sub_skip > 0)
+      {  T->sub_skip--;
+         goto done;
+      }
+      T->sub_skip = T->parm->sub_freq - 1;
+      if (T->parm->rins_heur)
+         rins_heur(T);
+      if (T->parm->lb_heur && mip->mip_obj != T->lb_obj)
+      {  lb_heur(T);
+         /* the incumbent may have been improved */
+         T->lb_obj = mip->mip_obj;
+      }
+done: return;
+}
+
+/* eof */
@@ -0,0 +1,880 @@
+/* glpios19.c (checkpoint and resume of the search) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include "glpenv.h"
+#include "glpios.h"
+
+/***********************************************************************
+*  A checkpoint is a binary file, which keeps the state of the search
+*  needed to continue it:
+*
+*  the signature of the problem (rows, columns, constraint matrix and
+*  objective), so a checkpoint cannot be applied to other problem;
+*
+*  the node and solution counts;
+*
+*  the incumbent (values of columns);
+*
+*  history information used on pseudocost branching;
+*
+*  globally valid cuts from the global cut pool;
+*
+*  all active subproblems, each of which is stored as its local bound
+*  along with types and bounds of columns, which differ from ones in
+*  the original problem.
+*
+*  Numbers are stored in the native binary format, so a checkpoint can
+*  be read only on the platform, where it was written. Cuts of active
+*  subproblems are not stored, since they can be separated again.
+*
+*  The checkpoint is built in memory by the search thread, while the
+*  file is written by a separate thread, so the search is not stalled
+*  by i/o. The data are written to a temporary file, which then replaces
+*  the checkpoint, so the latter is always complete. Next checkpoint is
+*  not built until the previous one has been written.
+*
+*  To resume the search the root subproblem is processed as usual, and
+*  then, instead of branching, it is split into the subproblems stored
+*  in the checkpoint, whose bounds are intersected with bounds of the
+*  root subproblem (the latter may be tightened by the preprocessing or
+*  reduced cost fixing using the incumbent). */
+
+#define MAGIC "GLPKCKP1"
+/* signature of the file format */
+
+typedef struct IOSCKPT IOSCKPT;
+
+struct IOSCKPT
+{     /* checkpoint data */
+      unsigned int sig;
+      /* signature of the problem */
+      double tm_last;
+      /* time, at which the last checkpoint was built */
+      /*--------------------------------------------------------------*/
+      /* checkpoint being written */
+      char *fname;
+      /* name of the checkpoint file */
+      char *tmp;
+      /* name of the temporary file */
+      unsigned char *buf; /* uchar buf[size]; */
+      /* checkpoint data */
+      size_t len, size;
+      /* current length and size of the buffer */
+      int busy;
+      /* the writer thread is running */
+      pthread_t tid;
+      /* writer thread */
+      int err;
+      /* error code set by the writer thread (0 means no error) */
+      /*--------------------------------------------------------------*/
+      /* checkpoint being resumed */
+      unsigned char *rbuf; /* uchar rbuf[rlen]; */
+      /* contents of the checkpoint file; NULL means that the search
+         has been resumed (or is not resumed) */
+      size_t rlen;
+      /* length of the contents */
+      size_t cut_pos, node_pos;
+      /* offsets of the cuts and active subproblems */
+};
+
+static unsigned int fnv(unsigned int h, const void *x, size_t len)
+{     /* add bytes to FNV-1a hash */
+      const unsigned char *b = x;
+      size_t k;
+      for (k = 0; k < len; k++)
+         h = (h ^ b[k]) * 16777619U;
+      return h;
+}
+
+static unsigned int signature(glp_tree *T)
+{     /* compute signature of the problem */
+      glp_prob *mip = T->mip;
+      int m = T->orig_m;
+      int n = T->n;
+      int k;
+      unsigned int h = 2166136261U;
+      GLPAIJ *aij;
+      h = fnv(h, &m, sizeof(int));
+      h = fnv(h, &n, sizeof(int));
+      h = fnv(h, &mip->dir, sizeof(int));
+      h = fnv(h, &mip->c0, sizeof(double));
+      for (k = 1; k <= m+n; k++)
+      {  h = fnv(h, &T->orig_type[k], 1);
+         h = fnv(h, &T->orig_lb[k], sizeof(double));
+         h = fnv(h, &T->orig_ub[k], sizeof(double));
+      }
+      for (k = 1; k <= n; k++)
+      {  GLPCOL *col = mip->col[k];
+         h = fnv(h, &col->kind, sizeof(int));
+         h = fnv(h, &col->coef, sizeof(double));
+         for (aij = col->ptr; aij != NULL; aij = aij->c_next)
+         {  /* only rows of the original problem */
+            if (aij->row->i > m) continue;
+            h = fnv(h, &aij->row->i, sizeof(int));
+            h = fnv(h, &aij->val, sizeof(double));
+         }
+      }
+      return h;
+}
+
+static IOSCKPT *get_ckpt(glp_tree *T)
+{     /* obtain checkpoint data, creating them if necessary */
+      IOSCKPT *ckpt = T->ckpt;
+      if (ckpt == NULL)
+      {  ckpt = T->ckpt = xmalloc(sizeof(IOSCKPT));
+         memset(ckpt, 0, sizeof(IOSCKPT));
+         ckpt->sig = signature(T);
+         ckpt->tm_last = T->tm_beg;
+      }
+      return ckpt;
+}
+
+/**********************************************************************/
+
+static void put(IOSCKPT *ckpt, const void *x, size_t len)
+{     /* append bytes to the checkpoint */
+      if (ckpt->size - ckpt->len < len)
+      {  unsigned char *save = ckpt->buf;
+         size_t size = ckpt->size + ckpt->size;
+         if (size < ckpt->len + len)
+            size = ckpt->len + len + 4096;
+         ckpt->buf = xmalloc(size);
+         if (save != NULL)
+         {  memcpy(ckpt->buf, save, ckpt->len);
+            xfree(save);
+         }
+         ckpt->size = size;
+      }
+      memcpy(&ckpt->buf[ckpt->len], x, len);
+      ckpt->len += len;
+      return;
+}
+
+static void put_int(IOSCKPT *ckpt, int x)
+{     put(ckpt, &x, sizeof(int));
+      return;
+}
+
+static void put_dbl(IOSCKPT *ckpt, double x)
+{     put(ckpt, &x, sizeof(double));
+      return;
+}
+
+static void put_byte(IOSCKPT *ckpt, int x)
+{     unsigned char b = (unsigned char)x;
+      put(ckpt, &b, 1);
+      return;
+}
+
+static void build(glp_tree *T, IOSCKPT *ckpt)
+{     /* build checkpoint of the search */
+      glp_prob *mip = T->mip;
+      int m = T->orig_m;
+      int n = T->n;
+      IOSNPD *node;
+      IOSGCUT *gcut;
+      int j, k, cnt, pc[2], *chg;
+      double pcs[2], *lb, *ub;
+      unsigned char *type;
+      ckpt->len = 0;
+      put(ckpt, MAGIC, 8);
+      put_int(ckpt, m);
+      put_int(ckpt, n);
+      put(ckpt, &ckpt->sig, sizeof(unsigned int));
+      put_int(ckpt, T->t_cnt);
+      put_int(ckpt, T->sol_cnt);
+      /* incumbent */
+      put_int(ckpt, mip->mip_stat == GLP_FEAS);
+      if (mip->mip_stat == GLP_FEAS)
+      {  for (j = 1; j <= n; j++)
+            put_dbl(ckpt, mip->col[j]->mipx);
+      }
+      /* pseudocosts */
+      put_int(ckpt, T->pcost != NULL);
+      if (T->pcost != NULL)
+      {  for (j = 1; j <= n; j++)
+         {  ios_pcost_get(T, j, pc, pcs);
+            put(ckpt, pc, sizeof(pc));
+            put(ckpt, pcs, sizeof(pcs));
+         }
+      }
+      /* globally valid cuts; the root subproblem has sequential number
+         1 (see ios_create_tree) */
+      cnt = 0;
+      if (T->gpool != NULL)
+      {  for (gcut = T->gpool->head; gcut != NULL; gcut = gcut->next)
+            if (gcut->seq == 1) cnt++;
+      }
+      put_int(ckpt, cnt);
+      if (cnt > 0)
+      {  for (gcut = T->gpool->head; gcut != NULL; gcut = gcut->next)
+         {  if (gcut->seq != 1) continue;
+            put_byte(ckpt, gcut->klass);
+            put_byte(ckpt, gcut->type);
+            put_dbl(ckpt, gcut->rhs);
+            put_int(ckpt, gcut->len);
+            for (k = 1; k <= gcut->len; k++)
+            {  put_int(ckpt, gcut->ind[k]);
+               put_dbl(ckpt, gcut->val[k]);
+            }
+         }
+      }
+      /* active subproblems */
+      type = xcalloc(1+n, sizeof(unsigned char));
+      lb = xcalloc(1+n, sizeof(double));
+      ub = xcalloc(1+n, sizeof(double));
+      chg = xcalloc(1+n, sizeof(int));
+      put_int(ckpt, T->a_cnt);
+      for (node = T->head; node != NULL; node = node->next)
+      {  if (node == T->curr)
+         {  /* the current subproblem is kept in the problem object */
+            for (j = 1; j <= n; j++)
+            {  GLPCOL *col = mip->col[j];
+               type[j] = (unsigned char)col->type;
+               lb[j] = col->lb, ub[j] = col->ub;
+            }
+         }
+         else
+            ios_node_bnds(T, node, type, lb, ub);
+         cnt = 0;
+         for (j = 1; j <= n; j++)
+         {  if (!(type[j] == T->orig_type[m+j] &&
+                  lb[j] == T->orig_lb[m+j] && ub[j] == T->orig_ub[m+j]))
+               chg[++cnt] = j;
+         }
+         put_dbl(ckpt, node->bound);
+         put_int(ckpt, cnt);
+         for (k = 1; k <= cnt; k++)
+         {  j = chg[k];
+            put_int(ckpt, j);
+            put_byte(ckpt, type[j]);
+            put_dbl(ckpt, lb[j]);
+            put_dbl(ckpt, ub[j]);
+         }
+      }
+      xfree(type);
+      xfree(lb);
+      xfree(ub);
+      xfree(chg);
+      put(ckpt, MAGIC, 8);
+      return;
+}
+
+static void *writer(void *arg)
+{     /* write checkpoint to temporary file and then replace the
+         checkpoint file with it; note that no GLPK routines may be
+         called here, since this thread has no environment */
+      IOSCKPT *ckpt = arg;
+      FILE *fp;
+      fp = fopen(ckpt->tmp, "wb");
+      if (fp == NULL)
+      {  ckpt->err = errno;
+         goto done;
+      }
+      if (fwrite(ckpt->buf, 1, ckpt->len, fp) != ckpt->len)
+         ckpt->err = errno;
+      if (fclose(fp) != 0 && ckpt->err == 0)
+         ckpt->err = errno;
+      if (ckpt->err == 0 && rename(ckpt->tmp, ckpt->fname) != 0)
+         ckpt->err = errno;
+      if (ckpt->err != 0)
+         remove(ckpt->tmp);
+done: return NULL;
+}
+
+static void finish(glp_tree *T, IOSCKPT *ckpt)
+{     /* wait for the writer thread to finish */
+      if (ckpt->busy)
+      {  pthread_join(ckpt->tid, NULL);
+         ckpt->busy = 0;
+         if (ckpt->err != 0 && T->parm->msg_lev >= GLP_MSG_ERR)
+            xprintf("Unable to write checkpoint to '%s' - %s\n",
+               ckpt->fname, strerror(ckpt->err ? ckpt->err : EIO));
+      }
+      return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_ckpt_save - write checkpoint of the search
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_ckpt_save(glp_tree *T, int force);
+*
+*  DESCRIPTION
+*
+*  The routine ios_ckpt_save builds checkpoint of the search and starts
+*  writing it to the file specified by the control parameter ckpt_file,
+*  if the time specified by the control parameter ckpt_int has passed
+*  since the previous checkpoint or if the flag force is set. The file
+*  is written by a separate thread (see comments at the beginning of
+*  this file). */
+
+void ios_ckpt_save(glp_tree *T, int force)
+{     IOSCKPT *ckpt;
+      xassert(T->parm->ckpt_file != NULL);
+      ckpt = get_ckpt(T);
+      if (!force && (double)(T->parm->ckpt_int - 1) >
+            1000.0 * xdifftime(xtime(), ckpt->tm_last))
+         goto done;
+      /* the checkpoint being resumed has not been applied yet or the
+         search has not been started yet */
+      if (ckpt->rbuf != NULL)
+         goto done;
+      if (T->root_type == NULL && T->head != NULL &&
+          T->head != T->curr)
+         goto done;
+      finish(T, ckpt);
+      if (ckpt->fname == NULL)
+      {  const char *fname = T->parm->ckpt_file;
+         ckpt->fname = xmalloc(strlen(fname)+1);
+         strcpy(ckpt->fname, fname);
+         ckpt->tmp = xmalloc(strlen(fname)+4+1);
+         sprintf(ckpt->tmp, "%s.tmp", fname);
+      }
+      build(T, ckpt);
+      ckpt->tm_last = xtime();
+      if (T->parm->msg_lev >= GLP_MSG_DBG)
+         xprintf("Writing checkpoint (%d active subproblems) to '%s'"
+            "...\n", T->a_cnt, ckpt->fname);
+      ckpt->err = 0;
+      if (pthread_create(&ckpt->tid, NULL, writer, ckpt) == 0)
+         ckpt->busy = 1;
+      else
+      {  /* write the checkpoint in this thread */
+         writer(ckpt);
+         ckpt->busy = 1, finish(T, ckpt);
+      }
+done: return;
+}
+
+/**********************************************************************/
+
+struct rd
+{     /* reader of checkpoint */
+      const unsigned char *ptr, *end;
+      /* current position and end of data */
+      int err;
+      /* data are truncated */
+};
+
+static void get(struct rd *r, void *x, size_t len)
+{     /* fetch bytes */
+      if (r->err || (size_t)(r->end - r->ptr) < len)
+      {  r->err = 1;
+         memset(x, 0, len);
+      }
+      else
+      {  memcpy(x, r->ptr, len);
+         r->ptr += len;
+      }
+      return;
+}
+
+static int get_int(struct rd *r)
+{     int x;
+      get(r, &x, sizeof(int));
+      return x;
+}
+
+static double get_dbl(struct rd *r)
+{     double x;
+      get(r, &x, sizeof(double));
+      return x;
+}
+
+static int get_byte(struct rd *r)
+{     unsigned char b;
+      get(r, &b, 1);
+      return b;
+}
+
+static int check_bnds(int type, double lb, double ub)
+{     /* check type and bounds of column */
+      switch (type)
+      {  case GLP_FR: case GLP_LO: case GLP_UP:
+            return 1;
+         case GLP_DB:
+            return lb < ub;
+         case GLP_FX:
+            return lb == ub;
+         default:
+            return 0;
+      }
+}
+
+static int skip_cuts(struct rd *r, int n)
+{     /* skip cuts (returns non-zero, if data are invalid) */
+      int cnt, t, len, k, j, type;
+      cnt = get_int(r);
+      if (cnt < 0) return 1;
+      for (t = 1; t <= cnt && !r->err; t++)
+      {  get_byte(r);
+         type = get_byte(r);
+         if (!(type == GLP_LO || type == GLP_UP || type == GLP_FX))
+            return 1;
+         get_dbl(r);
+         len = get_int(r);
+         if (!(0 <= len && len <= n)) return 1;
+         for (k = 1; k <= len; k++)
+         {  j = get_int(r);
+            if (!(1 <= j && j <= n)) return 1;
+            get_dbl(r);
+         }
+      }
+      return r->err;
+}
+
+static int skip_nodes(struct rd *r, int n)
+{     /* skip active subproblems (returns non-zero, if data are
+         invalid) */
+      int cnt, t, len, k, j, type;
+      double lb, ub;
+      cnt = get_int(r);
+      if (cnt < 0) return 1;
+      for (t = 1; t <= cnt && !r->err; t++)
+      {  get_dbl(r);
+         len = get_int(r);
+         if (!(0 <= len && len <= n)) return 1;
+         for (k = 1; k <= len; k++)
+         {  j = get_int(r);
+            if (!(1 <= j && j <= n)) return 1;
+            type = get_byte(r);
+            lb = get_dbl(r);
+            ub = get_dbl(r);
+            if (!r->err && !check_bnds(type, lb, ub)) return 1;
+         }
+      }
+      return r->err;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_ckpt_load - read checkpoint to resume the search
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  int ios_ckpt_load(glp_tree *T, const char *fname);
+*
+*  DESCRIPTION
+*
+*  The routine ios_ckpt_load reads checkpoint from the specified file
+*  and restores the incumbent, pseudocosts and counts kept in it. Cuts
+*  and subproblems are restored later by the routines ios_ckpt_root and
+*  ios_ckpt_split. The routine should be called just after creating the
+*  tree.
+*
+*  RETURNS
+*
+*  0  The checkpoint has been read.
+*
+*  1  The checkpoint cannot be read or does not match the problem. */
+
+int ios_ckpt_load(glp_tree *T, const char *fname)
+{     glp_prob *mip = T->mip;
+      int n = T->n;
+      IOSCKPT *ckpt;
+      FILE *fp;
+      struct rd r;
+      unsigned char *data = NULL, *save;
+      char magic[8];
+      unsigned int sig;
+      int i, j, t_cnt, sol_cnt, feas, pc, cnt[2], ret = 1;
+      size_t len = 0, size = 0, nb, pos;
+      double obj, sum[2], *x;
+      xassert(T->curr == NULL && T->a_cnt == 1);
+      ckpt = get_ckpt(T);
+      xassert(ckpt->rbuf == NULL);
+      /* read the whole file */
+      fp = fopen(fname, "rb");
+      if (fp == NULL)
+      {  if (T->parm->msg_lev >= GLP_MSG_ERR)
+            xprintf("Unable to open checkpoint '%s' - %s\n", fname,
+               strerror(errno));
+         goto done;
+      }
+      for (;;)
+      {  if (size - len < 4096)
+         {  save = data;
+            size = size + size + 4096;
+            data = xmalloc(size);
+            if (save != NULL)
+            {  memcpy(data, save, len);
+               xfree(save);
+            }
+         }
+         nb = fread(&data[len], 1, size - len, fp);
+         len += nb;
+         if (nb == 0) break;
+      }
+      if (ferror(fp))
+      {  if (T->parm->msg_lev >= GLP_MSG_ERR)
+            xprintf("Read error on checkpoint '%s' - %s\n", fname,
+               strerror(errno));
+         fclose(fp);
+         goto done;
+      }
+      fclose(fp);
+      /* check the data */
+      r.ptr = data, r.end = data + len, r.err = 0;
+      get(&r, magic, 8);
+      if (r.err || memcmp(magic, MAGIC, 8) != 0)
+         goto fmt;
+      i = get_int(&r);
+      j = get_int(&r);
+      get(&r, &sig, sizeof(unsigned int));
+      if (r.err) goto fmt;
+      if (!(i == T->orig_m && j == n && sig == ckpt->sig))
+      {  if (T->parm->msg_lev >= GLP_MSG_ERR)
+            xprintf("Checkpoint '%s' does not match the problem\n",
+               fname);
+         goto done;
+      }
+      t_cnt = get_int(&r);
+      sol_cnt = get_int(&r);
+      feas = get_int(&r);
+      pos = r.ptr - data;
+      if (feas)
+         r.ptr += n * sizeof(double);
+      pc = get_int(&r);
+      if (pc)
+         r.ptr += n * (sizeof(cnt) + sizeof(sum));
+      if (r.ptr > r.end) r.err = 1;
+      ckpt->cut_pos = r.ptr - data;
+      if (r.err || skip_cuts(&r, n)) goto fmt;
+      ckpt->node_pos = r.ptr - data;
+      if (skip_nodes(&r, n)) goto fmt;
+      get(&r, magic, 8);
+      if (r.err || memcmp(magic, MAGIC, 8) != 0 || r.ptr != r.end)
+         goto fmt;
+      /* restore the counts */
+      if (t_cnt > T->t_cnt) T->t_cnt = t_cnt;
+      T->sol_cnt = sol_cnt;
+      r.ptr = data + pos;
+      /* restore the incumbent, unless a better one is known */
+      if (feas)
+      {  x = xcalloc(1+n, sizeof(double));
+         obj = mip->c0;
+         for (j = 1; j <= n; j++)
+         {  x[j] = get_dbl(&r);
+            obj += mip->col[j]->coef * x[j];
+         }
+         if (mip->mip_stat != GLP_FEAS ||
+            (mip->dir == GLP_MIN ? obj < mip->mip_obj :
+             obj > mip->mip_obj))
+         {  mip->mip_stat = GLP_FEAS;
+            mip->mip_obj = obj;
+            for (j = 1; j <= n; j++)
+               mip->col[j]->mipx = x[j];
+            for (i = 1; i <= mip->m; i++)
+            {  GLPROW *row = mip->row[i];
+               GLPAIJ *aij;
+               row->mipx = 0.0;
+               for (aij = row->ptr; aij != NULL; aij = aij->r_next)
+                  row->mipx += aij->val * aij->col->mipx;
+            }
+            ios_process_sol(T);
+         }
+         xfree(x);
+      }
+      get_int(&r);
+      /* restore the pseudocosts */
+      if (pc)
+      {  for (j = 1; j <= n; j++)
+         {  get(&r, cnt, sizeof(cnt));
+            get(&r, sum, sizeof(sum));
+            ios_pcost_set(T, j, cnt, sum);
+         }
+      }
+      xassert(!r.err);
+      ckpt->rbuf = data, ckpt->rlen = len, data = NULL;
+      if (T->parm->msg_lev >= GLP_MSG_ON)
+      {  r.ptr = ckpt->rbuf + ckpt->node_pos, r.end = ckpt->rbuf + len;
+         xprintf("Resuming search from checkpoint '%s' (%d active subp"
+            "roblems)\n", fname, get_int(&r));
+      }
+      ret = 0;
+      goto done;
+fmt:  if (T->parm->msg_lev >= GLP_MSG_ERR)
+         xprintf("Checkpoint '%s' is invalid\n", fname);
+done: if (data != NULL) xfree(data);
+      return ret;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_ckpt_root - restore cuts of checkpoint in the global cut pool
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_ckpt_root(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_ckpt_root stores cuts kept in the checkpoint, which
+*  is being resumed, in the global cut pool (if it is used) as valid in
+*  the whole tree. It should be called when the root subproblem becomes
+*  current for the first time. */
+
+void ios_ckpt_root(glp_tree *T)
+{     IOSCKPT *ckpt = T->ckpt;
+      struct rd r;
+      int cnt, t, k, len, klass, type, *ind;
+      double rhs, *val;
+      xassert(T->curr != NULL && T->curr->level == 0);
+      if (!(ckpt != NULL && ckpt->rbuf != NULL && T->gpool != NULL))
+         goto done;
+      xassert(T->local->size == 0);
+      ind = xcalloc(1+T->n, sizeof(int));
+      val = xcalloc(1+T->n, sizeof(double));
+      r.ptr = ckpt->rbuf + ckpt->cut_pos;
+      r.end = ckpt->rbuf + ckpt->rlen, r.err = 0;
+      cnt = get_int(&r);
+      for (t = 1; t <= cnt; t++)
+      {  klass = get_byte(&r);
+         type = get_byte(&r);
+         rhs = get_dbl(&r);
+         len = get_int(&r);
+         for (k = 1; k <= len; k++)
+         {  ind[k] = get_int(&r);
+            val[k] = get_dbl(&r);
+         }
+         ios_add_row(T, T->local, NULL, klass, 0, len, ind, val, type,
+            rhs);
+      }
+      xassert(!r.err);
+      xfree(ind);
+      xfree(val);
+      ios_gpool_add(T);
+      ios_clear_pool(T, T->local);
+done: return;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_ckpt_split - split root subproblem into subproblems of checkpoint
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  int ios_ckpt_split(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_ckpt_split replaces branching on the current root
+*  subproblem with its splitting into the active subproblems kept in
+*  the checkpoint, which is being resumed. Bounds of columns of every
+*  subproblem are intersected with ones of the root subproblem, and the
+*  subproblem is dropped if the intersection is empty or if its local
+*  bound is not better than the incumbent.
+*
+*  RETURNS
+*
+*  0  The root subproblem has been split, so the current subproblem no
+*     longer exists.
+*
+*  1  The search is not resumed; the root subproblem should be split by
+*     branching as usual.
+*
+*  2  All the subproblems have been dropped, so the root subproblem
+*     should be fathomed. */
+
+static int intersect(GLPCOL *col, int *type, double *lb, double *ub)
+{     /* intersect bounds of column with bounds of the root subproblem
+         (returns non-zero, if the intersection is empty) */
+      double l, u, rl, ru, eps;
+      l = (*type == GLP_FR || *type == GLP_UP ? -DBL_MAX : *lb);
+      u = (*type == GLP_FR || *type == GLP_LO ? +DBL_MAX : *ub);
+      rl = (col->type == GLP_FR || col->type == GLP_UP ? -DBL_MAX :
+         col->lb);
+      ru = (col->type == GLP_FR || col->type == GLP_LO ? +DBL_MAX :
+         col->ub);
+      if (l < rl) l = rl;
+      if (u > ru) u = ru;
+      if (l != -DBL_MAX && u != +DBL_MAX && l >= u)
+      {  eps = 1e-9 * (1.0 + fabs(u));
+         if (l > u + eps) return 1;
+         if (col->kind == GLP_IV && l > u) return 1;
+         l = u;
+      }
+      if (l == -DBL_MAX && u == +DBL_MAX)
+         *type = GLP_FR, *lb = *ub = 0.0;
+      else if (u == +DBL_MAX)
+         *type = GLP_LO, *lb = l, *ub = 0.0;
+      else if (l == -DBL_MAX)
+         *type = GLP_UP, *lb = 0.0, *ub = u;
+      else if (l == u)
+         *type = GLP_FX, *lb = *ub = l;
+      else
+         *type = GLP_DB, *lb = l, *ub = u;
+      return 0;
+}
+
+static int read_node(glp_tree *T, struct rd *r, int type[], double lb[],
+      double ub[], double *bound)
+{     /* read subproblem and intersect its bounds with bounds of the
+         root subproblem kept in the problem object (returns non-zero,
+         if the subproblem should be dropped) */
+      glp_prob *mip = T->mip;
+      int m = T->orig_m;
+      int n = T->n;
+      int j, k, cnt, drop = 0;
+      for (j = 1; j <= n; j++)
+      {  type[j] = T->orig_type[m+j];
+         lb[j] = T->orig_lb[m+j], ub[j] = T->orig_ub[m+j];
+      }
+      *bound = get_dbl(r);
+      cnt = get_int(r);
+      for (k = 1; k <= cnt; k++)
+      {  j = get_int(r);
+         type[j] = get_byte(r);
+         lb[j] = get_dbl(r);
+         ub[j] = get_dbl(r);
+      }
+      for (j = 1; j <= n && !drop; j++)
+         drop = intersect(mip->col[j], &type[j], &lb[j], &ub[j]);
+      if (!drop && !ios_is_hopeful(T, *bound))
+         drop = 1;
+      return drop;
+}
+
+int ios_ckpt_split(glp_tree *T)
+{     glp_prob *mip = T->mip;
+      IOSCKPT *ckpt = T->ckpt;
+      IOSNPD *node;
+      struct rd r;
+      int n = T->n;
+      int j, k, t, cnt, nnn, ret, *type, *ref;
+      double bound, *lb, *ub;
+      unsigned char *keep;
+      xassert(T->curr != NULL && T->curr->level == 0);
+      if (ckpt == NULL || ckpt->rbuf == NULL)
+      {  ret = 1;
+         goto done;
+      }
+      type = xcalloc(1+n, sizeof(int));
+      lb = xcalloc(1+n, sizeof(double));
+      ub = xcalloc(1+n, sizeof(double));
+      /* determine subproblems to be restored */
+      r.ptr = ckpt->rbuf + ckpt->node_pos;
+      r.end = ckpt->rbuf + ckpt->rlen, r.err = 0;
+      cnt = get_int(&r);
+      keep = xcalloc(1+cnt, sizeof(unsigned char));
+      nnn = 0;
+      for (t = 1; t <= cnt; t++)
+      {  keep[t] = (unsigned char)!read_node(T, &r, type, lb, ub,
+            &bound);
+         if (keep[t]) nnn++;
+      }
+      if (T->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Resuming search: %d of %d subproblems restored\n",
+            nnn, cnt);
+      if (nnn == 0)
+      {  ret = 2;
+         goto free;
+      }
+      /* freeze the root subproblem and create its children */
+      ios_freeze_node(T);
+      ref = xcalloc(1+nnn, sizeof(int));
+      ios_clone_node(T, 1, nnn, ref);
+      r.ptr = ckpt->rbuf + ckpt->node_pos;
+      get_int(&r);
+      k = 0;
+      for (t = 1; t <= cnt; t++)
+      {  if (read_node(T, &r, type, lb, ub, &bound))
+         {  xassert(!keep[t]);
+            continue;
+         }
+         xassert(keep[t]);
+         /* the root subproblem is restored on reviving, so bounds are
+            intersected with its bounds as before */
+         ios_revive_node(T, ref[++k]);
+         for (j = 1; j <= n; j++)
+         {  GLPCOL *col = mip->col[j];
+            if (!(col->type == type[j] && col->lb == lb[j] &&
+                  col->ub == ub[j]))
+               glp_set_col_bnds(mip, j, type[j], lb[j], ub[j]);
+         }
+         node = T->curr;
+         ios_freeze_node(T);
+         if (mip->dir == GLP_MIN ? node->bound < bound :
+             node->bound > bound)
+         {  node->bound = bound;
+            ios_heap_update(T, node);
+         }
+      }
+      xassert(k == nnn);
+      xassert(!r.err);
+      xfree(ref);
+      ret = 0;
+free: xfree(type);
+      xfree(lb);
+      xfree(ub);
+      xfree(keep);
+      /* the checkpoint has been resumed */
+      xfree(ckpt->rbuf);
+      ckpt->rbuf = NULL;
+done: return ret;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  ios_ckpt_free - finish writing checkpoint and free its data
+*
+*  SYNOPSIS
+*
+*  #include "glpios.h"
+*  void ios_ckpt_free(glp_tree *T);
+*
+*  DESCRIPTION
+*
+*  The routine ios_ckpt_free waits until the checkpoint being written
+*  is complete and frees all the memory allocated to checkpoint data. */
+
+void ios_ckpt_free(glp_tree *T)
+{     IOSCKPT *ckpt = T->ckpt;
+      xassert(ckpt != NULL);
+      finish(T, ckpt);
+      if (ckpt->fname != NULL) xfree(ckpt->fname);
+      if (ckpt->tmp != NULL) xfree(ckpt->tmp);
+      if (ckpt->buf != NULL) xfree(ckpt->buf);
+      if (ckpt->rbuf != NULL) xfree(ckpt->rbuf);
+      xfree(ckpt);
+      T->ckpt = NULL;
+      return;
+}
+
+/* eof */
@@ -79,6 +79,14 @@ struct csa
          S = U'*U; its non-diagonal elements are stored in U_ptr, U_ind,
          U_val in storage-by-rows format, diagonal elements are stored
          in U_diag */
+      int nsn;
+      /* number of supernodes in the matrix U */
+      int *sn_ptr; /* int sn_ptr[1+m+1]; */
+      /* J-th supernode consists of rows sn_ptr[J], ..., sn_ptr[J+1]-1
+         of the matrix U */
+      MATPOOL *pool;
+      /* pool of threads used to compute and factorize the matrix S;
+         NULL means serial computations */
       int iter;
       /* iteration number (0, 1, 2, ...); iter = 0 corresponds to the
          initial point */
@@ -202,6 +210,13 @@ static void initialize(struct csa *csa)
       csa->U_ind = chol_symbolic(m, csa->S_ptr, csa->S_ind, csa->U_ptr);
       if (csa->parm->msg_lev >= GLP_MSG_ALL)
          xprintf("Matrix L has %d non-zeros\n", csa->U_ptr[m+1]-1 + m);
+      csa->sn_ptr = xcalloc(1+m+1, sizeof(int));
+      csa->nsn = chol_supernodes(m, csa->U_ptr, csa->U_ind, csa->sn_ptr);
+      if (csa->parm->msg_lev >= GLP_MSG_ALL)
+         xprintf("Matrix L has %d supernode(s)\n", csa->nsn);
+      csa->pool = mat_create_pool(csa->parm->num_thr);
+      if (csa->parm->msg_lev >= GLP_MSG_ALL && csa->pool != NULL)
+         xprintf("Using %d threads\n", csa->parm->num_thr);
       csa->U_val = xcalloc(csa->U_ptr[m+1], sizeof(double));
       csa->U_diag = xcalloc(1+m, sizeof(double));
       csa->iter = 0;
@@ -290,14 +305,19 @@ static void AT_by_vec(struct csa *csa, double x[], double y[])
 *
 *  This routine implements numeric phase of Cholesky factorization of
 *  the matrix S = P*A*D*A'*P', which is a permuted matrix of the normal
-*  equation system. Matrix D is assumed to be already computed. */
+*  equation system. Matrix D is assumed to be already computed.
+*
+*  The matrix S is factorized by supernodes; if more than one thread is
+*  allowed by the control parameter num_thr, both computing S and its
+*  factorization are performed in parallel. */
 
 static void decomp_NE(struct csa *csa)
-{     adat_numeric(csa->m, csa->n, csa->P, csa->A_ptr, csa->A_ind,
-         csa->A_val, csa->D, csa->S_ptr, csa->S_ind, csa->S_val,
-         csa->S_diag);
-      chol_numeric(csa->m, csa->S_ptr, csa->S_ind, csa->S_val,
-         csa->S_diag, csa->U_ptr, csa->U_ind, csa->U_val, csa->U_diag);
+{     adat_numeric_mt(csa->pool, csa->m, csa->n, csa->P, csa->A_ptr,
+         csa->A_ind, csa->A_val, csa->D, csa->S_ptr, csa->S_ind,
+         csa->S_val, csa->S_diag);
+      chol_numeric_sn(csa->pool, csa->m, csa->S_ptr, csa->S_ind,
+         csa->S_val, csa->S_diag, csa->U_ptr, csa->U_ind, csa->U_val,
+         csa->U_diag, csa->nsn, csa->sn_ptr);
       return;
 }
 
@@ -816,6 +836,9 @@ static void terminate(struct csa *csa)
       xfree(csa->U_ind);
       xfree(csa->U_val);
       xfree(csa->U_diag);
+      xfree(csa->sn_ptr);
+      if (csa->pool != NULL)
+         mat_delete_pool(csa->pool);
       xfree(csa->phi_min);
       xfree(csa->best_x);
       xfree(csa->best_y);
@@ -840,7 +863,8 @@ static void terminate(struct csa *csa)
 *  1 - problem has no feasible (primal or dual) solution;
 *  2 - no convergence;
 *  3 - iteration limit exceeded;
-*  4 - numeric instability on solving Newtonian system.
+*  4 - numeric instability on solving Newtonian system;
+*  5 - termination requested by the application.
 *
 *  In case of non-zero return code the routine returns the best point,
 *  which has been reached during optimization. */
@@ -913,6 +937,14 @@ static int ipm_main(struct csa *csa)
             status = 3;
             break;
          }
+         /* check if the application requested termination */
+         if (csa->parm->stop_fn != NULL &&
+             csa->parm->stop_fn(csa->parm->stop_info))
+         {  if (csa->parm->msg_lev >= GLP_MSG_ALL)
+               xprintf("SEARCH TERMINATED BY APPLICATION\n");
+            status = 5;
+            break;
+         }
          /* start the next iteration */
          csa->iter++;
          /* factorize normal equation system */
@@ -1018,6 +1050,9 @@ static int ipm_main(struct csa *csa)
 *  GLP_EINSTAB
 *     Numeric instability on solving Newtonian system.
 *
+*  GLP_ESTOP
+*     Termination requested by the application.
+*
 *  In case of non-zero return code the routine returns the best point,
 *  which has been reached during optimization. */
 
@@ -1113,6 +1148,11 @@ int ipm_solve(glp_prob *P, const glp_iptcp *parm)
          P->ipt_stat = GLP_INFEAS;
          ret = GLP_EINSTAB;
       }
+      else if (ret == 5)
+      {  /* termination requested by the application */
+         P->ipt_stat = GLP_INFEAS;
+         ret = GLP_ESTOP;
+      }
       else
          xassert(ret != ret);
       /* store row solution components */
@@ -56,6 +56,7 @@
 		"glpapi19.c",
 		"glpapi20.c",
 		"glpapi21.c",
+		"glpapi22.c",
 		"glpcpx.c",
 		"glpdmx.c",
 		"glpgmp.c",
@@ -74,6 +75,13 @@
 		"glpios10.c",
 		"glpios11.c",
 		"glpios12.c",
+		"glpios13.c",
+		"glpios14.c",
+		"glpios15.c",
+		"glpios16.c",
+		"glpios17.c",
+		"glpios18.c",
+		"glpios19.c",
 		"glpipm.c",
 		"glpmat.c",
 		"glpmpl01.c",
@@ -82,6 +90,8 @@
 		"glpmpl04.c",
 		"glpmpl05.c",
 		"glpmpl06.c",
+		"glpmpl07.c",
+		"glpmpl08.c",
 		"glpmps.c",
 		"glpnet03.c",
 		"glpnet04.c",
@@ -92,6 +102,7 @@
 		"glpnpp04.c",
 		"glpnpp05.c",
 		"glpnpp06.c",
+		"glpnpp07.c",
 		"glprgr.c",
 		"glpscl.c",
 		"glpsdf.c",
@@ -166,6 +177,7 @@
 		"simplex/spxnt.c",
 		"simplex/spxprim.c",
 		"simplex/spxprob.c",
+		"simplex/spxws.c",
 
 		"simplex/spychuzc.c",
 		"simplex/spychuzr.c",
@@ -139,9 +139,14 @@ typedef struct
       int out_frq;            /* spx.out_frq */
       int out_dly;            /* spx.out_dly (milliseconds) */
       int presolve;           /* enable/disable using LP presolver */
-      double foo_bar[36];     /* (reserved) */
+      int (*stop_fn)(void *info); /* termination request callback */
+      void *stop_info;        /* transit pointer passed to stop_fn */
+      double foo_bar[34];     /* (reserved) */
 } glp_smcp;
 
+typedef struct glp_session glp_session;
+/* simplex re-optimization session */
+
 typedef struct
 {     /* interior-point solver control parameters */
       int msg_lev;            /* message level (see glp_smcp) */
@@ -150,7 +155,11 @@ typedef struct
 #define GLP_ORD_QMD        1  /* quotient minimum degree (QMD) */
 #define GLP_ORD_AMD        2  /* approx. minimum degree (AMD) */
 #define GLP_ORD_SYMAMD     3  /* approx. minimum degree (SYMAMD) */
-      double foo_bar[48];     /* (reserved) */
+      int crossover;          /* recover optimal basis (GLP_ON/OFF) */
+      int num_thr;            /* number of threads (1 = serial) */
+      int (*stop_fn)(void *info); /* termination request callback */
+      void *stop_info;        /* transit pointer passed to stop_fn */
+      double foo_bar[44];     /* (reserved) */
 } glp_iptcp;
 
 typedef struct glp_tree glp_tree;
@@ -165,6 +174,7 @@ typedef struct
 #define GLP_BR_MFV         3  /* most fractional variable */
 #define GLP_BR_DTH         4  /* heuristic by Driebeck and Tomlin */
 #define GLP_BR_PCH         5  /* hybrid pseudocost heuristic */
+#define GLP_BR_RLB         6  /* reliability branching */
       int bt_tech;            /* backtracking technique: */
 #define GLP_BT_DFS         1  /* depth first search */
 #define GLP_BT_BFS         2  /* breadth first search */
@@ -207,7 +217,35 @@ typedef struct
       const char *save_sol;   /* filename to save every new solution */
       int alien;              /* use alien solver */
 #endif
-      double foo_bar[24];     /* (reserved) */
+      int threads;            /* number of threads (1 = serial) shared
+                                 by presolving, cut generation, strong
+                                 branching and parallel tree search */
+      int det_mode;           /* deterministic parallel search */
+      int share_cuts;         /* share root cuts with search threads */
+      int node_mem;           /* memory for subproblem data, Kb
+                                 (0 = no limit) */
+      int rel_lim;            /* reliability threshold (GLP_BR_RLB) */
+      int sb_it_lim;          /* strong branching iteration limit */
+      int sb_look;            /* strong branching lookahead */
+      int cut_pool;           /* global cut pool size (0 = disabled) */
+      double (*inc_fn)(void *info, double obj);
+                              /* incumbent exchange callback */
+      void *inc_info;         /* transit pointer passed to inc_fn */
+      int (*stop_fn)(void *info); /* termination request callback */
+      void *stop_info;        /* transit pointer passed to stop_fn */
+      int sol_pool;           /* solution pool size (0 = disabled) */
+      double pool_gap;        /* relative gap of pooled solutions */
+      int pool_div;           /* minimal number of integer columns in
+                                 which pooled solutions differ */
+      int rins_heur;          /* RINS heuristic (GLP_ON/GLP_OFF) */
+      int lb_heur;            /* local branching heuristic */
+      int sub_freq;           /* sub-MIP heuristics frequency, nodes */
+      int sub_nodes;          /* sub-MIP node limit */
+      int sub_tm_lim;         /* sub-MIP time limit, milliseconds */
+      const char *ckpt_file;  /* checkpoint file name (NULL = none) */
+      int ckpt_int;           /* checkpoint interval, milliseconds */
+      const char *resume;     /* checkpoint to resume from (or NULL) */
+      double foo_bar[1];      /* (reserved) */
 } glp_iocp;
 
 typedef struct
@@ -229,6 +267,22 @@ typedef struct
       /* (reserved) */
 } glp_attr;
 
+typedef struct
+{     /* global cut pool statistics */
+      int size;
+      /* number of cuts currently in the pool */
+      int added;
+      /* number of cuts added to the pool */
+      int dupl;
+      /* number of distinct cuts recognized as duplicates */
+      int reused;
+      /* number of cuts re-activated from the pool */
+      int removed;
+      /* number of cuts evicted from the pool */
+      double foo_bar[5];
+      /* (reserved) */
+} glp_gpstat;
+
 /* enable/disable flag: */
 #define GLP_ON             1  /* enable something */
 #define GLP_OFF            0  /* disable something */
@@ -331,6 +385,9 @@ typedef struct {
 typedef struct glp_tran glp_tran;
 /* MathProg translator workspace */
 
+typedef struct glp_prep glp_prep;
+/* LP/MIP preprocessor workspace */
+
 glp_prob *glp_create_prob(void);
 /* create problem object */
 
@@ -393,6 +450,9 @@ void glp_del_cols(glp_prob *P, int ncs, const int num[]);
 void glp_copy_prob(glp_prob *dest, glp_prob *prob, int names);
 /* copy problem object content */
 
+void glp_copy_sol(glp_prob *dest, glp_prob *prob, int sol);
+/* copy solution between problem objects */
+
 void glp_erase_prob(glp_prob *P);
 /* erase problem object content */
 
@@ -504,6 +564,19 @@ int glp_exact(glp_prob *P, const glp_smcp *parm);
 void glp_init_smcp(glp_smcp *parm);
 /* initialize simplex method control parameters */
 
+glp_session *glp_create_session(glp_prob *P);
+/* create simplex re-optimization session */
+
+int glp_session_simplex(glp_session *S, const glp_smcp *parm);
+/* re-optimize LP problem within simplex session */
+
+void glp_session_info(glp_session *S, int *solves, int *rebuilds,
+      int *meth);
+/* retrieve simplex session statistics */
+
+void glp_delete_session(glp_session *S);
+/* delete simplex re-optimization session */
+
 int glp_get_status(glp_prob *P);
 /* retrieve generic status of basic solution */
 
@@ -556,6 +629,9 @@ void glp_init_iptcp(glp_iptcp *parm);
 int glp_ipt_status(glp_prob *P);
 /* retrieve status of interior-point solution */
 
+int glp_ipt_xret(glp_prob *P);
+/* retrieve crossover return code */
+
 double glp_ipt_obj_val(glp_prob *P);
 /* retrieve objective value (interior point) */
 
@@ -607,6 +683,15 @@ double glp_mip_row_val(glp_prob *P, int i);
 double glp_mip_col_val(glp_prob *P, int j);
 /* retrieve column value (MIP solution) */
 
+int glp_mip_pool_size(glp_prob *P);
+/* retrieve number of solutions in solution pool */
+
+double glp_mip_pool_obj(glp_prob *P, int k);
+/* retrieve objective value of pooled solution */
+
+void glp_mip_pool_sol(glp_prob *P, int k, double x[]);
+/* retrieve column values of pooled solution */
+
 void glp_check_kkt(glp_prob *P, int sol, int cond, double *ae_max,
       int *ae_ind, double *re_max, int *re_ind);
 /* check feasibility/optimality conditions */
@@ -746,6 +831,12 @@ void glp_ios_row_attr(glp_tree *T, int i, glp_attr *attr);
 int glp_ios_pool_size(glp_tree *T);
 /* determine current size of the cut pool */
 
+void glp_ios_gpool_stat(glp_tree *T, glp_gpstat *stat);
+/* retrieve global cut pool statistics */
+
+int glp_ios_spill_cnt(glp_tree *T);
+/* determine number of subproblems moved to temporary file */
+
 int glp_ios_add_row(glp_tree *T,
       const char *name, int klass, int flags, int len, const int ind[],
       const double val[], int type, double rhs);
@@ -807,20 +898,91 @@ int glp_mpl_read_model(glp_tran *tran, const char *fname, int skip);
 int glp_mpl_read_data(glp_tran *tran, const char *fname);
 /* read and translate data section */
 
+int glp_mpl_put_set_data(glp_tran *tran, const char *name, int dim,
+      const double snum[], const char *sstr[], int dimen, int n,
+      const double num[], const char *str[]);
+/* assign set data directly */
+
+int glp_mpl_put_par_data(glp_tran *tran, const char *name, int dim,
+      int n, const double snum[], const char *sstr[],
+      const double num[], const char *str[]);
+/* assign parameter data directly */
+
+void glp_mpl_set_threads(glp_tran *tran, int threads);
+/* set number of threads used to generate the model */
+
+int glp_mpl_get_par_cnt(glp_tran *tran);
+/* determine number of constraints generated by worker threads */
+
 int glp_mpl_generate(glp_tran *tran, const char *fname);
 /* generate the model */
 
 void glp_mpl_build_prob(glp_tran *tran, glp_prob *prob);
 /* build LP/MIP problem instance from the model */
 
+void glp_mpl_build_prob1(glp_tran *tran, glp_prob *prob, int names);
+/* build LP/MIP problem instance in one pass */
+
+int glp_mpl_update_par_data(glp_tran *tran, const char *name, int dim,
+      int n, const double snum[], const char *sstr[],
+      const double num[], const char *str[]);
+/* change parameter data of generated model */
+
+int glp_mpl_update(glp_tran *tran);
+/* regenerate model objects depending on changed data */
+
+int glp_mpl_update_prob(glp_tran *tran, glp_prob *prob);
+/* apply changes of updated model to problem instance */
+
 int glp_mpl_postsolve(glp_tran *tran, glp_prob *prob, int sol);
 /* postsolve the model */
 
+int glp_mpl_reset(glp_tran *tran);
+/* discard data and generated content, keep translated model */
+
+const char *glp_mpl_pool_stats(glp_tran *tran, int k, size_t *count,
+      size_t *total);
+/* retrieve statistics of translator memory pool */
+
+void glp_mpl_out_hook(glp_tran *tran, void (*func)(void *info,
+      const char *s), void *info);
+/* install hook to intercept display and printf output */
+
+void glp_mpl_tab_hook(glp_tran *tran, int (*func)(void *info,
+      const char *table, int nf, const char *name[], int nr,
+      const double *num[], const char **str[]), void *info);
+/* install hook to receive records of output tables */
+
 void glp_mpl_free_wksp(glp_tran *tran);
 /* free the MathProg translator workspace */
 
 char* glp_mpl_getlasterror(glp_tran *tran);
 /* get last error message */
+
+glp_prep *glp_npp_alloc_wksp(void);
+/* allocate the preprocessor workspace */
+
+void glp_npp_load_prob(glp_prep *prep, glp_prob *P, int sol,
+      int names);
+/* load original problem instance */
+
+int glp_npp_preprocess1(glp_prep *prep, int hard);
+/* perform preprocessing */
+
+void glp_npp_build_prob(glp_prep *prep, glp_prob *Q);
+/* build resultant problem instance */
+
+int glp_npp_update_obj(glp_prep *prep, glp_prob *P, glp_prob *Q);
+/* update objective of resultant problem */
+
+void glp_npp_postprocess(glp_prep *prep, glp_prob *Q);
+/* postprocess solution to resultant problem */
+
+void glp_npp_obtain_sol(glp_prep *prep, glp_prob *P);
+/* obtain solution to original problem */
+
+void glp_npp_free_wksp(glp_prep *prep);
+/* free the preprocessor workspace */
     
 int glp_main(int argc, const char *argv[]);
 /* stand-alone LP/MIP solver */
@@ -870,6 +1032,11 @@ void glp_term_hook(void (*func)(const char *s));
 #endif
 /* install hook to intercept terminal output */
 
+#ifdef HAVE_ENV
+void *glp_term_info(void);
+/* retrieve transit pointer of terminal hook */
+#endif
+
 int glp_open_tee(const char *name);
 /* start copying terminal output to text file */
 
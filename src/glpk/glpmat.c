@@ -22,6 +22,7 @@
 *  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
 ***********************************************************************/
 
+#include <pthread.h>
 #include "glpenv.h"
 #include "glpmat.h"
 #include "qmd.h"
@@ -356,16 +357,17 @@ int *adat_symbolic(int m, int n, int P_per[], int A_ptr[], int A_ind[],
 -- corresponding locations of the array S_val, and values of diagonal
 -- elements of S are stored in locations S_diag[1], ..., S_diag[n]. */
 
-void adat_numeric(int m, int n, int P_per[],
+static void adat_rows(int P_per[],
       int A_ptr[], int A_ind[], double A_val[], double D_diag[],
-      int S_ptr[], int S_ind[], double S_val[], double S_diag[])
-{     int i, j, t, ii, jj, tt, beg, end, beg1, end1, k;
-      double sum, *work;
-      work = xcalloc(1+n, sizeof(double));
-      for (j = 1; j <= n; j++) work[j] = 0.0;
+      int S_ptr[], int S_ind[], double S_val[], double S_diag[],
+      int ii_beg, int ii_end, double work[])
+{     /* compute rows ii_beg, ..., ii_end-1 of S; on entry and on exit
+         the working array work[1+n] should contain all zeros */
+      int i, j, t, ii, jj, tt, beg, end, beg1, end1, k;
+      double sum;
       /* compute S = B*D*B', where B = P*A, B' is a matrix transposed
          to B */
-      for (ii = 1; ii <= m; ii++)
+      for (ii = ii_beg; ii < ii_end; ii++)
       {  i = P_per[ii]; /* i-th row of A = ii-th row of B */
          /* (work) := (i-th row of A) */
          beg = A_ptr[i], end = A_ptr[i+1];
@@ -395,6 +397,18 @@ void adat_numeric(int m, int n, int P_per[],
          }
          S_diag[ii] = sum;
       }
+      return;
+}
+
+void adat_numeric(int m, int n, int P_per[],
+      int A_ptr[], int A_ind[], double A_val[], double D_diag[],
+      int S_ptr[], int S_ind[], double S_val[], double S_diag[])
+{     int j;
+      double *work;
+      work = xcalloc(1+n, sizeof(double));
+      for (j = 1; j <= n; j++) work[j] = 0.0;
+      adat_rows(P_per, A_ptr, A_ind, A_val, D_diag, S_ptr, S_ind, S_val,
+         S_diag, 1, m+1, work);
       xfree(work);
       return;
 }
@@ -837,6 +851,497 @@ int chol_numeric(int n,
       return count;
 }
 
+/*----------------------------------------------------------------------
+-- mat_create_pool - create pool of worker threads.
+--
+-- *Synopsis*
+--
+-- #include "glpmat.h"
+-- MATPOOL *mat_create_pool(int nthreads);
+--
+-- *Description*
+--
+-- The routine mat_create_pool creates a pool of nthreads-1 worker
+-- threads, which together with the calling thread perform the parallel
+-- numeric routines adat_numeric_mt and chol_numeric_sn.
+--
+-- Worker threads only perform floating-point computations on arrays
+-- allocated by the calling thread. They never call GLPK environment
+-- routines (including memory allocation), because the environment is
+-- thread-local.
+--
+-- *Returns*
+--
+-- The routine returns a pointer to the pool created. If nthreads is
+-- less than 2 or no worker thread can be started, the routine returns
+-- NULL, in which case the numeric routines work serially. */
+
+struct mat_thr
+{     /* worker thread */
+      MATPOOL *pool;
+      /* pool the thread belongs to */
+      int id;
+      /* thread number, 1 <= id < nthreads */
+      pthread_t tid;
+      /* thread identifier */
+};
+
+struct MATPOOL
+{     /* pool of worker threads */
+      int nthreads;
+      /* total number of threads including the calling thread */
+      struct mat_thr *thr; /* struct mat_thr thr[nthreads]; */
+      /* thr[1], ..., thr[nthreads-1] are worker threads */
+      pthread_mutex_t lock;
+      pthread_cond_t go;
+      /* signalled when a new task is posted or the pool is deleted */
+      pthread_cond_t done;
+      /* signalled when the last worker completes the current task */
+      int gen;
+      /* task generation number incremented on posting every task */
+      int busy;
+      /* number of workers which have not completed the current task */
+      int quit;
+      /* flag requesting worker threads to terminate */
+      void (*func)(void *info, int id, int nthreads);
+      void *info;
+      /* current task; it is performed by calling func in every thread
+         with the thread number id, 0 <= id < nthreads */
+};
+
+static void *pool_worker(void *arg)
+{     /* worker thread routine */
+      struct mat_thr *thr = arg;
+      MATPOOL *pool = thr->pool;
+      int gen = 0;
+      for (;;)
+      {  pthread_mutex_lock(&pool->lock);
+         while (pool->gen == gen && !pool->quit)
+            pthread_cond_wait(&pool->go, &pool->lock);
+         if (pool->quit)
+         {  pthread_mutex_unlock(&pool->lock);
+            break;
+         }
+         gen = pool->gen;
+         pthread_mutex_unlock(&pool->lock);
+         pool->func(pool->info, thr->id, pool->nthreads);
+         pthread_mutex_lock(&pool->lock);
+         if (--pool->busy == 0)
+            pthread_cond_signal(&pool->done);
+         pthread_mutex_unlock(&pool->lock);
+      }
+      return NULL;
+}
+
+static void pool_run(MATPOOL *pool, void (*func)(void *info, int id,
+      int nthreads), void *info)
+{     /* perform task in all threads of the pool and wait for its
+         completion; if the pool is not specified, the task is performed
+         in the calling thread only */
+      if (pool == NULL)
+      {  func(info, 0, 1);
+         return;
+      }
+      pthread_mutex_lock(&pool->lock);
+      pool->func = func;
+      pool->info = info;
+      pool->busy = pool->nthreads - 1;
+      pool->gen++;
+      pthread_cond_broadcast(&pool->go);
+      pthread_mutex_unlock(&pool->lock);
+      func(info, 0, pool->nthreads);
+      pthread_mutex_lock(&pool->lock);
+      while (pool->busy > 0)
+         pthread_cond_wait(&pool->done, &pool->lock);
+      pthread_mutex_unlock(&pool->lock);
+      return;
+}
+
+MATPOOL *mat_create_pool(int nthreads)
+{     MATPOOL *pool;
+      int k;
+      if (nthreads < 2)
+         return NULL;
+      pool = xmalloc(sizeof(MATPOOL));
+      pool->nthreads = nthreads;
+      pool->thr = xcalloc(nthreads, sizeof(struct mat_thr));
+      pthread_mutex_init(&pool->lock, NULL);
+      pthread_cond_init(&pool->go, NULL);
+      pthread_cond_init(&pool->done, NULL);
+      pool->gen = pool->busy = pool->quit = 0;
+      pool->func = NULL;
+      pool->info = NULL;
+      for (k = 1; k < nthreads; k++)
+      {  pool->thr[k].pool = pool;
+         pool->thr[k].id = k;
+         if (pthread_create(&pool->thr[k].tid, NULL, pool_worker,
+            &pool->thr[k]) != 0)
+         {  /* use only threads started so far */
+            break;
+         }
+      }
+      pthread_mutex_lock(&pool->lock);
+      pool->nthreads = k;
+      pthread_mutex_unlock(&pool->lock);
+      if (k < 2)
+      {  mat_delete_pool(pool);
+         pool = NULL;
+      }
+      return pool;
+}
+
+/*----------------------------------------------------------------------
+-- mat_delete_pool - delete pool of worker threads.
+--
+-- *Synopsis*
+--
+-- #include "glpmat.h"
+-- void mat_delete_pool(MATPOOL *pool);
+--
+-- *Description*
+--
+-- The routine mat_delete_pool terminates all worker threads of the
+-- specified pool and frees all the memory allocated to it. */
+
+void mat_delete_pool(MATPOOL *pool)
+{     int k;
+      pthread_mutex_lock(&pool->lock);
+      pool->quit = 1;
+      pthread_cond_broadcast(&pool->go);
+      pthread_mutex_unlock(&pool->lock);
+      for (k = 1; k < pool->nthreads; k++)
+         pthread_join(pool->thr[k].tid, NULL);
+      pthread_mutex_destroy(&pool->lock);
+      pthread_cond_destroy(&pool->go);
+      pthread_cond_destroy(&pool->done);
+      xfree(pool->thr);
+      xfree(pool);
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- adat_numeric_mt - compute S = P*A*D*A'*P' (multithreaded).
+--
+-- *Synopsis*
+--
+-- #include "glpmat.h"
+-- void adat_numeric_mt(MATPOOL *pool, int m, int n, int P_per[],
+--    int A_ptr[], int A_ind[], double A_val[], double D_diag[],
+--    int S_ptr[], int S_ind[], double S_val[], double S_diag[]);
+--
+-- *Description*
+--
+-- The routine adat_numeric_mt does the same as the routine adat_numeric
+-- (see above), however, rows of the matrix S are computed in parallel
+-- by threads of the specified pool. Every thread computes a contiguous
+-- range of rows, where ranges are chosen to balance the number of non-
+-- zeros. The result does not depend on the number of threads.
+--
+-- If the parameter pool is NULL, the routine works serially. */
+
+struct adat_task
+{     /* parallel computation of S = P*A*D*A'*P' */
+      int *P_per, *A_ptr, *A_ind;
+      double *A_val, *D_diag;
+      int *S_ptr, *S_ind;
+      double *S_val, *S_diag;
+      int *part; /* int part[1+nthreads]; */
+      /* id-th thread computes rows part[id], ..., part[id+1]-1 */
+      double *work; /* double work[nthreads*(1+n)]; */
+      /* working arrays of all threads */
+      int n;
+};
+
+static void adat_worker(void *info, int id, int nthreads)
+{     /* compute rows of S assigned to id-th thread */
+      struct adat_task *task = info;
+      adat_rows(task->P_per, task->A_ptr, task->A_ind, task->A_val,
+         task->D_diag, task->S_ptr, task->S_ind, task->S_val,
+         task->S_diag, task->part[id], task->part[id+1],
+         task->work + id * (1+task->n));
+      return;
+}
+
+void adat_numeric_mt(MATPOOL *pool, int m, int n, int P_per[],
+      int A_ptr[], int A_ind[], double A_val[], double D_diag[],
+      int S_ptr[], int S_ind[], double S_val[], double S_diag[])
+{     struct adat_task _task, *task = &_task;
+      int ii, id, nthreads;
+      double total, sum;
+      if (pool == NULL)
+      {  adat_numeric(m, n, P_per, A_ptr, A_ind, A_val, D_diag, S_ptr,
+            S_ind, S_val, S_diag);
+         return;
+      }
+      nthreads = pool->nthreads;
+      task->P_per = P_per, task->A_ptr = A_ptr, task->A_ind = A_ind;
+      task->A_val = A_val, task->D_diag = D_diag;
+      task->S_ptr = S_ptr, task->S_ind = S_ind;
+      task->S_val = S_val, task->S_diag = S_diag;
+      task->n = n;
+      task->work = xcalloc(nthreads * (1+n), sizeof(double));
+      memset(task->work, 0, nthreads * (1+n) * sizeof(double));
+      /* split rows of S into ranges having nearly the same number of
+         elements (including diagonal ones) */
+      task->part = xcalloc(1+nthreads, sizeof(int));
+      total = (double)(S_ptr[m+1] - S_ptr[1] + m);
+      task->part[0] = 1;
+      id = 1, sum = 0.0;
+      for (ii = 1; ii <= m && id < nthreads; ii++)
+      {  sum += (double)(S_ptr[ii+1] - S_ptr[ii] + 1);
+         while (id < nthreads && sum >= total * (double)id /
+            (double)nthreads)
+            task->part[id++] = ii+1;
+      }
+      while (id <= nthreads)
+         task->part[id++] = m+1;
+      pool_run(pool, adat_worker, task);
+      xfree(task->work);
+      xfree(task->part);
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- chol_supernodes - determine supernodes of Cholesky factor.
+--
+-- *Synopsis*
+--
+-- #include "glpmat.h"
+-- int chol_supernodes(int n, int U_ptr[], int U_ind[], int sn_ptr[]);
+--
+-- *Description*
+--
+-- The routine chol_supernodes partitions rows of the upper triangular
+-- factor U (whose pattern has been computed by the routine
+-- chol_symbolic) into fundamental supernodes.
+--
+-- A supernode is a set of consecutive rows f, f+1, ..., l such that the
+-- pattern of each row k < l is {k+1} united with the pattern of row
+-- k+1. Thus, non-zeros of the supernode form a dense trapezoid, whose
+-- rows differ only in the leading diagonal block, and all rows have
+-- the same pattern R (the pattern of row l) outside of that block.
+--
+-- On exit the routine sorts column indices in every row of the array
+-- U_ind in ascending order (this does not change the matrix U) and
+-- stores the first row of J-th supernode in location sn_ptr[J] for
+-- J = 1, ..., nsn, and n+1 in location sn_ptr[nsn+1], where nsn is the
+-- number of supernodes. The array sn_ptr should have at least 1+n+1
+-- locations.
+--
+-- *Returns*
+--
+-- The routine returns nsn, the number of supernodes. */
+
+static int icmp(const void *p1, const void *p2)
+{     /* this routine is passed to the qsort() function */
+      int i1 = *(const int *)p1, i2 = *(const int *)p2;
+      return i1 < i2 ? -1 : i1 > i2 ? +1 : 0;
+}
+
+int chol_supernodes(int n, int U_ptr[], int U_ind[], int sn_ptr[])
+{     int k, len, nsn;
+      for (k = 1; k <= n; k++)
+         qsort(&U_ind[U_ptr[k]], U_ptr[k+1] - U_ptr[k], sizeof(int),
+            icmp);
+      nsn = 0;
+      for (k = 1; k <= n; k++)
+      {  /* row k continues the current supernode, if the pattern of row
+            k-1 is {k} united with the pattern of row k */
+         len = U_ptr[k+1] - U_ptr[k];
+         if (k > 1 && U_ptr[k] - U_ptr[k-1] == len + 1 &&
+             U_ind[U_ptr[k-1]] == k &&
+             memcmp(&U_ind[U_ptr[k-1]+1], &U_ind[U_ptr[k]],
+               len * sizeof(int)) == 0)
+            continue;
+         sn_ptr[++nsn] = k;
+      }
+      sn_ptr[nsn+1] = n+1;
+      return nsn;
+}
+
+/*----------------------------------------------------------------------
+-- chol_numeric_sn - compute Cholesky factorization (supernodal).
+--
+-- *Synopsis*
+--
+-- #include "glpmat.h"
+-- int chol_numeric_sn(MATPOOL *pool, int n,
+--    int A_ptr[], int A_ind[], double A_val[], double A_diag[],
+--    int U_ptr[], int U_ind[], double U_val[], double U_diag[],
+--    int nsn, int sn_ptr[]);
+--
+-- *Description*
+--
+-- The routine chol_numeric_sn computes the same factorization as the
+-- routine chol_numeric (and treats non-positive pivots in the same
+-- way), however, it processes the matrix U by supernodes, which are
+-- specified in the arrays sn_ptr and U_ind as computed by the routine
+-- chol_supernodes.
+--
+-- Elimination of supernode J = {f, ..., l} with the common pattern R,
+-- |R| = r, consists of two stages.
+--
+-- First, the rows of the supernode are factorized. Since the pattern
+-- of row i, f < i <= l, is a tail of the pattern of any row k < i of
+-- the supernode, this stage involves only dense operations on
+-- contiguous parts of the rows.
+--
+-- Second, the active submatrix is updated: s[a,b] -= sum u[k,a]*u[k,b]
+-- for all a, b in R, a <= b, where k runs over the supernode. Elements
+-- u[k,a] for a in R form a dense (l-f+1) x r block, so the update is
+-- computed as a dense product, which is then scattered into rows a of
+-- the matrix U. Rows of the active submatrix are updated in blocks of
+-- SN_BLK rows to reuse the rows of the dense block while they are in
+-- cache. Large updates are distributed among threads of the specified
+-- pool (if pool is not NULL); every row is updated by one thread only,
+-- so the result does not depend on the number of threads.
+--
+-- *Returns*
+--
+-- The routine returns the number of non-positive diagonal elements of
+-- the matrix U which have been replaced by a huge positive number. */
+
+#define SN_BLK 4
+/* number of rows of the active submatrix updated together */
+
+#define SN_PAR_MIN 50000.0
+/* minimal number of flops in an update to be performed in parallel */
+
+struct sn_task
+{     /* update of the active submatrix by one supernode */
+      int *U_ptr, *U_ind;
+      double *U_val, *U_diag;
+      int f, l;
+      /* supernode rows */
+      int r;
+      int *R; /* int R[r]; */
+      /* common pattern of the supernode rows */
+      double *w; /* double w[nthreads*SN_BLK*r]; */
+      /* working arrays of all threads */
+};
+
+static void sn_update(void *info, int id, int nthreads)
+{     struct sn_task *task = info;
+      int *U_ptr = task->U_ptr;
+      int *U_ind = task->U_ind;
+      double *U_val = task->U_val;
+      double *U_diag = task->U_diag;
+      int f = task->f, l = task->l, r = task->r, *R = task->R;
+      double *w = task->w + id * SN_BLK * r;
+      int a, b, i, k, nb, p, p0, q, t;
+      double bp, *row, *wi;
+      /* blocks of SN_BLK rows of the active submatrix are distributed
+         among threads cyclically */
+      for (p0 = id * SN_BLK; p0 < r; p0 += nthreads * SN_BLK)
+      {  nb = (r - p0 < SN_BLK ? r - p0 : SN_BLK);
+         for (i = 0; i < nb; i++)
+         {  wi = w + i * r;
+            for (q = p0 + i; q < r; q++) wi[q] = 0.0;
+         }
+         /* w[i,q] := sum u[k,R[p0+i]] * u[k,R[q]] over the supernode */
+         for (k = f; k <= l; k++)
+         {  row = &U_val[U_ptr[k] + (l - k)];
+            for (i = 0; i < nb; i++)
+            {  p = p0 + i;
+               bp = row[p];
+               if (bp == 0.0) continue;
+               wi = w + i * r;
+               for (q = p; q < r; q++) wi[q] += bp * row[q];
+            }
+         }
+         /* scatter the update into rows of the active submatrix; the
+            pattern of row a = R[p] contains R[p+1], ..., R[r-1] */
+         for (i = 0; i < nb; i++)
+         {  p = p0 + i;
+            a = R[p];
+            wi = w + i * r;
+            U_diag[a] -= wi[p];
+            t = U_ptr[a];
+            for (q = p + 1; q < r; q++)
+            {  b = R[q];
+               while (U_ind[t] != b) t++;
+               U_val[t] -= wi[q];
+            }
+         }
+      }
+      return;
+}
+
+int chol_numeric_sn(MATPOOL *pool, int n,
+      int A_ptr[], int A_ind[], double A_val[], double A_diag[],
+      int U_ptr[], int U_ind[], double U_val[], double U_diag[],
+      int nsn, int sn_ptr[])
+{     struct sn_task _task, *task = &_task;
+      int i, j, k, t, J, beg, end, len, f, l, r, r_max, nthreads,
+         count = 0;
+      double ukk, uki, *rowi, *rowk, *work;
+      nthreads = (pool == NULL ? 1 : pool->nthreads);
+      work = xcalloc(1+n, sizeof(double));
+      for (j = 1; j <= n; j++) work[j] = 0.0;
+      /* U := (upper triangle of A) */
+      /* note that the upper traingle of A is a subset of U */
+      for (i = 1; i <= n; i++)
+      {  beg = A_ptr[i], end = A_ptr[i+1];
+         for (t = beg; t < end; t++)
+            j = A_ind[t], work[j] = A_val[t];
+         beg = U_ptr[i], end = U_ptr[i+1];
+         for (t = beg; t < end; t++)
+            j = U_ind[t], U_val[t] = work[j], work[j] = 0.0;
+         U_diag[i] = A_diag[i];
+      }
+      xfree(work);
+      /* allocate working arrays for updates */
+      r_max = 0;
+      for (J = 1; J <= nsn; J++)
+      {  l = sn_ptr[J+1] - 1;
+         r = U_ptr[l+1] - U_ptr[l];
+         if (r_max < r) r_max = r;
+      }
+      task->U_ptr = U_ptr, task->U_ind = U_ind;
+      task->U_val = U_val, task->U_diag = U_diag;
+      task->w = xcalloc(1 + nthreads * SN_BLK * r_max, sizeof(double));
+      /* main elimination loop */
+      for (J = 1; J <= nsn; J++)
+      {  f = sn_ptr[J], l = sn_ptr[J+1] - 1;
+         xassert(1 <= f && f <= l && l <= n);
+         /* factorize rows of the supernode */
+         for (k = f; k <= l; k++)
+         {  ukk = U_diag[k];
+            if (ukk > 0.0)
+               U_diag[k] = ukk = sqrt(ukk);
+            else
+               U_diag[k] = ukk = DBL_MAX, count++;
+            rowk = &U_val[U_ptr[k]];
+            len = U_ptr[k+1] - U_ptr[k];
+            for (t = 0; t < len; t++)
+               rowk[t] /= ukk;
+            /* (i-th row) := (i-th row) - u[k,i] * (k-th row); the
+               pattern of i-th row is the tail of k-th row following
+               u[k,i] */
+            for (i = k+1; i <= l; i++)
+            {  uki = rowk[i-k-1];
+               U_diag[i] -= uki * uki;
+               if (uki == 0.0) continue;
+               rowi = &U_val[U_ptr[i]];
+               for (t = 0; t < len-(i-k); t++)
+                  rowi[t] -= uki * rowk[t+(i-k)];
+            }
+         }
+         /* update the active submatrix */
+         r = U_ptr[l+1] - U_ptr[l];
+         if (r == 0) continue;
+         task->f = f, task->l = l, task->r = r;
+         task->R = &U_ind[U_ptr[l]];
+         if (pool != NULL &&
+             (double)(l-f+1) * (double)r * (double)r >= SN_PAR_MIN)
+            pool_run(pool, sn_update, task);
+         else
+            sn_update(task, 0, 1);
+      }
+      xfree(task->w);
+      return count;
+}
+
 /*----------------------------------------------------------------------
 -- u_solve - solve upper triangular system U*x = b.
 --
@@ -183,6 +183,34 @@ int chol_numeric(int n,
       int U_ptr[], int U_ind[], double U_val[], double U_diag[]);
 /* compute Cholesky factorization (numeric phase) */
 
+typedef struct MATPOOL MATPOOL;
+/* pool of worker threads used by parallel numeric routines */
+
+#define mat_create_pool _glp_mat_create_pool
+MATPOOL *mat_create_pool(int nthreads);
+/* create pool of worker threads */
+
+#define mat_delete_pool _glp_mat_delete_pool
+void mat_delete_pool(MATPOOL *pool);
+/* delete pool of worker threads */
+
+#define adat_numeric_mt _glp_mat_adat_numeric_mt
+void adat_numeric_mt(MATPOOL *pool, int m, int n, int P_per[],
+      int A_ptr[], int A_ind[], double A_val[], double D_diag[],
+      int S_ptr[], int S_ind[], double S_val[], double S_diag[]);
+/* compute S = P*A*D*A'*P' (numeric phase, multithreaded) */
+
+#define chol_supernodes _glp_mat_chol_supernodes
+int chol_supernodes(int n, int U_ptr[], int U_ind[], int sn_ptr[]);
+/* determine supernodes of Cholesky factor */
+
+#define chol_numeric_sn _glp_mat_chol_numeric_sn
+int chol_numeric_sn(MATPOOL *pool, int n,
+      int A_ptr[], int A_ind[], double A_val[], double A_diag[],
+      int U_ptr[], int U_ind[], double U_val[], double U_diag[],
+      int nsn, int sn_ptr[]);
+/* compute Cholesky factorization (supernodal numeric phase) */
+
 #define u_solve _glp_mat_u_solve
 void u_solve(int n, int U_ptr[], int U_ind[], double U_val[],
       double U_diag[], double x[]);
@@ -78,6 +78,10 @@ typedef struct PRINTF1 PRINTF1;
 typedef struct FOR FOR;
 typedef struct STATEMENT STATEMENT;
 typedef struct TUPLE SLICE;
+#if 1 /* 19/X-2026 */
+typedef struct GENPAR GENPAR;
+typedef struct GENWRK GENWRK;
+#endif
 
 /**********************************************************************/
 /* * *                    TRANSLATOR DATABASE                     * * */
@@ -122,6 +126,11 @@ typedef struct TUPLE SLICE;
 #define OUTBUF_SIZE 1024
 /* size of the output buffer, in characters */
 
+#if 1 /* 19/X-2026 */
+#define OUTBUF_MAX 65536
+/* size of the buffer to accumulate output data, in characters */
+#endif
+
 #if 0 /* 22/I-2013 */
 struct MPL
 #else
@@ -276,6 +285,22 @@ struct glp_tran
       /* generating/postsolving segment */
       RNG *rand;
       /* pseudo-random number generator */
+#if 1 /* 19/X-2026 */
+      int seed;
+      /* seed value the generator is (re)initialized with */
+      int threads;
+      /* number of worker threads used to generate model constraints;
+         1 means the model is generated serially */
+      GENPAR *par;
+      /* parallel generation being performed; NULL means the model is
+         being generated serially */
+      int par_cnt;
+      /* number of elemental constraints generated by worker threads
+         during the last generation of the model */
+      GENWRK *wrk;
+      /* worker, for which this database is a replica of the original
+         model; NULL means the database is not a replica */
+#endif
       int flag_p;
       /* if this flag is set, the postsolving phase is in effect */
       STATEMENT *stmt;
@@ -295,6 +320,15 @@ struct glp_tran
       /* col[0] is not used;
          col[j] is elemental variable, which corresponds to j-th column
          of the problem, 1 <= j <= n */
+#if 1 /* 19/X-2026 */
+      char *upd_row; /* char upd_row[1+m]; */
+      /* upd_row[i] is set if i-th row has been changed by updating the
+         generated model and not applied to the problem object yet; NULL
+         means the model has not been updated */
+      char *upd_col; /* char upd_col[1+n]; */
+      /* upd_col[j] is set if bounds of j-th column have been changed in
+         the same way */
+#endif
       /*--------------------------------------------------------------*/
       /* input/output segment */
       glp_file *in_fp;
@@ -312,6 +346,26 @@ struct glp_tran
       /* buffer to accumulate output data */
       int out_cnt;
       /* count of data bytes stored in the output buffer */
+#endif
+#if 1 /* 19/X-2026 */
+      char *out_buf; /* char out_buf[OUTBUF_MAX+1] */
+      /* buffer to accumulate output data; it is written out when it is
+         full, on flushing the output and, if the data are sent to the
+         terminal, at the end of each line */
+      int out_cnt;
+      /* count of data bytes stored in the output buffer */
+      void (*out_hook)(void *info, const char *s);
+      /* routine to receive the data that would be sent to stdout;
+         NULL means the data are sent to stdout via xprintf */
+      void *out_info;
+      /* transit pointer passed to the routine out_hook */
+      int (*tab_hook)(void *info, const char *table, int nf,
+         const char *name[], int nr, const double *num[],
+         const char **str[]);
+      /* routine to receive batches of records written to output tables
+         with the driver "JS"; may be NULL */
+      void *tab_info;
+      /* transit pointer passed to the routine tab_hook */
 #endif
       glp_file *prt_fp;
       /* stream assigned to the print text file; may be NULL */
@@ -779,6 +833,48 @@ void parameter_data(MPL *mpl);
 void data_section(MPL *mpl);
 /* read data section */
 
+#if 1 /* 19/X-2026 */
+#define direct_set_data _glp_mpl_direct_set_data
+void direct_set_data
+(     MPL *mpl,
+      char *name,             /* not changed */
+      int dim,
+      const double snum[],    /* not changed */
+      char *sstr[],           /* not changed */
+      int dimen,
+      int n,
+      const double num[],     /* not changed */
+      char *str[]             /* not changed */
+);
+/* assign set data passed directly */
+
+#define direct_parameter_data _glp_mpl_direct_parameter_data
+void direct_parameter_data
+(     MPL *mpl,
+      char *name,             /* not changed */
+      int dim,
+      int n,
+      const double snum[],    /* not changed */
+      char *sstr[],           /* not changed */
+      const double num[],     /* not changed */
+      char *str[]             /* not changed */
+);
+/* assign parameter data passed directly */
+
+#define direct_parameter_update _glp_mpl_direct_parameter_update
+void direct_parameter_update
+(     MPL *mpl,
+      char *name,             /* not changed */
+      int dim,
+      int n,
+      const double snum[],    /* not changed */
+      char *sstr[],           /* not changed */
+      const double num[],     /* not changed */
+      char *str[]             /* not changed */
+);
+/* change parameter data of generated model */
+#endif
+
 /**********************************************************************/
 /* * *                   FLOATING-POINT NUMBERS                   * * */
 /**********************************************************************/
@@ -1043,6 +1139,13 @@ int compare_tuples
 );
 /* compare one n-tuple with another */
 
+#define hash_tuple _glp_mpl_hash_tuple
+unsigned int hash_tuple
+(     MPL *mpl,
+      TUPLE *tuple            /* not changed */
+);
+/* compute hash code of n-tuple */
+
 #define build_subtuple _glp_mpl_build_subtuple
 TUPLE *build_subtuple
 (     MPL *mpl,
@@ -1361,9 +1464,17 @@ struct ARRAY
       /* the first array member; NULL means the array is empty */
       MEMBER *tail;
       /* the last array member; NULL means the array is empty */
+#if 0 /* 19/X-2026 */
       AVL *tree;
       /* the search tree intended to find array members for logarithmic
          time; NULL means the search tree doesn't exist */
+#else
+      int hash_size;
+      /* size of the hash table (power of 2) */
+      MEMBER **hash; /* MEMBER *hash[hash_size]; */
+      /* open addressing hash table intended to find array members for
+         constant time; NULL means the hash table doesn't exist */
+#endif
       ARRAY *prev;
       /* the previous array in the translator database */
       ARRAY *next;
@@ -1376,6 +1487,10 @@ struct MEMBER
       /* n-tuple, which identifies the member; number of its components
          is the same for all members within the array and determined by
          the array dimension; duplicate members are not allowed */
+#if 1 /* 19/X-2026 */
+      unsigned int hash;
+      /* hash code of the n-tuple computed by the routine hash_tuple */
+#endif
       MEMBER *next;
       /* the next array member */
       VALUE value;
@@ -1659,6 +1774,13 @@ struct PARAMETER
       /* default value provided in the data section; can be NULL */
       ARRAY *array;
       /* array of members, which are assigned numbers or symbols */
+#if 1 /* 19/X-2026 */
+      int upd;
+      /* update status flag (used only on updating generated model):
+         0 - the parameter is not affected by the update
+         1 - new data have been assigned to the parameter
+         2 - the parameter depends on updated parameters */
+#endif
 };
 
 struct CONDITION
@@ -1765,6 +1887,11 @@ struct VARIABLE
          variable is fixed at the corresponding value */
       ARRAY *array;
       /* array of members, which are assigned elemental variables */
+#if 1 /* 19/X-2026 */
+      int upd;
+      /* if this flag is set, bounds of the variable depend on updated
+         parameters (used only on updating generated model) */
+#endif
 };
 
 #define take_member_var _glp_mpl_take_member_var
@@ -1833,6 +1960,16 @@ ELEMCON *take_member_con      /* returns reference */
 );
 /* obtain reference to elemental constraint */
 
+#if 1 /* 19/X-2026 */
+#define eval_form_con _glp_mpl_eval_form_con
+void eval_form_con
+(     MPL *mpl,
+      CONSTRAINT *con,        /* not changed */
+      ELEMCON *refer          /* modified */
+);
+/* compute linear form and bounds of elemental constraint */
+#endif
+
 #define eval_member_con _glp_mpl_eval_member_con
 ELEMCON *eval_member_con      /* returns reference */
 (     MPL *mpl,
@@ -2441,6 +2578,54 @@ void postsolve_model(MPL *mpl);
 void clean_model(MPL *mpl);
 /* clean model content */
 
+#if 1 /* 19/X-2026 */
+/**********************************************************************/
+/* * *                PARALLEL GENERATION OF MODEL                * * */
+/**********************************************************************/
+
+#define par_start _glp_mpl_par_start
+void par_start(MPL *mpl);
+/* start worker threads to generate model constraints */
+
+#define par_whole_con _glp_mpl_par_whole_con
+void par_whole_con(MPL *mpl, CONSTRAINT *con);
+/* merge model constraint generated by worker threads */
+
+#define par_finish _glp_mpl_par_finish
+void par_finish(MPL *mpl);
+/* stop worker threads */
+
+#define par_enter_var _glp_mpl_par_enter_var
+int par_enter_var(MPL *mpl);
+/* note reference to elemental variable (replica only) */
+
+#define par_leave_var _glp_mpl_par_leave_var
+void par_leave_var(MPL *mpl, int k, ELEMVAR *refer);
+/* store evaluated reference to elemental variable (replica only) */
+
+#define par_enter_con _glp_mpl_par_enter_con
+void par_enter_con(MPL *mpl);
+/* note reference to elemental constraint (replica only) */
+
+#define par_unsafe _glp_mpl_par_unsafe
+void par_unsafe(MPL *mpl);
+/* note evaluation which cannot be replicated (replica only) */
+#endif
+
+#if 1 /* 19/X-2026 */
+/**********************************************************************/
+/* * *                  UPDATING GENERATED MODEL                  * * */
+/**********************************************************************/
+
+#define update_model _glp_mpl_update_model
+void update_model(MPL *mpl);
+/* regenerate model objects depending on updated parameters */
+
+#define clean_update _glp_mpl_clean_update
+void clean_update(MPL *mpl);
+/* forget changes not applied to problem object */
+#endif
+
 /**********************************************************************/
 /* * *                        INPUT/OUTPUT                        * * */
 /**********************************************************************/
@@ -2469,6 +2654,12 @@ void write_char(MPL *mpl, int c);
 void write_text(MPL *mpl, char *fmt, ...);
 /* format and write text to output text file */
 
+#if 1 /* 19/X-2026 */
+#define write_buffer _glp_mpl_write_buffer
+void write_buffer(MPL *mpl);
+/* write data accumulated in output buffer */
+#endif
+
 #define flush_output _glp_mpl_flush_output
 void flush_output(MPL *mpl);
 /* finalize writing data to output text file */
@@ -2511,6 +2702,20 @@ int mpl_read_model(MPL *mpl, char *file, int skip_data);
 int mpl_read_data(MPL *mpl, char *file);
 /* read data section */
 
+#if 1 /* 19/X-2026 */
+#define mpl_put_set_data _glp_mpl_put_set_data
+int mpl_put_set_data(MPL *mpl, char *name, int dim,
+      const double snum[], char *sstr[], int dimen, int n,
+      const double num[], char *str[]);
+/* assign set data directly */
+
+#define mpl_put_par_data _glp_mpl_put_par_data
+int mpl_put_par_data(MPL *mpl, char *name, int dim, int n,
+      const double snum[], char *sstr[], const double num[],
+      char *str[]);
+/* assign parameter data directly */
+#endif
+
 #define mpl_generate _glp_mpl_generate
 int mpl_generate(MPL *mpl, char *file);
 /* generate model */
@@ -2587,6 +2792,27 @@ void mpl_put_col_value(MPL *mpl, int j, double val);
 int mpl_postsolve(MPL *mpl);
 /* postsolve model */
 
+#if 1 /* 19/X-2026 */
+#define mpl_reset _glp_mpl_reset
+int mpl_reset(MPL *mpl);
+/* discard data and generated content, keep translated model */
+
+#define mpl_update_par_data _glp_mpl_update_par_data
+int mpl_update_par_data(MPL *mpl, char *name, int dim, int n,
+      const double snum[], char *sstr[], const double num[],
+      char *str[]);
+/* change parameter data of generated model */
+
+#define mpl_update _glp_mpl_update
+int mpl_update(MPL *mpl);
+/* regenerate model objects depending on changed parameters */
+
+#define mpl_get_pool_stats _glp_mpl_get_pool_stats
+char *mpl_get_pool_stats(MPL *mpl, int k, size_t *count,
+      size_t *total);
+/* obtain statistics of memory pool */
+#endif
+
 #define mpl_terminate _glp_mpl_terminate
 void mpl_terminate(MPL *mpl);
 /* free all resources used by translator */
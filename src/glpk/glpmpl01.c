@@ -3224,6 +3224,9 @@ PARAMETER *parameter_statement(MPL *mpl)
       par->data = 0;
       par->defval = NULL;
       par->array = NULL;
+#if 1 /* 19/X-2026 */
+      par->upd = 0;
+#endif
       get_token(mpl /* <symbolic name> */);
       /* parse optional alias */
       if (mpl->token == T_STRING)
@@ -3478,6 +3481,9 @@ VARIABLE *variable_statement(MPL *mpl)
       var->lbnd = NULL;
       var->ubnd = NULL;
       var->array = NULL;
+#if 1 /* 19/X-2026 */
+      var->upd = 0;
+#endif
       get_token(mpl /* <symbolic name> */);
       /* parse optional alias */
       if (mpl->token == T_STRING)
@@ -1200,4 +1200,252 @@ void data_section(MPL *mpl)
       return;
 }
 
+#if 1 /* 19/X-2026 */
+/*----------------------------------------------------------------------
+-- direct_number - obtain number passed directly.
+--
+-- This routine checks and returns the number num[k] specified by the
+-- calling program. */
+
+static double direct_number
+(     MPL *mpl,
+      const double num[],     /* not changed */
+      int k
+)
+{     if (num == NULL)
+         error(mpl, "number or symbol missing where expected");
+      if (!(-DBL_MAX <= num[k] && num[k] <= +DBL_MAX))
+         error(mpl, "invalid numeric value");
+      return num[k];
+}
+
+/*----------------------------------------------------------------------
+-- direct_symbol - construct symbol from component passed directly.
+--
+-- This routine constructs a symbol from k-th component specified by
+-- the calling program. If str is not NULL and str[k] is not NULL, the
+-- symbol is the character string str[k], otherwise it is the number
+-- num[k]. */
+
+static SYMBOL *direct_symbol
+(     MPL *mpl,
+      const double num[],     /* not changed */
+      char *str[],            /* not changed */
+      int k
+)
+{     SYMBOL *sym;
+      if (str != NULL && str[k] != NULL)
+      {  if (strlen(str[k]) > MAX_LENGTH)
+            error(mpl, "symbol %.*s... too long", 30, str[k]);
+         sym = create_symbol_str(mpl, create_string(mpl, str[k]));
+      }
+      else
+         sym = create_symbol_num(mpl, direct_number(mpl, num, k));
+      return sym;
+}
+
+/*----------------------------------------------------------------------
+-- direct_tuple - construct n-tuple from components passed directly.
+--
+-- This routine constructs n-tuple of given dimension, whose components
+-- are specified by the calling program in locations k+1, ..., k+dim of
+-- the arrays num and str (see the routine direct_symbol). */
+
+static TUPLE *direct_tuple
+(     MPL *mpl,
+      int dim,
+      const double num[],     /* not changed */
+      char *str[],            /* not changed */
+      int k
+)
+{     TUPLE *tuple;
+      int t;
+      tuple = create_tuple(mpl);
+      for (t = 1; t <= dim; t++)
+         tuple = expand_tuple(mpl, tuple,
+            direct_symbol(mpl, num, str, k+t));
+      return tuple;
+}
+
+/*----------------------------------------------------------------------
+-- direct_set_data - assign set data passed directly.
+--
+-- This routine assigns elemental set to member of specified set as if
+-- the set data block were read from the data section. Components of
+-- the subscript list of the set member are specified in locations 1,
+-- ..., dim of the arrays snum and sstr, and components of n elemental
+-- set members are specified in locations 1, ..., n*dimen of the arrays
+-- num and str, n-tuple after n-tuple (see the routine direct_symbol).
+--
+-- The dimensions dim and dimen specified by the calling program must
+-- be the same as the dimensions of the set domain and the set itself.
+-- The same n-tuple must not be specified twice. */
+
+void direct_set_data
+(     MPL *mpl,
+      char *name,             /* not changed */
+      int dim,
+      const double snum[],    /* not changed */
+      char *sstr[],           /* not changed */
+      int dimen,
+      int n,
+      const double num[],     /* not changed */
+      char *str[]             /* not changed */
+)
+{     SET *set;
+      TUPLE *tuple;
+      MEMBER *memb;
+      int i;
+      xassert(n >= 0);
+      /* select the set to saturate it with data */
+      set = select_set(mpl, name);
+      if (set->dim != dim)
+         error(mpl, "%s must have %d subscript%s rather than %d",
+            set->name, set->dim, set->dim == 1 ? "" : "s", dim);
+      if (set->dimen != dimen)
+         error(mpl, "%s must have %d-tuples rather than %d-tuples",
+            set->name, set->dimen, dimen);
+      /* construct subscript list, which identifies the set member */
+      tuple = direct_tuple(mpl, dim, snum, sstr, 0);
+      /* there must be no member with the same subscript list */
+      if (find_member(mpl, set->array, tuple) != NULL)
+         error(mpl, "%s%s already defined",
+            set->name, format_tuple(mpl, '[', tuple));
+      /* add new member to the set and assign it elemental set */
+      memb = add_member(mpl, set->array, tuple);
+      memb->value.set = create_elemset(mpl, dimen);
+      for (i = 0; i < n; i++)
+         check_then_add(mpl, memb->value.set,
+            direct_tuple(mpl, dimen, num, str, i * dimen));
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- direct_parameter_data - assign parameter data passed directly.
+--
+-- This routine assigns values to n members of specified parameter as
+-- if the parameter data block were read from the data section.
+-- Subscript lists of the parameter members are specified in locations
+-- 1, ..., n*dim of the arrays snum and sstr, subscript list after
+-- subscript list, and values of the members are specified in locations
+-- 1, ..., n of the arrays num and str (see the routine direct_symbol).
+--
+-- The dimension dim specified by the calling program must be the same
+-- as the dimension of the parameter domain. Numeric parameters require
+-- numeric values. */
+
+void direct_parameter_data
+(     MPL *mpl,
+      char *name,             /* not changed */
+      int dim,
+      int n,
+      const double snum[],    /* not changed */
+      char *sstr[],           /* not changed */
+      const double num[],     /* not changed */
+      char *str[]             /* not changed */
+)
+{     PARAMETER *par;
+      TUPLE *tuple;
+      MEMBER *memb;
+      int i;
+      xassert(n >= 0);
+      /* select the parameter to saturate it with data */
+      par = select_parameter(mpl, name);
+      if (par->dim != dim)
+         error(mpl, "%s must have %d subscript%s rather than %d",
+            par->name, par->dim, par->dim == 1 ? "" : "s", dim);
+      for (i = 1; i <= n; i++)
+      {  /* construct subscript list of the parameter member */
+         tuple = direct_tuple(mpl, dim, snum, sstr, (i-1) * dim);
+         /* there must be no member with the same n-tuple */
+         if (find_member(mpl, par->array, tuple) != NULL)
+            error(mpl, "%s%s already defined",
+               par->name, format_tuple(mpl, '[', tuple));
+         /* create new parameter member and assign value to it */
+         memb = add_member(mpl, par->array, tuple);
+         switch (par->type)
+         {  case A_NUMERIC:
+            case A_INTEGER:
+            case A_BINARY:
+               if (str != NULL && str[i] != NULL)
+                  error(mpl, "%s requires numeric data", par->name);
+               memb->value.num = direct_number(mpl, num, i);
+               break;
+            case A_SYMBOLIC:
+               memb->value.sym = direct_symbol(mpl, num, str, i);
+               break;
+            default:
+               xassert(par != par);
+         }
+      }
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- direct_parameter_update - change parameter data of generated model.
+--
+-- This routine assigns new values to n members of specified parameter
+-- after the model has been generated. Members and values are specified
+-- as for the routine direct_parameter_data; however, members that have
+-- been already assigned are given the new values rather than reported
+-- as defined twice. The new values are checked when the parameter is
+-- referenced next time; the model objects which depend on the values
+-- are evaluated again by the routine update_model. */
+
+void direct_parameter_update
+(     MPL *mpl,
+      char *name,             /* not changed */
+      int dim,
+      int n,
+      const double snum[],    /* not changed */
+      char *sstr[],           /* not changed */
+      const double num[],     /* not changed */
+      char *str[]             /* not changed */
+)
+{     PARAMETER *par;
+      TUPLE *tuple;
+      MEMBER *memb;
+      AVLNODE *node;
+      VALUE value;
+      int i;
+      xassert(n >= 0);
+      /* find the parameter */
+      node = avl_find_node(mpl->tree, name);
+      if (node == NULL || avl_get_node_type(node) != A_PARAMETER)
+         error(mpl, "%s not a parameter", name);
+      par = (PARAMETER *)avl_get_node_link(node);
+      if (par->assign != NULL)
+         error(mpl, "%s needs no data", name);
+      if (par->dim != dim)
+         error(mpl, "%s must have %d subscript%s rather than %d",
+            par->name, par->dim, par->dim == 1 ? "" : "s", dim);
+      for (i = 1; i <= n; i++)
+      {  /* construct subscript list and new value of the member */
+         tuple = direct_tuple(mpl, dim, snum, sstr, (i-1) * dim);
+         if (par->type == A_SYMBOLIC)
+            value.sym = direct_symbol(mpl, num, str, i);
+         else
+         {  xassert(par->type == A_NUMERIC || par->type == A_INTEGER ||
+               par->type == A_BINARY);
+            if (str != NULL && str[i] != NULL)
+               error(mpl, "%s requires numeric data", par->name);
+            value.num = direct_number(mpl, num, i);
+         }
+         /* replace the value of existing member or add new member */
+         memb = find_member(mpl, par->array, tuple);
+         if (memb == NULL)
+            memb = add_member(mpl, par->array, tuple);
+         else
+         {  delete_tuple(mpl, tuple);
+            delete_value(mpl, par->array->type, &memb->value);
+         }
+         memb->value = value;
+      }
+      /* the parameter data are to be checked again */
+      par->data = 1;
+      par->upd = 1;
+      return;
+}
+#endif
+
 /* eof */
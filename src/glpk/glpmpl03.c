@@ -313,7 +313,11 @@ double fp_trunc(MPL *mpl, double x, double n)
 #define two_to_the_24 0x1000000
 
 double fp_irand224(MPL *mpl)
-{     return
+{
+#if 1 /* 19/X-2026 */
+      if (mpl->wrk != NULL) par_unsafe(mpl);
+#endif
+      return
          (double)rng_unif_rand(mpl->rand, two_to_the_24);
 }
 
@@ -326,7 +330,11 @@ double fp_irand224(MPL *mpl)
 #define two_to_the_31 ((unsigned int)0x80000000)
 
 double fp_uniform01(MPL *mpl)
-{     return
+{
+#if 1 /* 19/X-2026 */
+      if (mpl->wrk != NULL) par_unsafe(mpl);
+#endif
+      return
          (double)rng_next_rand(mpl->rand) / (double)two_to_the_31;
 }
 
@@ -853,6 +861,45 @@ int compare_tuples
       return 0;
 }
 
+/*----------------------------------------------------------------------
+-- hash_tuple - compute hash code of n-tuple.
+--
+-- This routine computes hash code of given n-tuple. Identical n-tuples
+-- (i.e. n-tuples, for which compare_tuples returns zero) always have
+-- the same hash code. */
+
+unsigned int hash_tuple
+(     MPL *mpl,
+      TUPLE *tuple            /* not changed */
+)
+{     unsigned char buf[sizeof(double)];
+      unsigned int h = 2166136261u;
+      double num;
+      char *str;
+      int k;
+      xassert(mpl == mpl);
+      for (; tuple != NULL; tuple = tuple->next)
+      {  xassert(tuple->sym != NULL);
+         if (tuple->sym->str == NULL)
+         {  /* numeric component; note that +0 and -0 are identical */
+            num = tuple->sym->num;
+            if (num == 0.0) num = 0.0;
+            memcpy(buf, &num, sizeof(double));
+            for (k = 0; k < (int)sizeof(double); k++)
+               h = (h ^ buf[k]) * 16777619u;
+         }
+         else
+         {  /* symbolic component */
+            h = (h ^ 0xFF) * 16777619u;
+            for (str = tuple->sym->str; *str != '\0'; str++)
+               h = (h ^ (unsigned char)*str) * 16777619u;
+         }
+         /* separate components */
+         h = (h ^ 0x1F) * 16777619u;
+      }
+      return h;
+}
+
 /*----------------------------------------------------------------------
 -- build_subtuple - build subtuple of given n-tuple.
 --
@@ -1618,7 +1665,8 @@ ARRAY *create_array(MPL *mpl, int type, int dim)
       array->size = 0;
       array->head = NULL;
       array->tail = NULL;
-      array->tree = NULL;
+      array->hash_size = 0;
+      array->hash = NULL;
       array->prev = NULL;
       array->next = mpl->a_list;
       /* include the array in the global array list */
@@ -1632,14 +1680,31 @@ ARRAY *create_array(MPL *mpl, int type, int dim)
 --
 -- This routine finds an array member, which has given n-tuple. If the
 -- array is short, the linear search is used. Otherwise the routine
--- autimatically creates the search tree (i.e. the array index) to find
--- members for logarithmic time. */
+-- automatically creates the hash table (i.e. the array index) to find
+-- members for constant time. In both cases n-tuples are compared only
+-- if their hash codes are the same. */
+
+static void hash_member(ARRAY *array, MEMBER *memb)
+{     /* this is an auxiliary routine used to include a member into the
+         hash table of the array */
+      unsigned int k, mask = (unsigned int)array->hash_size - 1;
+      for (k = memb->hash & mask; array->hash[k] != NULL;
+           k = (k + 1) & mask) /* nop */;
+      array->hash[k] = memb;
+      return;
+}
 
-static int compare_member_tuples(void *info, const void *key1,
-      const void *key2)
-{     /* this is an auxiliary routine used to compare keys, which are
-         n-tuples assigned to array members */
-      return compare_tuples((MPL *)info, (TUPLE *)key1, (TUPLE *)key2);
+static void rehash_array(ARRAY *array, int size)
+{     /* this is an auxiliary routine used to (re)create the hash table
+         of the array having specified size */
+      MEMBER *memb;
+      if (array->hash != NULL) xfree(array->hash);
+      array->hash_size = size;
+      array->hash = xcalloc(size, sizeof(MEMBER *));
+      memset(array->hash, 0, size * sizeof(MEMBER *));
+      for (memb = array->head; memb != NULL; memb = memb->next)
+         hash_member(array, memb);
+      return;
 }
 
 MEMBER *find_member
@@ -1648,28 +1713,34 @@ MEMBER *find_member
       TUPLE *tuple            /* not changed */
 )
 {     MEMBER *memb;
+      unsigned int h, k, mask;
       xassert(array != NULL);
       /* the n-tuple must have the same dimension as the array */
       xassert(tuple_dimen(mpl, tuple) == array->dim);
-      /* if the array is large enough, create the search tree and index
+      h = hash_tuple(mpl, tuple);
+      /* if the array is large enough, create the hash table and index
          all existing members of the array */
-      if (array->size > 30 && array->tree == NULL)
-      {  array->tree = avl_create_tree(compare_member_tuples, mpl);
-         for (memb = array->head; memb != NULL; memb = memb->next)
-avl_set_node_link(avl_insert_node(array->tree, memb->tuple),
-               (void *)memb);
+      if (array->size > 30 && array->hash == NULL)
+      {  int size = 64;
+         while (size / 2 < array->size) size += size;
+         rehash_array(array, size);
       }
       /* find a member, which has the given tuple */
-      if (array->tree == NULL)
-      {  /* the search tree doesn't exist; use the linear search */
+      if (array->hash == NULL)
+      {  /* the hash table doesn't exist; use the linear search */
          for (memb = array->head; memb != NULL; memb = memb->next)
-            if (compare_tuples(mpl, memb->tuple, tuple) == 0) break;
+         {  if (memb->hash == h &&
+                compare_tuples(mpl, memb->tuple, tuple) == 0) break;
+         }
       }
       else
-      {  /* the search tree exists; use the binary search */
-         AVLNODE *node;
-         node = avl_find_node(array->tree, tuple);
-memb = (MEMBER *)(node == NULL ? NULL : avl_get_node_link(node));
+      {  /* the hash table exists; probe it */
+         mask = (unsigned int)array->hash_size - 1;
+         for (k = h & mask; (memb = array->hash[k]) != NULL;
+              k = (k + 1) & mask)
+         {  if (memb->hash == h &&
+                compare_tuples(mpl, memb->tuple, tuple) == 0) break;
+         }
       }
       return memb;
 }
@@ -1701,6 +1772,7 @@ MEMBER *add_member
       /* create new member */
       memb = dmp_get_atom(mpl->members, sizeof(MEMBER));
       memb->tuple = tuple;
+      memb->hash = hash_tuple(mpl, tuple);
       memb->next = NULL;
       memset(&memb->value, '?', sizeof(VALUE));
       /* and append it to the member list */
@@ -1710,10 +1782,14 @@ MEMBER *add_member
       else
          array->tail->next = memb;
       array->tail = memb;
-      /* if the search tree exists, index the new member */
-      if (array->tree != NULL)
-avl_set_node_link(avl_insert_node(array->tree, memb->tuple),
-            (void *)memb);
+      /* if the hash table exists, index the new member; the table is
+         enlarged to keep its load factor not greater than 1/2 */
+      if (array->hash != NULL)
+      {  if (array->size > array->hash_size / 2)
+            rehash_array(array, array->hash_size + array->hash_size);
+         else
+            hash_member(array, memb);
+      }
       return memb;
 }
 
@@ -1739,8 +1815,8 @@ void delete_array
          delete_tuple(mpl, memb->tuple);
          dmp_free_atom(mpl->members, memb, sizeof(MEMBER));
       }
-      /* if the search tree exists, also delete it */
-      if (array->tree != NULL) avl_delete_tree(array->tree);
+      /* if the hash table exists, also delete it */
+      if (array->hash != NULL) xfree(array->hash);
       /* remove the array from the global array list */
       if (array->prev == NULL)
          mpl->a_list = array->next;
@@ -3090,6 +3166,9 @@ void clean_parameter(MPL *mpl, PARAMETER *par)
       clean_code(mpl, par->option);
       /* reset data status flag */
       par->data = 0;
+#if 1 /* 19/X-2026 */
+      par->upd = 0;
+#endif
       /* delete default symbolic value */
       if (par->defval != NULL)
          delete_symbol(mpl, par->defval), par->defval = NULL;
@@ -3189,13 +3268,24 @@ ELEMVAR *eval_member_var      /* returns reference */
 )
 {     /* this routine evaluates variable member */
       struct eval_var_info _info, *info = &_info;
+#if 1 /* 19/X-2026 */
+      int k = 0;
+#endif
       xassert(var->dim == tuple_dimen(mpl, tuple));
       info->var = var;
       info->tuple = tuple;
+#if 1 /* 19/X-2026 */
+      /* references made by a replica are reproduced by the original
+         database in the same order */
+      if (mpl->wrk != NULL) k = par_enter_var(mpl);
+#endif
       /* evaluate member, which has given n-tuple */
       if (eval_within_domain(mpl, info->var->domain, info->tuple, info,
          eval_var_func))
          out_of_domain(mpl, var->name, info->tuple);
+#if 1 /* 19/X-2026 */
+      if (mpl->wrk != NULL) par_leave_var(mpl, k, info->refer);
+#endif
       /* bring evaluated reference to the calling program */
       return info->refer;
 }
@@ -3234,6 +3324,9 @@ void clean_variable(MPL *mpl, VARIABLE *var)
       clean_code(mpl, var->lbnd);
       /* clean code for computing upper bound */
       if (var->ubnd != var->lbnd) clean_code(mpl, var->ubnd);
+#if 1 /* 19/X-2026 */
+      var->upd = 0;
+#endif
       /* delete content array */
       for (memb = var->array->head; memb != NULL; memb = memb->next)
          dmp_free_atom(mpl->elemvars, memb->value.var, sizeof(ELEMVAR));
@@ -3245,6 +3338,85 @@ void clean_variable(MPL *mpl, VARIABLE *var)
 /* * *              MODEL CONSTRAINTS AND OBJECTIVES              * * */
 /**********************************************************************/
 
+#if 1 /* 19/X-2026 */
+/*----------------------------------------------------------------------
+-- eval_form_con - compute linear form of elemental constraint.
+--
+-- This routine computes the linear form and bounds of elemental
+-- constraint assigned to member of specified model constraint, whose
+-- dummy indices have been assigned by the calling program.
+--
+-- NOTE: This routine must not be called out of domain scope. */
+
+void eval_form_con
+(     MPL *mpl,
+      CONSTRAINT *con,        /* not changed */
+      ELEMCON *refer          /* modified */
+)
+{     /* compute linear form */
+      xassert(con->code != NULL);
+      refer->form = eval_formula(mpl, con->code);
+      /* compute lower and upper bounds */
+      if (con->lbnd == NULL && con->ubnd == NULL)
+      {  /* objective has no bounds */
+         double temp;
+         xassert(con->type == A_MINIMIZE || con->type == A_MAXIMIZE);
+         /* carry the constant term to the right-hand side */
+         refer->form = remove_constant(mpl, refer->form, &temp);
+         refer->lbnd = refer->ubnd = - temp;
+      }
+      else if (con->lbnd != NULL && con->ubnd == NULL)
+      {  /* constraint a * x + b >= c * y + d is transformed to the
+            standard form a * x - c * y >= d - b */
+         double temp;
+         xassert(con->type == A_CONSTRAINT);
+         refer->form = linear_comb(mpl,
+            +1.0, refer->form,
+            -1.0, eval_formula(mpl, con->lbnd));
+         refer->form = remove_constant(mpl, refer->form, &temp);
+         refer->lbnd = - temp;
+         refer->ubnd = 0.0;
+      }
+      else if (con->lbnd == NULL && con->ubnd != NULL)
+      {  /* constraint a * x + b <= c * y + d is transformed to the
+            standard form a * x - c * y <= d - b */
+         double temp;
+         xassert(con->type == A_CONSTRAINT);
+         refer->form = linear_comb(mpl,
+            +1.0, refer->form,
+            -1.0, eval_formula(mpl, con->ubnd));
+         refer->form = remove_constant(mpl, refer->form, &temp);
+         refer->lbnd = 0.0;
+         refer->ubnd = - temp;
+      }
+      else if (con->lbnd == con->ubnd)
+      {  /* constraint a * x + b = c * y + d is transformed to the
+            standard form a * x - c * y = d - b */
+         double temp;
+         xassert(con->type == A_CONSTRAINT);
+         refer->form = linear_comb(mpl,
+            +1.0, refer->form,
+            -1.0, eval_formula(mpl, con->lbnd));
+         refer->form = remove_constant(mpl, refer->form, &temp);
+         refer->lbnd = refer->ubnd = - temp;
+      }
+      else
+      {  /* ranged constraint c <= a * x + b <= d is transformed to
+            the standard form c - b <= a * x <= d - b */
+         double temp, temp1, temp2;
+         xassert(con->type == A_CONSTRAINT);
+         refer->form = remove_constant(mpl, refer->form, &temp);
+         xassert(remove_constant(mpl, eval_formula(mpl, con->lbnd),
+            &temp1) == NULL);
+         xassert(remove_constant(mpl, eval_formula(mpl, con->ubnd),
+            &temp2) == NULL);
+         refer->lbnd = fp_sub(mpl, temp1, temp);
+         refer->ubnd = fp_sub(mpl, temp2, temp);
+      }
+      return;
+}
+#endif
+
 /*----------------------------------------------------------------------
 -- take_member_con - obtain reference to elemental constraint.
 --
@@ -3277,6 +3449,9 @@ ELEMCON *take_member_con      /* returns reference */
          refer->i = 0;
          refer->con = con;
          refer->memb = memb;
+#if 1 /* 19/X-2026 */
+         eval_form_con(mpl, con, refer);
+#else
          /* compute linear form */
          xassert(con->code != NULL);
          refer->form = eval_formula(mpl, con->code);
@@ -3337,6 +3512,7 @@ ELEMCON *take_member_con      /* returns reference */
             refer->lbnd = fp_sub(mpl, temp1, temp);
             refer->ubnd = fp_sub(mpl, temp2, temp);
          }
+#endif
 #if 1 /* 15/V-2010 */
          /* solution has not been obtained by the solver yet */
          refer->stat = 0;
@@ -3377,6 +3553,9 @@ ELEMCON *eval_member_con      /* returns reference */
 {     /* this routine evaluates constraint member */
       struct eval_con_info _info, *info = &_info;
       xassert(con->dim == tuple_dimen(mpl, tuple));
+#if 1 /* 19/X-2026 */
+      if (mpl->wrk != NULL) par_enter_con(mpl);
+#endif
       info->con = con;
       info->tuple = tuple;
       /* evaluate member, which has given n-tuple */
@@ -5687,6 +5866,12 @@ static int display_func(MPL *mpl, void *info)
 
 void execute_display(MPL *mpl, DISPLAY *dpy)
 {     loop_within_domain(mpl, dpy->domain, dpy, display_func);
+#if 1 /* 19/X-2026 */
+      /* pass terminal output on at the end of the statement, so it is
+         not delayed behind other terminal output or table records */
+      if (mpl->out_fp == (void *)stdout)
+         write_buffer(mpl);
+#endif
       return;
 }
 
@@ -5920,6 +6105,11 @@ void execute_printf(MPL *mpl, PRINTF *prt)
          }
       }
       loop_within_domain(mpl, prt->domain, prt, printf_func);
+#if 1 /* 19/X-2026 */
+      /* see execute_display */
+      if (mpl->out_fp == (void *)stdout)
+         write_buffer(mpl);
+#endif
       if (mpl->prt_fp != NULL)
       {
 #if 0 /* FIXME */
@@ -6008,7 +6198,14 @@ void execute_statement(MPL *mpl, STATEMENT *stmt)
             break;
          case A_CONSTRAINT:
             xprintf("Generating %s...\n", stmt->u.con->name);
+#if 0 /* 19/X-2026 */
             eval_whole_con(mpl, stmt->u.con);
+#else
+            if (mpl->par != NULL)
+               par_whole_con(mpl, stmt->u.con);
+            else
+               eval_whole_con(mpl, stmt->u.con);
+#endif
             break;
          case A_TABLE:
             switch (stmt->u.tab->type)
@@ -108,11 +108,18 @@ void alloc_content(MPL *mpl)
 void generate_model(MPL *mpl)
 {     STATEMENT *stmt;
       xassert(!mpl->flag_p);
+#if 1 /* 19/X-2026 */
+      /* constraints are evaluated by worker threads, if allowed */
+      par_start(mpl);
+#endif
       for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
       {  execute_statement(mpl, stmt);
          if (mpl->stmt->type == A_SOLVE) break;
       }
       mpl->stmt = stmt;
+#if 1 /* 19/X-2026 */
+      if (mpl->par != NULL) par_finish(mpl);
+#endif
       return;
 }
 
@@ -362,13 +369,45 @@ void open_output(MPL *mpl, char *file)
 
 void write_char(MPL *mpl, int c)
 {     xassert(mpl->out_fp != NULL);
+#if 0 /* 19/X-2026 */
       if (mpl->out_fp == (void *)stdout)
          xprintf("%c", c);
       else
          xfprintf(mpl->out_fp, "%c", c);
+#else
+      mpl->out_buf[mpl->out_cnt++] = (char)c;
+      if (mpl->out_cnt == OUTBUF_MAX || (c == '\n' &&
+          mpl->out_fp == (void *)stdout && mpl->out_hook == NULL))
+         write_buffer(mpl);
+#endif
       return;
 }
 
+#if 1 /* 19/X-2026 */
+/*----------------------------------------------------------------------
+-- write_buffer - write data accumulated in output buffer.
+--
+-- This routine writes the data accumulated in the output buffer to the
+-- output text file, or, if the data are directed to stdout, passes them
+-- to the hook routine or to the terminal, and then empties the buffer.
+-- Write errors are detected later by the routine flush_output. */
+
+void write_buffer(MPL *mpl)
+{     xassert(mpl->out_fp != NULL);
+      if (mpl->out_cnt == 0)
+         goto done;
+      mpl->out_buf[mpl->out_cnt] = '\0';
+      if (mpl->out_fp != (void *)stdout)
+         glp_write(mpl->out_fp, mpl->out_buf, mpl->out_cnt);
+      else if (mpl->out_hook != NULL)
+         mpl->out_hook(mpl->out_info, mpl->out_buf);
+      else
+         xputs(mpl->out_buf);
+      mpl->out_cnt = 0;
+done: return;
+}
+#endif
+
 /*----------------------------------------------------------------------
 -- write_text - format and write text to output text file.
 --
@@ -393,6 +432,9 @@ void write_text(MPL *mpl, char *fmt, ...)
 
 void flush_output(MPL *mpl)
 {     xassert(mpl->out_fp != NULL);
+#if 1 /* 19/X-2026 */
+      write_buffer(mpl);
+#endif
       if (mpl->out_fp != (void *)stdout)
       {
 #if 0 /* FIXME */
@@ -423,7 +465,18 @@ void error(MPL *mpl, char *fmt, ...)
       xassert(strlen(msg) < sizeof(msg));
       va_end(arg);
       if (mpl->error_msg) xfree(mpl->error_msg);
+#if 0 /* 19/X-2026 */
       mpl->error_msg = strdup(msg);
+#else
+      /* the message is freed with xfree, so it must be allocated with
+         xmalloc rather than strdup */
+      mpl->error_msg = xcalloc(strlen(msg)+1, sizeof(char));
+      strcpy(mpl->error_msg, msg);
+#endif
+#if 1 /* 19/X-2026 */
+      /* the data produced so far precede the error message */
+      if (mpl->out_fp != NULL) write_buffer(mpl);
+#endif
       switch (mpl->phase)
       {  case 1:
          case 2:
@@ -549,6 +602,13 @@ MPL *mpl_initialize(void)
       mpl->tup_buf[0] = '\0';
       /* generating/postsolving segment */
       mpl->rand = rng_create_rand();
+#if 1 /* 19/X-2026 */
+      mpl->seed = 1;
+      mpl->threads = 1;
+      mpl->par = NULL;
+      mpl->par_cnt = 0;
+      mpl->wrk = NULL;
+#endif
       mpl->flag_p = 0;
       mpl->stmt = NULL;
 #if 1 /* 11/II-2008 */
@@ -558,11 +618,23 @@ MPL *mpl_initialize(void)
       mpl->n = 0;
       mpl->row = NULL;
       mpl->col = NULL;
+#if 1 /* 19/X-2026 */
+      mpl->upd_row = NULL;
+      mpl->upd_col = NULL;
+#endif
       /* input/output segment */
       mpl->in_fp = NULL;
       mpl->in_file = NULL;
       mpl->out_fp = NULL;
       mpl->out_file = NULL;
+#if 1 /* 19/X-2026 */
+      mpl->out_buf = xcalloc(OUTBUF_MAX+1, sizeof(char));
+      mpl->out_cnt = 0;
+      mpl->out_hook = NULL;
+      mpl->out_info = NULL;
+      mpl->tab_hook = NULL;
+      mpl->tab_info = NULL;
+#endif
       mpl->prt_fp = NULL;
       mpl->prt_file = NULL;
       /* solver interface segment */
@@ -716,6 +788,144 @@ done: /* return to the calling program */
       return mpl->phase;
 }
 
+#if 1 /* 19/X-2026 */
+/*----------------------------------------------------------------------
+-- mpl_put_set_data - assign set data directly.
+--
+-- *Synopsis*
+--
+-- #include "glpmpl.h"
+-- int mpl_put_set_data(MPL *mpl, char *name, int dim,
+--    const double snum[], char *sstr[], int dimen, int n,
+--    const double num[], char *str[]);
+--
+-- *Description*
+--
+-- The routine mpl_put_set_data assigns the elemental set of n n-tuples
+-- to the member of the model set, whose symbolic name is the character
+-- string name, as if the corresponding set data block were read from
+-- the data section, however, without formatting and scanning any text.
+--
+-- Each component of n-tuples and subscript lists is specified by two
+-- arrays: if the array of strings is not NULL and its k-th location is
+-- not NULL, the component is the symbol str[k], otherwise it is the
+-- number num[k].
+--
+-- Components of the subscript list of the set member are specified in
+-- locations 1, ..., dim of the arrays snum and sstr, where dim must be
+-- the dimension of the set domain (both arrays may be NULL if the set
+-- is not indexed). Components of the n-tuples of the elemental set are
+-- specified in locations 1, ..., n*dimen of the arrays num and str,
+-- n-tuple after n-tuple, where dimen must be the dimension of the set.
+--
+-- This routine may be called after the routine mpl_read_model, which
+-- returned the code 1 or 2, with the routine mpl_read_data, and with
+-- the routine mpl_put_par_data in any order, but before the routine
+-- mpl_generate.
+--
+-- *Returns*
+--
+-- The routine mpl_put_set_data returns one of the following codes:
+--
+-- 2 - data have been successfully assigned.
+-- 4 - processing failed due to some errors. In this case the calling
+--     program should call the routine mpl_terminate to terminate model
+--     processing. */
+
+static void direct_data(MPL *mpl)
+{     /* the data are not read from any input file, so there is no line
+         number and context to report in error messages */
+      xassert(mpl->in_fp == NULL);
+      mpl->line = 0;
+      memset(mpl->context, ' ', CONTEXT_SIZE);
+      mpl->c_ptr = 0;
+      mpl->phase = 2;
+      return;
+}
+
+int mpl_put_set_data(MPL *mpl, char *name, int dim,
+      const double snum[], char *sstr[], int dimen, int n,
+      const double num[], char *str[])
+{     if (!(mpl->phase == 1 || mpl->phase == 2))
+         xfault("mpl_put_set_data: invalid call sequence\n");
+      if (name == NULL)
+         xfault("mpl_put_set_data: no set name specified\n");
+      if (dim < 0 || dimen < 1)
+         xfault("mpl_put_set_data: dim = %d, dimen = %d; invalid dime"
+            "nsions\n", dim, dimen);
+      if (n < 0)
+         xfault("mpl_put_set_data: n = %d; invalid number of n-tuples"
+            "\n", n);
+      /* set up error handler */
+      if (setjmp(mpl->jump)) goto done;
+      /* assign set data */
+      direct_data(mpl);
+      direct_set_data(mpl, name, dim, snum, sstr, dimen, n, num, str);
+done: /* return to the calling program */
+      return mpl->phase;
+}
+
+/*----------------------------------------------------------------------
+-- mpl_put_par_data - assign parameter data directly.
+--
+-- *Synopsis*
+--
+-- #include "glpmpl.h"
+-- int mpl_put_par_data(MPL *mpl, char *name, int dim, int n,
+--    const double snum[], char *sstr[], const double num[],
+--    char *str[]);
+--
+-- *Description*
+--
+-- The routine mpl_put_par_data assigns values to n members of the
+-- model parameter, whose symbolic name is the character string name,
+-- as if the corresponding parameter data block were read from the data
+-- section, however, without formatting and scanning any text.
+--
+-- Components of the subscript lists of the parameter members are
+-- specified in locations 1, ..., n*dim of the arrays snum and sstr,
+-- subscript list after subscript list, where dim must be the dimension
+-- of the parameter domain (both arrays may be NULL if the parameter is
+-- not indexed), and the values are specified in locations 1, ..., n
+-- of the arrays num and str. Each component and value is specified as
+-- described for the routine mpl_put_set_data. Numeric parameters
+-- require numeric values.
+--
+-- All data for the parameter must be assigned with one call, and data
+-- for the same parameter may not be provided in the data section.
+--
+-- *Returns*
+--
+-- The routine mpl_put_par_data returns one of the following codes:
+--
+-- 2 - data have been successfully assigned.
+-- 4 - processing failed due to some errors. In this case the calling
+--     program should call the routine mpl_terminate to terminate model
+--     processing. */
+
+int mpl_put_par_data(MPL *mpl, char *name, int dim, int n,
+      const double snum[], char *sstr[], const double num[],
+      char *str[])
+{     if (!(mpl->phase == 1 || mpl->phase == 2))
+         xfault("mpl_put_par_data: invalid call sequence\n");
+      if (name == NULL)
+         xfault("mpl_put_par_data: no parameter name specified\n");
+      if (dim < 0)
+         xfault("mpl_put_par_data: dim = %d; invalid dimension\n",
+            dim);
+      if (n < 0)
+         xfault("mpl_put_par_data: n = %d; invalid number of members"
+            "\n", n);
+      /* set up error handler */
+      if (setjmp(mpl->jump)) goto done;
+      /* assign parameter data */
+      direct_data(mpl);
+      direct_parameter_data(mpl, name, dim, n, snum, sstr, num, str);
+done: /* return to the calling program */
+      return mpl->phase;
+}
+#endif
+
 /*----------------------------------------------------------------------
 -- mpl_generate - generate model.
 --
@@ -766,6 +976,10 @@ int mpl_generate(MPL *mpl, char *file)
       /* generation phase has been finished */
       xprintf("Model has been successfully generated\n");
 done: /* return to the calling program */
+#if 1 /* 19/X-2026 */
+      /* worker threads are stopped, if generating has failed */
+      if (mpl->par != NULL) par_finish(mpl);
+#endif
       return mpl->phase;
 }
 
@@ -1354,6 +1568,250 @@ done: /* return to the calling program */
       return mpl->phase;
 }
 
+#if 1 /* 19/X-2026 */
+/*----------------------------------------------------------------------
+-- mpl_reset - discard data and generated content.
+--
+-- *Synopsis*
+--
+-- #include "glpmpl.h"
+-- int mpl_reset(MPL *mpl);
+--
+-- *Description*
+--
+-- The routine mpl_reset returns the translator database to the state
+-- it had just after the model section was translated. All data read
+-- by the routines mpl_read_model and mpl_read_data, the content of all
+-- model objects, and the problem instance built by the routine
+-- mpl_generate are discarded, and the memory of the pools they were
+-- allocated from is freed, while the translated model statements
+-- are kept, so the same model may be instantiated again with another
+-- data section without translating it once more. The pseudo-random
+-- number generator is reinitialized with its original seed, and the
+-- model is generated serially again (mpl->threads = 1).
+--
+-- Note that a data section which follows the model section in the
+-- same input file is discarded as well, so such a model should be
+-- read with the flag skip_data set.
+--
+-- This routine may be called after the routine mpl_read_model, which
+-- returned the code 1 or 2, and until processing has failed.
+--
+-- *Returns*
+--
+-- The routine mpl_reset returns one of the following codes:
+--
+-- 1 - the database has been successfully reset. In this case the
+--     calling program may call the routine mpl_read_data and then the
+--     routine mpl_generate as if the model section were just read.
+-- 4 - processing failed due to some errors. In this case the calling
+--     program should call the routine mpl_terminate to terminate model
+--     processing. */
+
+int mpl_reset(MPL *mpl)
+{     if (!(mpl->phase == 1 || mpl->phase == 2 || mpl->phase == 3))
+         xfault("mpl_reset: invalid call sequence\n");
+      /* set up error handler */
+      if (setjmp(mpl->jump)) goto done;
+      xassert(mpl->in_fp == NULL);
+      xassert(mpl->dca == NULL);
+      /* close output files used by display and printf statements */
+      if (mpl->out_fp != NULL && mpl->out_fp != (void *)stdout)
+         glp_close(mpl->out_fp);
+      mpl->out_fp = NULL;
+      if (mpl->out_file != NULL)
+         xfree(mpl->out_file), mpl->out_file = NULL;
+      mpl->out_cnt = 0;
+      if (mpl->prt_fp != NULL)
+         glp_close(mpl->prt_fp), mpl->prt_fp = NULL;
+      if (mpl->prt_file != NULL)
+         xfree(mpl->prt_file), mpl->prt_file = NULL;
+      /* delete the problem instance */
+      clean_update(mpl);
+      if (mpl->row != NULL) xfree(mpl->row), mpl->row = NULL;
+      if (mpl->col != NULL) xfree(mpl->col), mpl->col = NULL;
+      mpl->m = mpl->n = 0;
+      mpl->flag_p = 0;
+      mpl->stmt = NULL;
+      /* delete content arrays and values cached in pseudo-code */
+      clean_model(mpl);
+      xassert(mpl->a_list == NULL);
+      /* now the content pools are empty; free their memory blocks, so
+         the workspace keeps only the memory used by the model */
+      {  DMP **pool[8];
+         int k;
+         pool[0] = &mpl->strings, pool[1] = &mpl->symbols;
+         pool[2] = &mpl->tuples, pool[3] = &mpl->arrays;
+         pool[4] = &mpl->members, pool[5] = &mpl->elemvars;
+         pool[6] = &mpl->formulae, pool[7] = &mpl->elemcons;
+         for (k = 0; k < 8; k++)
+         {  if (dmp_in_use(*pool[k]) != 0) continue;
+            dmp_delete_pool(*pool[k]);
+            *pool[k] = dmp_create_pool();
+         }
+      }
+      /* allocate empty content arrays as after translating the model
+         section */
+      alloc_content(mpl);
+      rng_init_rand(mpl->rand, mpl->seed);
+      xassert(mpl->par == NULL);
+      mpl->threads = 1;
+      mpl->line = 0;
+      mpl->flag_d = 0;
+      mpl->phase = 1;
+done: /* return to the calling program */
+      return mpl->phase;
+}
+
+/*----------------------------------------------------------------------
+-- mpl_update_par_data - change parameter data of generated model.
+--
+-- *Synopsis*
+--
+-- #include "glpmpl.h"
+-- int mpl_update_par_data(MPL *mpl, char *name, int dim, int n,
+--    const double snum[], char *sstr[], const double num[],
+--    char *str[]);
+--
+-- *Description*
+--
+-- The routine mpl_update_par_data assigns new values to n members of
+-- the model parameter, whose symbolic name is the character string
+-- name, after the model has been generated. The members and values are
+-- specified as for the routine mpl_put_par_data; members which have
+-- not been assigned yet are added to the parameter.
+--
+-- The parameter may be changed several times and several parameters
+-- may be changed before the routine mpl_update is called to regenerate
+-- the model objects which depend on the changed data. Other api
+-- routines must not be called in between.
+--
+-- This routine may be called after the routine mpl_generate, which
+-- returned the code 3, but not after the routine mpl_postsolve.
+--
+-- *Returns*
+--
+-- The routine mpl_update_par_data returns one of the following codes:
+--
+-- 3 - data have been successfully assigned.
+-- 4 - processing failed due to some errors. In this case the calling
+--     program should call the routine mpl_terminate to terminate model
+--     processing. */
+
+int mpl_update_par_data(MPL *mpl, char *name, int dim, int n,
+      const double snum[], char *sstr[], const double num[],
+      char *str[])
+{     STATEMENT *stmt = mpl->stmt;
+      if (!(mpl->phase == 3 && !mpl->flag_p))
+         xfault("mpl_update_par_data: invalid call sequence\n");
+      if (name == NULL)
+         xfault("mpl_update_par_data: no parameter name specified\n");
+      if (dim < 0)
+         xfault("mpl_update_par_data: dim = %d; invalid dimension\n",
+            dim);
+      if (n < 0)
+         xfault("mpl_update_par_data: n = %d; invalid number of membe"
+            "rs\n", n);
+      /* set up error handler */
+      if (setjmp(mpl->jump)) goto done;
+      /* assign parameter data; no statement is being executed */
+      mpl->stmt = NULL;
+      direct_parameter_update(mpl, name, dim, n, snum, sstr, num, str);
+      mpl->stmt = stmt;
+done: /* return to the calling program */
+      return mpl->phase;
+}
+
+/*----------------------------------------------------------------------
+-- mpl_update - regenerate model objects depending on changed data.
+--
+-- *Synopsis*
+--
+-- #include "glpmpl.h"
+-- int mpl_update(MPL *mpl);
+--
+-- *Description*
+--
+-- The routine mpl_update evaluates again the model parameters, bounds
+-- of variables, constraints, and objectives, which depend on the data
+-- changed with the routine mpl_update_par_data since the last call.
+-- Rows and columns of the problem instance stay the same; the rows and
+-- columns, whose linear forms or bounds have been changed, are marked
+-- to be applied to the problem object (see glp_mpl_update_prob).
+--
+-- Model sets as well as domains of variables and constraints must not
+-- depend on the changed data, and constraints must not refer to new
+-- elemental variables, since it would change the problem structure.
+-- Check, display, printf, and table statements preceding the solve
+-- statement are not executed again.
+--
+-- *Returns*
+--
+-- The routine mpl_update returns one of the following codes:
+--
+-- 3 - the model has been successfully updated.
+-- 4 - processing failed due to some errors. In this case the calling
+--     program should call the routine mpl_terminate to terminate model
+--     processing. */
+
+int mpl_update(MPL *mpl)
+{     if (!(mpl->phase == 3 && !mpl->flag_p))
+         xfault("mpl_update: invalid call sequence\n");
+      /* set up error handler */
+      if (setjmp(mpl->jump)) goto done;
+      /* regenerate model objects */
+      update_model(mpl);
+done: /* return to the calling program */
+      return mpl->phase;
+}
+
+/*----------------------------------------------------------------------
+-- mpl_get_pool_stats - obtain statistics of memory pool.
+--
+-- *Synopsis*
+--
+-- #include "glpmpl.h"
+-- char *mpl_get_pool_stats(MPL *mpl, int k, size_t *count,
+--    size_t *total);
+--
+-- *Description*
+--
+-- The routine mpl_get_pool_stats stores the number of atoms currently
+-- in use in k-th memory pool of the translator to the location count,
+-- and the total size of memory blocks allocated to the pool, in bytes,
+-- to the location total. Either location may be NULL.
+--
+-- The pools are numbered as follows: 1 - the pool of the translated
+-- model, 2 to 9 - the pools of model content: strings, symbols,
+-- tuples, arrays, members, elemvars, formulae and elemcons.
+--
+-- *Returns*
+--
+-- The routine returns the name of k-th pool, or NULL if k is not a
+-- valid pool number. */
+
+char *mpl_get_pool_stats(MPL *mpl, int k, size_t *count,
+      size_t *total)
+{     DMP *pool;
+      char *name;
+      switch (k)
+      {  case 1: pool = mpl->pool,     name = "model";    break;
+         case 2: pool = mpl->strings,  name = "strings";  break;
+         case 3: pool = mpl->symbols,  name = "symbols";  break;
+         case 4: pool = mpl->tuples,   name = "tuples";   break;
+         case 5: pool = mpl->arrays,   name = "arrays";   break;
+         case 6: pool = mpl->members,  name = "members";  break;
+         case 7: pool = mpl->elemvars, name = "elemvars"; break;
+         case 8: pool = mpl->formulae, name = "formulae"; break;
+         case 9: pool = mpl->elemcons, name = "elemcons"; break;
+         default: return NULL;
+      }
+      if (count != NULL) *count = dmp_in_use(pool);
+      if (total != NULL) *total = dmp_size(pool);
+      return name;
+}
+#endif
+
 /*----------------------------------------------------------------------
 -- mpl_terminate - free all resources used by translator.
 --
@@ -1383,10 +1841,10 @@ void mpl_terminate(MPL *mpl)
             break;
          case 4:
             /* model processing has been finished due to error; delete
-               search trees, which may be created for some arrays */
+               hash tables, which may be created for some arrays */
             {  ARRAY *a;
                for (a = mpl->a_list; a != NULL; a = a->next)
-                  if (a->tree != NULL) avl_delete_tree(a->tree);
+                  if (a->hash != NULL) xfree(a->hash);
             }
 #if 1 /* 11/II-2008 */
             free_dca(mpl);
@@ -1415,10 +1873,17 @@ void mpl_terminate(MPL *mpl)
       rng_delete_rand(mpl->rand);
       if (mpl->row != NULL) xfree(mpl->row);
       if (mpl->col != NULL) xfree(mpl->col);
+#if 1 /* 19/X-2026 */
+      if (mpl->upd_row != NULL) xfree(mpl->upd_row);
+      if (mpl->upd_col != NULL) xfree(mpl->upd_col);
+#endif
       if (mpl->in_fp != NULL) glp_close(mpl->in_fp);
       if (mpl->out_fp != NULL && mpl->out_fp != (void *)stdout)
          glp_close(mpl->out_fp);
       if (mpl->out_file != NULL) xfree(mpl->out_file);
+#if 1 /* 19/X-2026 */
+      xfree(mpl->out_buf);
+#endif
       if (mpl->prt_fp != NULL) glp_close(mpl->prt_fp);
       if (mpl->prt_file != NULL) xfree(mpl->prt_file);
       if (mpl->mod_file != NULL) xfree(mpl->mod_file);
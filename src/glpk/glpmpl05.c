@@ -35,6 +35,9 @@ double fn_gmtime(MPL *mpl)
       time_t timer;
       struct tm *tm;
       int j;
+#if 1 /* 19/X-2026 */
+      if (mpl->wrk != NULL) par_unsafe(mpl);
+#endif
       time(&timer);
       if (timer == (time_t)(-1))
 err:     error(mpl, "gmtime(); unable to obtain current calendar time");
@@ -885,10 +885,159 @@ skip:    ;
 
 /**********************************************************************/
 
+#if 1 /* 19/X-2026 */
+#define JS_BATCH_MAX 4096
+/* maximal number of records passed to the table hook at once */
+
+struct js
+{     /* output table, whose records are passed to the table hook in
+         batches rather than written to a file */
+      int (*hook)(void *info, const char *table, int nf,
+         const char *name[], int nr, const double *num[],
+         const char **str[]);
+      /* hook routine receiving the batches */
+      void *info;
+      /* transit pointer passed to the hook routine */
+      const char *table;
+      /* name of the table */
+      int nf;
+      /* number of fields */
+      const char **name; /* const char *name[1+nf]; */
+      /* name[k], 1 <= k <= nf, is name of k-th field */
+      int nr;
+      /* number of records in the current batch */
+      double **num; /* double num[1+nf][1+JS_BATCH_MAX]; */
+      /* num[k][r] is numeric value of k-th field in r-th record of the
+         batch (zero if the value is a string) */
+      int **pos; /* int pos[1+nf][1+JS_BATCH_MAX]; */
+      /* pos[k][r] is the position of string value of k-th field in r-th
+         record in the text buffer, or -1 if the value is numeric */
+      const char ***str; /* const char *str[1+nf][1+JS_BATCH_MAX]; */
+      /* str[k][r] is pointer to string value of k-th field in r-th
+         record, or NULL if the value is numeric; these pointers are
+         only built on passing the batch to the hook routine */
+      char *text; /* char text[size]; */
+      /* text buffer storing string values of the current batch */
+      int len, size;
+      /* number of characters used in and size of the text buffer */
+};
+
+static struct js *js_open_file(MPL *mpl, TABDCA *dca, int mode)
+{     /* open output table passed to the table hook */
+      struct js *js;
+      int k;
+      if (mode != 'W')
+      {  xprintf("JS driver: input tables not supported\n");
+         return NULL;
+      }
+      if (mpl->tab_hook == NULL)
+      {  xprintf("JS driver: table hook not installed\n");
+         return NULL;
+      }
+      js = xmalloc(sizeof(struct js));
+      js->hook = mpl->tab_hook;
+      js->info = mpl->tab_info;
+      js->table = mpl->stmt->u.tab->name;
+      js->nf = mpl_tab_num_flds(dca);
+      js->name = xcalloc(1+js->nf, sizeof(char *));
+      js->num = xcalloc(1+js->nf, sizeof(double *));
+      js->pos = xcalloc(1+js->nf, sizeof(int *));
+      js->str = xcalloc(1+js->nf, sizeof(char **));
+      for (k = 1; k <= js->nf; k++)
+      {  js->name[k] = mpl_tab_get_name(dca, k);
+         js->num[k] = xcalloc(1+JS_BATCH_MAX, sizeof(double));
+         js->pos[k] = xcalloc(1+JS_BATCH_MAX, sizeof(int));
+         js->str[k] = xcalloc(1+JS_BATCH_MAX, sizeof(char *));
+      }
+      js->nr = 0;
+      js->size = 1024;
+      js->text = xcalloc(js->size, sizeof(char));
+      js->len = 0;
+      return js;
+}
+
+static int js_flush_batch(struct js *js)
+{     /* pass the current batch to the table hook */
+      int k, r, ret;
+      if (js->nr == 0)
+         return 0;
+      for (k = 1; k <= js->nf; k++)
+      {  for (r = 1; r <= js->nr; r++)
+            js->str[k][r] = (js->pos[k][r] < 0 ? NULL :
+               js->text + js->pos[k][r]);
+      }
+      ret = js->hook(js->info, js->table, js->nf, js->name, js->nr,
+         (const double **)js->num, js->str);
+      if (ret != 0)
+         xprintf("JS driver: table %s rejected by hook\n", js->table);
+      js->nr = 0;
+      js->len = 0;
+      return ret != 0;
+}
+
+static int js_write_record(TABDCA *dca, struct js *js)
+{     /* add next record to the current batch */
+      int k, r, len;
+      const char *str;
+      r = ++(js->nr);
+      for (k = 1; k <= js->nf; k++)
+      {  switch (mpl_tab_get_type(dca, k))
+         {  case 'N':
+               js->num[k][r] = mpl_tab_get_num(dca, k);
+               js->pos[k][r] = -1;
+               break;
+            case 'S':
+               str = mpl_tab_get_str(dca, k);
+               len = strlen(str);
+               if (js->size - js->len < len + 1)
+               {  char *text = js->text;
+                  while (js->size - js->len < len + 1)
+                     js->size += js->size;
+                  js->text = xcalloc(js->size, sizeof(char));
+                  memcpy(js->text, text, js->len);
+                  xfree(text);
+               }
+               strcpy(js->text + js->len, str);
+               js->num[k][r] = 0.0;
+               js->pos[k][r] = js->len;
+               js->len += len + 1;
+               break;
+            default:
+               xassert(dca != dca);
+         }
+      }
+      return js->nr == JS_BATCH_MAX ? js_flush_batch(js) : 0;
+}
+
+static int js_close_file(TABDCA *dca, struct js *js)
+{     /* pass the last batch and close output table */
+      int k, ret;
+      xassert(dca == dca);
+      ret = js_flush_batch(js);
+      for (k = 1; k <= js->nf; k++)
+      {  xfree(js->num[k]);
+         xfree(js->pos[k]);
+         xfree(js->str[k]);
+      }
+      xfree(js->name);
+      xfree(js->num);
+      xfree(js->pos);
+      xfree(js->str);
+      xfree(js->text);
+      xfree(js);
+      return ret;
+}
+#endif
+
+/**********************************************************************/
+
 #define TAB_CSV   1
 #define TAB_XBASE 2
 #define TAB_ODBC  3
 #define TAB_MYSQL 4
+#if 1 /* 19/X-2026 */
+#define TAB_JS    5
+#endif
 
 void mpl_tab_drv_open(MPL *mpl, int mode)
 {     TABDCA *dca = mpl->dca;
@@ -912,6 +1061,12 @@ void mpl_tab_drv_open(MPL *mpl, int mode)
       {  dca->id = TAB_MYSQL;
          dca->link = db_mysql_open(dca, mode);
       }
+#if 1 /* 19/X-2026 */
+      else if (strcmp(dca->arg[1], "JS") == 0)
+      {  dca->id = TAB_JS;
+         dca->link = js_open_file(mpl, dca, mode);
+      }
+#endif
       else
          xprintf("Invalid table driver '%s'\n", dca->arg[1]);
       if (dca->link == NULL)
@@ -961,6 +1116,11 @@ void mpl_tab_drv_write(MPL *mpl)
          case TAB_MYSQL:
             ret = db_mysql_write(dca, dca->link);
             break;
+#if 1 /* 19/X-2026 */
+         case TAB_JS:
+            ret = js_write_record(dca, dca->link);
+            break;
+#endif
          default:
             xassert(dca != dca);
       }
@@ -986,6 +1146,11 @@ void mpl_tab_drv_close(MPL *mpl)
          case TAB_MYSQL:
             ret = db_mysql_close(dca, dca->link);
             break;
+#if 1 /* 19/X-2026 */
+         case TAB_JS:
+            ret = js_close_file(dca, dca->link);
+            break;
+#endif
          default:
             xassert(dca != dca);
       }
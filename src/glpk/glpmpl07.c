@@ -0,0 +1,882 @@
+/* glpmpl07.c (parallel generation of model constraints) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include <limits.h>
+#include <pthread.h>
+#include "glpk.h"
+#include "glpmpl.h"
+
+/***********************************************************************
+*  If mpl->threads > 1, model constraints and objectives are evaluated
+*  by worker threads, while the calling thread executes the model
+*  statements in their original order as usual.
+*
+*  Every worker translates the model section once more into a private
+*  translator database (replica), which is created in the worker's own
+*  environment, and copies the data provided for model sets and
+*  parameters from the original database. Then the worker walks through
+*  the constraint statements enumerating the entire domain of each of
+*  them. Domain members are divided into blocks of GEN_BLOCK consecutive
+*  members, which are assigned to the workers in turn (starting from a
+*  different worker for every statement, so small statements are also
+*  spread), and the worker evaluates the members of its own blocks. For
+*  every elemental constraint the worker stores its n-tuple, bounds and
+*  linear form to a buffer together with the list of elemental variables
+*  in the order they have been referenced; variables are identified by
+*  the model variable and n-tuple.
+*
+*  On executing a constraint statement the calling thread waits for all
+*  the workers to finish the statement and merges their buffers in the
+*  order of domain members. Elemental variables referenced by a member
+*  are found or created in the original database in the order they have
+*  been referenced, so elemental variables are created in the same order
+*  as by the serial generator, and numbering of rows and columns of the
+*  problem instance does not depend on the number of threads.
+*
+*  Evaluations that cannot be reproduced by a replica (pseudo-random
+*  numbers, current time, references to other elemental constraints or
+*  to variables out of a constraint member) and errors stop the worker.
+*  In this case the calling thread merges the members which precede the
+*  point where the worker has stopped and generates the rest of the
+*  model serially; thus, errors are reported as by the serial generator.
+*  Models containing table statements are always generated serially,
+*  since tables are read on the generating phase.
+*
+*  Buffers are allocated with malloc rather than with xmalloc, since
+*  they are filled and freed by different threads each having its own
+*  environment. */
+
+#define GEN_BLOCK 64
+/* number of consecutive domain members assigned to a worker */
+
+typedef struct GENBUF GENBUF;
+
+struct GENBUF
+{     /* members of a model constraint evaluated by a worker; each
+         member is stored as follows:
+         iv: t, len(iv), len(dv), len(cv), tuple, nref, nref times
+             (variable number, tuple), nterm, nterm times (reference
+             number);
+         dv: numeric components of tuples, lbnd, ubnd, nterm times
+             (coefficient);
+         cv: symbolic components of tuples;
+         where t is the ordinal number of the domain member, len(x) is
+         the number of elements of x used by the member; every tuple
+         component is stored in iv as 0, if it is numeric, or as the
+         length of symbolic value plus one */
+      int *iv; /* int iv[ni_max]; */
+      int ni, ni_max;
+      double *dv; /* double dv[nd_max]; */
+      int nd, nd_max;
+      char *cv; /* char cv[nc_max]; */
+      int nc, nc_max;
+      int stop;
+      /* ordinal number of the domain member, at which the worker has
+         stopped; -1 means the worker has evaluated all its members */
+      int ri, rd, rc;
+      /* read positions in iv, dv, cv (used by the calling thread) */
+};
+
+struct GENWRK
+{     /* worker thread */
+      GENPAR *P;
+      /* parallel generation, which the worker belongs to */
+      int id;
+      /* worker number, 0 <= id < nthreads */
+      pthread_t tid;
+      /* thread identifier */
+      int ready;
+      /* +1 replica has been created, -1 creating replica failed */
+      int done;
+      /* number of constraint statements finished by the worker */
+      /*--------------------------------------------------------------*/
+      /* the following fields are used by the worker only */
+      MPL *mpl;
+      /* replica of the original database */
+      int nv;
+      /* number of model variables */
+      VARIABLE **var; /* VARIABLE *var[1+nv]; */
+      /* model variables of the replica in their original order */
+      int last;
+      /* number of the variable found last in the list var */
+      int s;
+      /* ordinal number of the current constraint statement */
+      GENBUF *buf;
+      /* buffer for the current constraint statement */
+      int t;
+      /* ordinal number of the next domain member */
+      int row;
+      /* ordinal number of the member being evaluated; -1 means the
+         domain is being enumerated */
+      int own;
+      /* the next reference to elemental constraint is the member being
+         evaluated */
+      int unsafe;
+      /* evaluation which cannot be reproduced has been performed */
+      int fail;
+      /* memory allocation for the buffer failed */
+      int halt;
+      /* the calling thread has stopped the workers */
+      int nref, ref_max;
+      ELEMVAR **ref; /* ELEMVAR *ref[ref_max]; */
+      /* elemental variables referenced by the current member */
+};
+
+struct GENPAR
+{     /* parallel generation */
+      MPL *mpl;
+      /* original database */
+      int max;
+      /* number of worker threads requested */
+      int nthreads;
+      /* number of worker threads started */
+      int nc;
+      /* number of constraint statements preceding solve statement */
+      GENWRK *wrk; /* GENWRK wrk[max]; */
+      /* worker threads */
+      GENBUF *buf; /* GENBUF buf[nc*max]; */
+      /* buf[s*max+k] is the buffer of s-th constraint statement filled
+         by k-th worker */
+      pthread_mutex_t lock;
+      pthread_cond_t cond;
+      /* lock and condition protecting the fields below and fields
+         ready and done of workers */
+      int nready;
+      /* number of workers which have finished creating replicas */
+      int go;
+      /* workers may start evaluating constraints */
+      int stop;
+      /* workers should stop */
+      /*--------------------------------------------------------------*/
+      /* the following fields are used by the calling thread only */
+      int s;
+      /* ordinal number of the next constraint statement */
+      CONSTRAINT **con; /* CONSTRAINT *con[1+nc]; */
+      /* constraint statements in their original order */
+      VARIABLE **var; /* VARIABLE *var[1+nv]; */
+      /* model variables in their original order */
+      int ev_max;
+      ELEMVAR **ev; /* ELEMVAR *ev[ev_max]; */
+      /* elemental variables referenced by the member being merged */
+};
+
+/*----------------------------------------------------------------------
+-- put_int, put_num, put_str - store data to the buffer.
+--
+-- These routines append data to the buffer of the current constraint
+-- statement. If memory allocation fails, the flag fail is set and all
+-- subsequent data are ignored. */
+
+static int grow(void **ptr, int *max, int need, int size)
+{     /* enlarge array so that it contains at least need elements */
+      void *temp;
+      int new_max = *max;
+      while (new_max < need)
+      {  if (new_max > INT_MAX / 2 - 1000) return 1;
+         new_max = new_max + new_max + 1000;
+      }
+      if ((size_t)new_max > (size_t)(-1) / (size_t)size) return 1;
+      temp = realloc(*ptr, (size_t)new_max * (size_t)size);
+      if (temp == NULL) return 1;
+      *ptr = temp, *max = new_max;
+      return 0;
+}
+
+static void put_int(GENWRK *W, int val)
+{     GENBUF *b = W->buf;
+      if (W->fail) return;
+      if (b->ni == b->ni_max && grow((void **)&b->iv, &b->ni_max,
+         b->ni+1, sizeof(int)))
+      {  W->fail = 1;
+         return;
+      }
+      b->iv[b->ni++] = val;
+      return;
+}
+
+static void put_num(GENWRK *W, double val)
+{     GENBUF *b = W->buf;
+      if (W->fail) return;
+      if (b->nd == b->nd_max && grow((void **)&b->dv, &b->nd_max,
+         b->nd+1, sizeof(double)))
+      {  W->fail = 1;
+         return;
+      }
+      b->dv[b->nd++] = val;
+      return;
+}
+
+static void put_str(GENWRK *W, const char *str, int len)
+{     GENBUF *b = W->buf;
+      if (W->fail) return;
+      if (b->nc_max - b->nc < len && grow((void **)&b->cv,
+         &b->nc_max, b->nc+len, sizeof(char)))
+      {  W->fail = 1;
+         return;
+      }
+      memcpy(b->cv + b->nc, str, len);
+      b->nc += len;
+      return;
+}
+
+static void put_tuple(GENWRK *W, TUPLE *tuple)
+{     /* store n-tuple to the buffer */
+      int len;
+      for (; tuple != NULL; tuple = tuple->next)
+      {  if (tuple->sym->str == NULL)
+         {  put_int(W, 0);
+            put_num(W, tuple->sym->num);
+         }
+         else
+         {  len = strlen(tuple->sym->str);
+            put_int(W, len+1);
+            put_str(W, tuple->sym->str, len);
+         }
+      }
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- add_ref - add entry to the list of referenced elemental variables.
+--
+-- This routine appends an empty entry to the list of elemental
+-- variables referenced by the member being evaluated and returns its
+-- number. */
+
+static int add_ref(GENWRK *W)
+{     if (W->nref == W->ref_max)
+      {  ELEMVAR **ref;
+         W->ref_max += W->ref_max + 100;
+         ref = xcalloc(W->ref_max, sizeof(ELEMVAR *));
+         if (W->nref > 0)
+            memcpy(ref, W->ref, W->nref * sizeof(ELEMVAR *));
+         if (W->ref != NULL) xfree(W->ref);
+         W->ref = ref;
+      }
+      W->ref[W->nref] = NULL;
+      return W->nref++;
+}
+
+/*----------------------------------------------------------------------
+-- var_number - determine ordinal number of model variable.
+--
+-- This routine returns the ordinal number of model variable in the
+-- replica, which is the same as in the original database. */
+
+static int var_number(GENWRK *W, VARIABLE *var)
+{     int k;
+      if (W->var[W->last] != var)
+      {  for (k = 0; k < W->nv; k++)
+            if (W->var[k] == var) break;
+         xassert(k < W->nv);
+         W->last = k;
+      }
+      return W->last;
+}
+
+/*----------------------------------------------------------------------
+-- put_member - store evaluated elemental constraint to the buffer.
+--
+-- This routine stores elemental constraint, which has been evaluated
+-- for t-th domain member, to the buffer of the current statement and
+-- returns zero. If memory allocation fails, the routine returns
+-- non-zero; in this case the buffer is left unchanged. */
+
+static int put_member(GENWRK *W, int t, ELEMCON *refer)
+{     GENBUF *b = W->buf;
+      FORMULA *term;
+      ELEMVAR *var;
+      int ni = b->ni, nd = b->nd, nc = b->nc, nref, nterm, k;
+      /* build the list of distinct elemental variables in the order of
+         their first references; field j of elemental variables (which
+         is not used until the problem is built) temporarily keeps the
+         number of the variable in the list plus one */
+      nref = W->nref, W->nref = 0;
+      for (k = 0; k < nref; k++)
+      {  var = W->ref[k];
+         xassert(var != NULL);
+         if (var->j == 0)
+            W->ref[W->nref++] = var, var->j = W->nref;
+      }
+      /* linear forms may be cached, in which case their variables have
+         been referenced by previous members evaluated by the worker */
+      nterm = 0;
+      for (term = refer->form; term != NULL; term = term->next)
+      {  var = term->var;
+         xassert(var != NULL);
+         if (var->j == 0)
+         {  k = add_ref(W);
+            W->ref[k] = var, var->j = W->nref;
+         }
+         nterm++;
+      }
+      /* store the member */
+      put_int(W, t);
+      put_int(W, 0);
+      put_int(W, 0);
+      put_int(W, 0);
+      put_tuple(W, refer->memb->tuple);
+      put_int(W, W->nref);
+      for (k = 0; k < W->nref; k++)
+      {  var = W->ref[k];
+         put_int(W, var_number(W, var->var));
+         put_tuple(W, var->memb->tuple);
+      }
+      put_num(W, refer->lbnd);
+      put_num(W, refer->ubnd);
+      put_int(W, nterm);
+      for (term = refer->form; term != NULL; term = term->next)
+      {  put_int(W, term->var->j - 1);
+         put_num(W, term->coef);
+      }
+      for (k = 0; k < W->nref; k++)
+         W->ref[k]->j = 0;
+      W->nref = 0;
+      if (W->fail)
+      {  b->ni = ni, b->nd = nd, b->nc = nc;
+         return 1;
+      }
+      b->iv[ni+1] = b->ni - ni;
+      b->iv[ni+2] = b->nd - nd;
+      b->iv[ni+3] = b->nc - nc;
+      return 0;
+}
+
+/*----------------------------------------------------------------------
+-- gen_member - evaluate domain member assigned to the worker.
+--
+-- This routine is called by loop_within_domain for every member of the
+-- domain of the current constraint. If the member belongs to a block
+-- assigned to the worker, the routine evaluates it and stores the
+-- resulting elemental constraint. Non-zero return stops enumeration. */
+
+static int gen_member(MPL *mpl, void *info)
+{     GENWRK *W = info;
+      GENPAR *P = W->P;
+      CONSTRAINT *con = mpl->stmt->u.con;
+      TUPLE *tuple;
+      ELEMCON *refer;
+      int t = W->t++;
+      if (t % GEN_BLOCK == 0)
+      {  /* check if the calling thread does not need the workers */
+         pthread_mutex_lock(&P->lock);
+         W->halt = P->stop;
+         pthread_mutex_unlock(&P->lock);
+         if (W->halt) return 1;
+      }
+      if ((t / GEN_BLOCK + W->s) % P->nthreads != W->id)
+         return 0;
+      W->row = t;
+      W->own = 1;
+      W->nref = 0;
+      tuple = get_domain_tuple(mpl, con->domain);
+      refer = eval_member_con(mpl, con, tuple);
+      delete_tuple(mpl, tuple);
+      if (W->unsafe || put_member(W, t, refer))
+      {  W->buf->stop = t;
+         return 1;
+      }
+      /* the linear form is not needed anymore */
+      delete_formula(mpl, refer->form), refer->form = NULL;
+      W->row = -1;
+      return 0;
+}
+
+/*----------------------------------------------------------------------
+-- par_enter_var, par_leave_var - note reference to elemental variable.
+--
+-- These routines are called by eval_member_var in a replica on entry
+-- and on exit, respectively. The first one reserves an entry in the
+-- list of references, so nested references (made on computing bounds
+-- of a new elemental variable) follow the outer one, and returns its
+-- number; the second one stores the evaluated reference in the entry.
+-- References made while the domain is being enumerated cannot be
+-- reproduced and stop the worker. */
+
+int par_enter_var(MPL *mpl)
+{     GENWRK *W = mpl->wrk;
+      if (W->row < 0) W->unsafe = 1;
+      return add_ref(W);
+}
+
+void par_leave_var(MPL *mpl, int k, ELEMVAR *refer)
+{     GENWRK *W = mpl->wrk;
+      xassert(0 <= k && k < W->nref);
+      W->ref[k] = refer;
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- par_enter_con - note reference to elemental constraint.
+--
+-- This routine is called by eval_member_con in a replica. The only
+-- reference allowed is the one to the member being evaluated. */
+
+void par_enter_con(MPL *mpl)
+{     GENWRK *W = mpl->wrk;
+      if (W->own)
+         W->own = 0;
+      else
+         W->unsafe = 1;
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- par_unsafe - note evaluation which cannot be reproduced.
+--
+-- This routine is called by a replica on generating pseudo-random
+-- numbers and obtaining the current time, since their values depend on
+-- the order of evaluation. */
+
+void par_unsafe(MPL *mpl)
+{     mpl->wrk->unsafe = 1;
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- copy_data - copy data of the original database to the replica.
+--
+-- This routine checks that the replica contains the same statements as
+-- the original database, copies all data provided for model sets and
+-- parameters and builds the list of model variables. The original
+-- database is not changed, while the calling thread waits for all the
+-- workers to finish copying. Non-zero return means that the model
+-- section translated by the worker is different. */
+
+static SYMBOL *copy_sym(MPL *mpl, SYMBOL *sym)
+{     if (sym->str == NULL)
+         return create_symbol_num(mpl, sym->num);
+      return create_symbol_str(mpl, create_string(mpl, sym->str));
+}
+
+static TUPLE *copy_tup(MPL *mpl, TUPLE *tuple)
+{     TUPLE *copy = create_tuple(mpl);
+      for (; tuple != NULL; tuple = tuple->next)
+         copy = expand_tuple(mpl, copy, copy_sym(mpl, tuple->sym));
+      return copy;
+}
+
+static int copy_data(GENWRK *W)
+{     MPL *orig = W->P->mpl, *mpl = W->mpl;
+      STATEMENT *stmt, *copy;
+      MEMBER *memb, *temp;
+      ELEMSET *set;
+      W->nv = 0;
+      for (stmt = orig->model, copy = mpl->model; stmt != NULL;
+         stmt = stmt->next, copy = copy->next)
+      {  if (copy == NULL || copy->type != stmt->type ||
+             copy->line != stmt->line)
+            return 1;
+         if (stmt->type == A_VARIABLE) W->nv++;
+      }
+      if (copy != NULL) return 1;
+      W->var = xcalloc(1+W->nv, sizeof(VARIABLE *));
+      W->nv = W->last = 0;
+      for (stmt = orig->model, copy = mpl->model; stmt != NULL;
+         stmt = stmt->next, copy = copy->next)
+      {  switch (stmt->type)
+         {  case A_SET:
+               if (stmt->u.set->data == 0) break;
+               copy->u.set->data = 1;
+               for (memb = stmt->u.set->array->head; memb != NULL;
+                  memb = memb->next)
+               {  set = create_elemset(mpl, memb->value.set->dim);
+                  for (temp = memb->value.set->head; temp != NULL;
+                     temp = temp->next)
+                     add_tuple(mpl, set, copy_tup(mpl, temp->tuple));
+                  add_member(mpl, copy->u.set->array,
+                     copy_tup(mpl, memb->tuple))->value.set = set;
+               }
+               break;
+            case A_PARAMETER:
+               if (stmt->u.par->data == 0) break;
+               copy->u.par->data = 1;
+               if (stmt->u.par->defval != NULL)
+                  copy->u.par->defval =
+                     copy_sym(mpl, stmt->u.par->defval);
+               for (memb = stmt->u.par->array->head; memb != NULL;
+                  memb = memb->next)
+               {  temp = add_member(mpl, copy->u.par->array,
+                     copy_tup(mpl, memb->tuple));
+                  switch (stmt->u.par->array->type)
+                  {  case A_NUMERIC:
+                        temp->value.num = memb->value.num;
+                        break;
+                     case A_SYMBOLIC:
+                        temp->value.sym =
+                           copy_sym(mpl, memb->value.sym);
+                        break;
+                     default:
+                        xassert(stmt != stmt);
+                  }
+               }
+               break;
+            case A_VARIABLE:
+               W->var[W->nv++] = copy->u.var;
+               break;
+            default:
+               break;
+         }
+      }
+      return 0;
+}
+
+/*----------------------------------------------------------------------
+-- run_worker - worker thread routine.
+--
+-- The worker creates the replica, waits for the signal to start, and
+-- then evaluates its members of all constraint statements preceding
+-- the solve statement. The worker stops on the first error or the
+-- first evaluation which cannot be reproduced. */
+
+static void run_worker(GENWRK *W)
+{     GENPAR *P = W->P;
+      MPL *mpl;
+      STATEMENT *stmt;
+      int ret, ok;
+      mpl = W->mpl = mpl_initialize();
+      ret = mpl_read_model(mpl, P->mpl->mod_file, 1);
+      ok = ((ret == 1 || ret == 2) && copy_data(W) == 0);
+      pthread_mutex_lock(&P->lock);
+      W->ready = (ok ? +1 : -1);
+      P->nready++;
+      pthread_cond_broadcast(&P->cond);
+      while (ok && !(P->go || P->stop))
+         pthread_cond_wait(&P->cond, &P->lock);
+      ok = (ok && !P->stop);
+      pthread_mutex_unlock(&P->lock);
+      if (!ok) goto done;
+      mpl->phase = 3;
+      mpl->wrk = W;
+      W->s = 0;
+      if (setjmp(mpl->jump))
+      {  /* evaluation error; the calling thread will repeat evaluation
+            of the current statement and report the error */
+         W->buf->stop = (W->row >= 0 ? W->row : W->t);
+         goto done;
+      }
+      for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
+      {  if (stmt->type == A_SOLVE) break;
+         if (stmt->type != A_CONSTRAINT) continue;
+         mpl->stmt = stmt;
+         W->buf = &P->buf[W->s * P->max + W->id];
+         W->t = 0, W->row = -1;
+         loop_within_domain(mpl, stmt->u.con->domain, W, gen_member);
+         if (W->halt || W->buf->stop >= 0) break;
+         if (W->unsafe)
+         {  /* made on enumerating the rest of the domain */
+            W->buf->stop = W->t;
+            break;
+         }
+         pthread_mutex_lock(&P->lock);
+         W->done = ++(W->s);
+         pthread_cond_broadcast(&P->cond);
+         pthread_mutex_unlock(&P->lock);
+      }
+done: pthread_mutex_lock(&P->lock);
+      W->done = P->nc;
+      pthread_cond_broadcast(&P->cond);
+      pthread_mutex_unlock(&P->lock);
+      mpl->wrk = NULL;
+      mpl_terminate(mpl);
+      if (W->var != NULL) xfree(W->var);
+      if (W->ref != NULL) xfree(W->ref);
+      return;
+}
+
+static void *worker_thread(void *arg)
+{     /* the worker thread has its own environment, which is created on
+         the first call to the library and freed on exit */
+      GENWRK *W = arg;
+      glp_term_out(GLP_OFF);
+      run_worker(W);
+      glp_free_env();
+      return NULL;
+}
+
+/*----------------------------------------------------------------------
+-- par_start - start worker threads to generate model constraints.
+--
+-- This routine is called by generate_model before executing the model
+-- statements. If mpl->threads > 1 and the model allows parallel
+-- generation, the routine starts worker threads and waits until they
+-- have created replicas of the model; otherwise, or if creating any
+-- replica fails, the model is generated serially (mpl->par = NULL). */
+
+void par_start(MPL *mpl)
+{     GENPAR *P;
+      STATEMENT *stmt;
+      int k, nc = 0, nv = 0, ok;
+      xassert(mpl->par == NULL);
+      mpl->par_cnt = 0;
+      if (mpl->threads < 2 || mpl->mod_file == NULL) return;
+      for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
+      {  if (stmt->type == A_TABLE) return;
+         if (stmt->type == A_VARIABLE) nv++;
+      }
+      for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
+      {  if (stmt->type == A_SOLVE) break;
+         if (stmt->type == A_CONSTRAINT) nc++;
+      }
+      if (nc == 0) return;
+      P = malloc(sizeof(GENPAR));
+      if (P == NULL) return;
+      memset(P, 0, sizeof(GENPAR));
+      P->mpl = mpl;
+      P->max = mpl->threads;
+      P->nc = nc;
+      P->wrk = calloc(P->max, sizeof(GENWRK));
+      P->buf = calloc((size_t)nc * (size_t)P->max, sizeof(GENBUF));
+      if (P->wrk == NULL || P->buf == NULL)
+      {  free(P->wrk), free(P->buf), free(P);
+         return;
+      }
+      for (k = 0; k < nc * P->max; k++)
+         P->buf[k].stop = -1;
+      P->con = xcalloc(1+nc, sizeof(CONSTRAINT *));
+      P->var = xcalloc(1+nv, sizeof(VARIABLE *));
+      nc = nv = 0;
+      for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
+      {  if (stmt->type == A_VARIABLE) P->var[nv++] = stmt->u.var;
+         if (stmt->type == A_CONSTRAINT && nc < P->nc)
+            P->con[nc++] = stmt->u.con;
+      }
+      pthread_mutex_init(&P->lock, NULL);
+      pthread_cond_init(&P->cond, NULL);
+      mpl->par = P;
+      /* start workers */
+      for (k = 0; k < P->max; k++)
+      {  P->wrk[k].P = P;
+         P->wrk[k].id = k;
+         P->wrk[k].row = -1;
+         if (pthread_create(&P->wrk[k].tid, NULL, worker_thread,
+            &P->wrk[k]) != 0)
+         {  /* use only threads started so far */
+            break;
+         }
+      }
+      /* wait for the workers to copy the data; the original database
+         must not be changed until then */
+      pthread_mutex_lock(&P->lock);
+      P->nthreads = k;
+      while (P->nready < P->nthreads)
+         pthread_cond_wait(&P->cond, &P->lock);
+      ok = (P->nthreads > 0);
+      for (k = 0; k < P->nthreads; k++)
+         if (P->wrk[k].ready < 0) ok = 0;
+      if (ok)
+         P->go = 1;
+      else
+         P->stop = 1;
+      pthread_cond_broadcast(&P->cond);
+      pthread_mutex_unlock(&P->lock);
+      if (!ok) par_finish(mpl);
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- par_finish - stop worker threads.
+--
+-- This routine stops and joins all the worker threads, frees all the
+-- buffers and resets mpl->par, so the rest of the model, if any, is
+-- generated serially. */
+
+void par_finish(MPL *mpl)
+{     GENPAR *P = mpl->par;
+      GENBUF *b;
+      int k;
+      xassert(P != NULL);
+      pthread_mutex_lock(&P->lock);
+      P->stop = 1;
+      pthread_cond_broadcast(&P->cond);
+      pthread_mutex_unlock(&P->lock);
+      for (k = 0; k < P->nthreads; k++)
+         pthread_join(P->wrk[k].tid, NULL);
+      pthread_mutex_destroy(&P->lock);
+      pthread_cond_destroy(&P->cond);
+      for (k = 0, b = P->buf; k < P->nc * P->max; k++, b++)
+         free(b->iv), free(b->dv), free(b->cv);
+      free(P->buf);
+      free(P->wrk);
+      xfree(P->con);
+      xfree(P->var);
+      if (P->ev != NULL) xfree(P->ev);
+      free(P);
+      mpl->par = NULL;
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- merge_member - add elemental constraint stored in the buffer.
+--
+-- This routine reads elemental constraint from the buffer and adds it
+-- to the model constraint as take_member_con does, unless the member
+-- already exists (e.g. it has been displayed by a previous statement);
+-- in the latter case the member is skipped. */
+
+static TUPLE *get_tuple(MPL *mpl, GENBUF *b, int dim)
+{     /* read n-tuple from the buffer */
+      TUPLE *tuple = create_tuple(mpl);
+      SYMBOL *sym;
+      char str[MAX_LENGTH+1];
+      int len;
+      for (; dim > 0; dim--)
+      {  len = b->iv[b->ri++];
+         if (len == 0)
+            sym = create_symbol_num(mpl, b->dv[b->rd++]);
+         else
+         {  len--;
+            xassert(len <= MAX_LENGTH);
+            memcpy(str, b->cv + b->rc, len);
+            str[len] = '\0';
+            b->rc += len;
+            sym = create_symbol_str(mpl, create_string(mpl, str));
+         }
+         tuple = expand_tuple(mpl, tuple, sym);
+      }
+      return tuple;
+}
+
+static void merge_member(MPL *mpl, CONSTRAINT *con, GENBUF *b)
+{     GENPAR *P = mpl->par;
+      VARIABLE *var;
+      MEMBER *memb;
+      ELEMCON *refer;
+      FORMULA *form, *tail, *term;
+      TUPLE *tuple, *temp;
+      int ri = b->ri, rd = b->rd, rc = b->rc, nref, nterm, k;
+      b->ri += 4;
+      tuple = get_tuple(mpl, b, con->dim);
+      if (find_member(mpl, con->array, tuple) != NULL)
+      {  /* the member has been evaluated before */
+         delete_tuple(mpl, tuple);
+         b->ri = ri + b->iv[ri+1];
+         b->rd = rd + b->iv[ri+2];
+         b->rc = rc + b->iv[ri+3];
+         return;
+      }
+      /* find or create referenced elemental variables */
+      nref = b->iv[b->ri++];
+      if (P->ev_max < nref)
+      {  if (P->ev != NULL) xfree(P->ev);
+         P->ev_max = nref + nref;
+         P->ev = xcalloc(P->ev_max, sizeof(ELEMVAR *));
+      }
+      for (k = 0; k < nref; k++)
+      {  var = P->var[b->iv[b->ri++]];
+         temp = get_tuple(mpl, b, var->dim);
+         memb = find_member(mpl, var->array, temp);
+         if (memb != NULL)
+            P->ev[k] = memb->value.var;
+         else
+            P->ev[k] = eval_member_var(mpl, var, temp);
+         delete_tuple(mpl, temp);
+      }
+      /* create new elemental constraint */
+      memb = add_member(mpl, con->array, tuple);
+      refer = (memb->value.con =
+         dmp_get_atom(mpl->elemcons, sizeof(ELEMCON)));
+      refer->i = 0;
+      refer->con = con;
+      refer->memb = memb;
+      refer->lbnd = b->dv[b->rd++];
+      refer->ubnd = b->dv[b->rd++];
+      form = tail = NULL;
+      nterm = b->iv[b->ri++];
+      for (k = 0; k < nterm; k++)
+      {  term = dmp_get_atom(mpl->formulae, sizeof(FORMULA));
+         xassert(b->iv[b->ri] < nref);
+         term->var = P->ev[b->iv[b->ri++]];
+         term->coef = b->dv[b->rd++];
+         term->next = NULL;
+         if (form == NULL)
+            form = term;
+         else
+            tail->next = term;
+         tail = term;
+      }
+      refer->form = form;
+      refer->stat = 0;
+      refer->prim = refer->dual = 0.0;
+      xassert(b->ri == ri + b->iv[ri+1]);
+      xassert(b->rd == rd + b->iv[ri+2]);
+      xassert(b->rc == rc + b->iv[ri+3]);
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- par_whole_con - merge model constraint evaluated by worker threads.
+--
+-- This routine is called by execute_statement instead of the routine
+-- eval_whole_con. It waits for all the workers to finish the statement
+-- and adds the elemental constraints they have evaluated in the order
+-- of domain members. If some worker has stopped, the routine adds the
+-- members preceding the stop point, stops the workers, and evaluates
+-- the rest of the constraint serially. */
+
+void par_whole_con(MPL *mpl, CONSTRAINT *con)
+{     GENPAR *P = mpl->par;
+      GENBUF *buf, *b;
+      int s = P->s++, stop = INT_MAX, k, kk;
+      xassert(s < P->nc && P->con[s] == con);
+      /* wait for all the workers to finish the statement */
+      pthread_mutex_lock(&P->lock);
+      for (;;)
+      {  for (k = 0; k < P->nthreads; k++)
+            if (P->wrk[k].done <= s) break;
+         if (k == P->nthreads) break;
+         pthread_cond_wait(&P->cond, &P->lock);
+      }
+      pthread_mutex_unlock(&P->lock);
+      buf = &P->buf[s * P->max];
+      for (k = 0; k < P->nthreads; k++)
+      {  if (buf[k].stop >= 0 && stop > buf[k].stop)
+            stop = buf[k].stop;
+      }
+      /* merge members in the order of their ordinal numbers */
+      for (;;)
+      {  kk = -1;
+         for (k = 0, b = buf; k < P->nthreads; k++, b++)
+         {  if (b->ri < b->ni && (kk < 0 ||
+                b->iv[b->ri] < buf[kk].iv[buf[kk].ri]))
+               kk = k;
+         }
+         if (kk < 0 || buf[kk].iv[buf[kk].ri] >= stop) break;
+         merge_member(mpl, con, &buf[kk]);
+         mpl->par_cnt++;
+      }
+      for (k = 0, b = buf; k < P->nthreads; k++, b++)
+      {  free(b->iv), free(b->dv), free(b->cv);
+         b->iv = NULL, b->dv = NULL, b->cv = NULL;
+      }
+      if (stop != INT_MAX)
+      {  /* some worker has stopped; members, which already exist, are
+            skipped by eval_whole_con */
+         par_finish(mpl);
+         eval_whole_con(mpl, con);
+      }
+      return;
+}
+
+/* eof */
@@ -0,0 +1,397 @@
+/* glpmpl08.c (updating generated model) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "glpmpl.h"
+
+/***********************************************************************
+*  Parameters changed after generating the model are marked with the
+*  flag upd = 1 (see the routine direct_parameter_update). The routine
+*  update_model walks through the model statements in their original
+*  order; since any statement may refer only to model objects declared
+*  before, one pass is enough to find all objects which depend on the
+*  changed data directly or through other parameters:
+*
+*  a parameter, whose pseudo-code refers to a marked parameter, is
+*  marked with upd = 2 and its members, which have been computed rather
+*  than provided with data, are deleted to be computed again on the
+*  next reference; its data (if any) are checked again;
+*
+*  a variable, whose bounds refer to a marked parameter, is marked with
+*  upd = 1 and the bounds of its elemental variables are evaluated
+*  again;
+*
+*  a constraint or objective, whose pseudo-code refers to a marked
+*  parameter or to bounds of a marked variable, is evaluated again for
+*  every member of its domain; the new linear forms replace the linear
+*  forms of the existing elemental constraints, so row numbers and the
+*  list of rows do not change.
+*
+*  Values cached in pseudo-code of these objects are deleted before the
+*  objects are evaluated again. Changes which would alter the problem
+*  structure, i.e. model sets, domains of variables and constraints,
+*  and references to elemental variables which are not columns of the
+*  problem, depending on the changed data are reported as errors.
+*
+*  Rows and columns, whose linear forms or bounds have actually been
+*  changed, are marked in the arrays upd_row and upd_col; the routine
+*  glp_mpl_update_prob applies them to the problem object. */
+
+/*----------------------------------------------------------------------
+-- code_depends - check if pseudo-code refers to changed data.
+--
+-- This routine returns non-zero if specified pseudo-code refers to a
+-- marked parameter or to bounds of a marked variable.
+--
+-- NOTE: Operation codes of each kind (unary, binary, etc.) follow each
+--       other in glpmpl.h, so they are recognized by their ranges. */
+
+static int code_depends(MPL *mpl, CODE *code);
+static int domain_depends(MPL *mpl, DOMAIN *domain);
+
+static int list_depends(MPL *mpl, ARG_LIST *list)
+{     ARG_LIST *e;
+      for (e = list; e != NULL; e = e->next)
+         if (code_depends(mpl, e->x)) return 1;
+      return 0;
+}
+
+static int code_depends(MPL *mpl, CODE *code)
+{     int op;
+      if (code == NULL) return 0;
+      op = code->op;
+      switch (op)
+      {  case O_NUMBER:
+         case O_STRING:
+         case O_INDEX:
+            return 0;
+         case O_MEMNUM:
+         case O_MEMSYM:
+            if (code->arg.par.par->upd) return 1;
+            return list_depends(mpl, code->arg.par.list);
+         case O_MEMSET:
+            return list_depends(mpl, code->arg.set.list);
+         case O_MEMVAR:
+            if (code->arg.var.var->upd &&
+               (code->arg.var.suff == DOT_LB ||
+                code->arg.var.suff == DOT_UB)) return 1;
+            return list_depends(mpl, code->arg.var.list);
+         case O_MEMCON:
+            return list_depends(mpl, code->arg.con.list);
+         case O_TUPLE:
+         case O_MAKE:
+         case O_MIN:
+         case O_MAX:
+            return list_depends(mpl, code->arg.list);
+         case O_SLICE:
+            xassert(code != code);
+         default:
+            break;
+      }
+      if (O_IRAND224 <= op && op <= O_GMTIME)
+         return 0;
+      if (O_CVTNUM <= op && op <= O_LENGTH)
+         return code_depends(mpl, code->arg.arg.x);
+      if (O_ADD <= op && op <= O_TIME2STR)
+         return code_depends(mpl, code->arg.arg.x) ||
+                code_depends(mpl, code->arg.arg.y);
+      if (O_DOTS <= op && op <= O_SUBSTR3)
+         return code_depends(mpl, code->arg.arg.x) ||
+                code_depends(mpl, code->arg.arg.y) ||
+                code_depends(mpl, code->arg.arg.z);
+      if (O_SUM <= op && op <= O_BUILD)
+         return domain_depends(mpl, code->arg.loop.domain) ||
+                code_depends(mpl, code->arg.loop.x);
+      xassert(op != op);
+      return 0;
+}
+
+static int domain_depends(MPL *mpl, DOMAIN *domain)
+{     DOMAIN_BLOCK *block;
+      DOMAIN_SLOT *slot;
+      if (domain == NULL) return 0;
+      for (block = domain->list; block != NULL; block = block->next)
+      {  for (slot = block->list; slot != NULL; slot = slot->next)
+            if (code_depends(mpl, slot->code)) return 1;
+         if (code_depends(mpl, block->code)) return 1;
+      }
+      return code_depends(mpl, domain->code);
+}
+
+/*----------------------------------------------------------------------
+-- update_set - check model set.
+--
+-- Elemental sets are not evaluated again, since members of sets are
+-- used to enumerate rows and columns of the problem. */
+
+static void update_set(MPL *mpl, SET *set)
+{     WITHIN *in;
+      int dep;
+      dep = domain_depends(mpl, set->domain) ||
+         code_depends(mpl, set->assign) ||
+         code_depends(mpl, set->option);
+      for (in = set->within; in != NULL; in = in->next)
+         dep = dep || code_depends(mpl, in->code);
+      if (dep)
+         error(mpl, "%s depends on changed data; model must be generat"
+            "ed again", set->name);
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- update_parameter - update model parameter.
+--
+-- If the parameter depends on changed data, its computed members are
+-- deleted, and its data are checked again. Then the data assigned to
+-- the parameter (if any) are checked immediately rather than on the
+-- next reference, so errors are reported for the changed parameter. */
+
+static void update_parameter(MPL *mpl, PARAMETER *par)
+{     CONDITION *cond;
+      WITHIN *in;
+      MEMBER *memb;
+      int dep;
+      dep = domain_depends(mpl, par->domain) ||
+         code_depends(mpl, par->assign) ||
+         code_depends(mpl, par->option);
+      for (cond = par->cond; cond != NULL; cond = cond->next)
+         dep = dep || code_depends(mpl, cond->code);
+      for (in = par->in; in != NULL; in = in->next)
+         dep = dep || code_depends(mpl, in->code);
+      if (dep)
+      {  /* delete values cached in pseudo-code */
+         clean_domain(mpl, par->domain);
+         for (cond = par->cond; cond != NULL; cond = cond->next)
+            clean_code(mpl, cond->code);
+         for (in = par->in; in != NULL; in = in->next)
+            clean_code(mpl, in->code);
+         clean_code(mpl, par->assign);
+         clean_code(mpl, par->option);
+         if (par->assign != NULL || par->data == 0)
+         {  /* all members have been computed; delete them */
+            for (memb = par->array->head; memb != NULL;
+               memb = memb->next)
+               delete_value(mpl, par->array->type, &memb->value);
+            delete_array(mpl, par->array);
+            par->array = create_array(mpl,
+               par->type == A_SYMBOLIC ? A_SYMBOLIC : A_NUMERIC,
+               par->dim);
+         }
+         else if (code_depends(mpl, par->option))
+         {  /* members computed with the default value cannot be told
+               from members provided with data */
+            error(mpl, "default value of %s depends on changed data; m"
+               "odel must be generated again", par->name);
+         }
+         else
+         {  /* data are checked again */
+            par->data = 1;
+         }
+         if (par->upd == 0) par->upd = 2;
+      }
+      /* check data assigned to the parameter */
+      if (par->data == 1 && par->array->head != NULL)
+      {  memb = par->array->head;
+         if (par->type == A_SYMBOLIC)
+            delete_symbol(mpl, eval_member_sym(mpl, par, memb->tuple));
+         else
+            eval_member_num(mpl, par, memb->tuple);
+      }
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- update_variable - update model variable.
+--
+-- If bounds of the variable depend on changed data, this routine
+-- evaluates the bounds of all its elemental variables again. */
+
+static void update_bnds_func(MPL *mpl, void *info)
+{     /* this is auxiliary routine to work within domain scope */
+      ELEMVAR *refer = info;
+      VARIABLE *var = refer->var;
+      double lbnd, ubnd;
+      /* compute bounds as the routine take_member_var does */
+      if (var->lbnd == NULL)
+         lbnd = 0.0;
+      else
+         lbnd = eval_numeric(mpl, var->lbnd);
+      if (var->ubnd == NULL)
+         ubnd = 0.0;
+      else if (var->ubnd == var->lbnd)
+         ubnd = lbnd;
+      else
+         ubnd = eval_numeric(mpl, var->ubnd);
+      if (refer->j != 0 &&
+          !(refer->lbnd == lbnd && refer->ubnd == ubnd))
+         mpl->upd_col[refer->j] = 1;
+      refer->lbnd = lbnd;
+      refer->ubnd = ubnd;
+      return;
+}
+
+static void update_variable(MPL *mpl, VARIABLE *var)
+{     MEMBER *memb;
+      if (domain_depends(mpl, var->domain))
+         error(mpl, "domain of %s depends on changed data; model must b"
+            "e generated again", var->name);
+      if (!(code_depends(mpl, var->lbnd) ||
+            code_depends(mpl, var->ubnd)))
+         goto done;
+      var->upd = 1;
+      /* delete values cached in pseudo-code */
+      clean_code(mpl, var->lbnd);
+      if (var->ubnd != var->lbnd) clean_code(mpl, var->ubnd);
+      /* evaluate bounds of all elemental variables */
+      for (memb = var->array->head; memb != NULL; memb = memb->next)
+      {  if (eval_within_domain(mpl, var->domain, memb->tuple,
+            memb->value.var, update_bnds_func))
+            out_of_domain(mpl, var->name, memb->tuple);
+      }
+done: return;
+}
+
+/*----------------------------------------------------------------------
+-- update_constraint - update model constraint or objective.
+--
+-- If the constraint depends on changed data, this routine evaluates
+-- linear forms and bounds of all its elemental constraints again. */
+
+static int same_form(FORMULA *x, FORMULA *y)
+{     /* linear forms are compared term by term, so forms with the same
+         terms in different order are considered as different */
+      for (; x != NULL && y != NULL; x = x->next, y = y->next)
+      {  if (!(x->var == y->var && x->coef == y->coef))
+            return 0;
+      }
+      return x == NULL && y == NULL;
+}
+
+static void update_form_func(MPL *mpl, void *info)
+{     /* this is auxiliary routine to work within domain scope */
+      ELEMCON *refer = info;
+      FORMULA *form = refer->form, *t;
+      double lbnd = refer->lbnd, ubnd = refer->ubnd;
+      char name[255+1];
+      eval_form_con(mpl, refer->con, refer);
+      for (t = refer->form; t != NULL; t = t->next)
+      {  xassert(t->var != NULL);
+         if (t->var->j == 0)
+         {  strcpy(name, format_tuple(mpl, '[', refer->memb->tuple));
+            error(mpl, "%s%s refers to %s%s, which is not a column of t"
+               "he problem; model must be generated again",
+               refer->con->name, name, t->var->var->name,
+               format_tuple(mpl, '[', t->var->memb->tuple));
+         }
+      }
+      if (refer->i != 0 && !(same_form(form, refer->form) &&
+          refer->lbnd == lbnd && refer->ubnd == ubnd))
+         mpl->upd_row[refer->i] = 1;
+      delete_formula(mpl, form);
+      return;
+}
+
+static void update_constraint(MPL *mpl, CONSTRAINT *con)
+{     MEMBER *memb;
+      if (domain_depends(mpl, con->domain))
+         error(mpl, "domain of %s depends on changed data; model must b"
+            "e generated again", con->name);
+      if (!(code_depends(mpl, con->code) ||
+            code_depends(mpl, con->lbnd) ||
+            code_depends(mpl, con->ubnd)))
+         goto done;
+      /* delete values cached in pseudo-code */
+      clean_code(mpl, con->code);
+      clean_code(mpl, con->lbnd);
+      if (con->ubnd != con->lbnd) clean_code(mpl, con->ubnd);
+      /* evaluate all elemental constraints */
+      for (memb = con->array->head; memb != NULL; memb = memb->next)
+      {  if (eval_within_domain(mpl, con->domain, memb->tuple,
+            memb->value.con, update_form_func))
+            out_of_domain(mpl, con->name, memb->tuple);
+      }
+done: return;
+}
+
+/*----------------------------------------------------------------------
+-- update_model - regenerate model objects depending on changed data.
+--
+-- This routine evaluates again all model objects, which depend on the
+-- parameters changed since the last update, and marks changed rows and
+-- columns of the problem instance. */
+
+void update_model(MPL *mpl)
+{     STATEMENT *stmt, *save = mpl->stmt;
+      xassert(mpl->phase == 3 && !mpl->flag_p);
+      if (mpl->upd_row == NULL)
+      {  mpl->upd_row = xcalloc(1+mpl->m, sizeof(char));
+         memset(mpl->upd_row, 0, 1+mpl->m);
+         mpl->upd_col = xcalloc(1+mpl->n, sizeof(char));
+         memset(mpl->upd_col, 0, 1+mpl->n);
+      }
+      for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
+      {  /* errors are reported for the statement being updated */
+         mpl->stmt = stmt;
+         switch (stmt->type)
+         {  case A_SET:
+               update_set(mpl, stmt->u.set);
+               break;
+            case A_PARAMETER:
+               update_parameter(mpl, stmt->u.par);
+               break;
+            case A_VARIABLE:
+               update_variable(mpl, stmt->u.var);
+               break;
+            case A_CONSTRAINT:
+               update_constraint(mpl, stmt->u.con);
+               break;
+            default:
+               /* other statements are not executed again */
+               break;
+         }
+      }
+      mpl->stmt = save;
+      /* the update has been finished; remove the marks */
+      for (stmt = mpl->model; stmt != NULL; stmt = stmt->next)
+      {  if (stmt->type == A_PARAMETER)
+            stmt->u.par->upd = 0;
+         else if (stmt->type == A_VARIABLE)
+            stmt->u.var->upd = 0;
+      }
+      return;
+}
+
+/*----------------------------------------------------------------------
+-- clean_update - forget changes not applied to problem object.
+--
+-- This routine deletes the marks of changed rows and columns. */
+
+void clean_update(MPL *mpl)
+{     if (mpl->upd_row != NULL)
+         xfree(mpl->upd_row), mpl->upd_row = NULL;
+      if (mpl->upd_col != NULL)
+         xfree(mpl->upd_col), mpl->upd_col = NULL;
+      return;
+}
+
+/* eof */
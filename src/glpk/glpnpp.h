@@ -33,6 +33,7 @@ typedef struct NPPCOL NPPCOL;
 typedef struct NPPAIJ NPPAIJ;
 typedef struct NPPTSE NPPTSE;
 typedef struct NPPLFE NPPLFE;
+typedef struct NPPOBJ NPPOBJ;
 
 struct NPP
 {     /* LP/MIP preprocessor workspace */
@@ -84,6 +85,15 @@ struct NPP
       /* memory pool to store transformation entries */
       NPPTSE *top;
       /* pointer to most recent transformation entry */
+      int o_rec;
+      /* if this flag is set, transformations of the objective function
+         are recorded, so the objective of the original problem can be
+         changed after preprocessing (see npp_obj_replay) */
+      NPPOBJ *o_head, *o_tail;
+      /* list of recorded transformations of the objective function in
+         the order they were made */
+      int threads;
+      /* number of threads used by npp_global_pass (1 = serial) */
 #if 0 /* 16/XII-2009 */
       int count[1+25];
       /* transformation statistics */
@@ -248,6 +258,28 @@ struct NPPTSE
       /* pointer to another entry created *before* this entry */
 };
 
+struct NPPOBJ
+{     /* objective transformation entry */
+      int type;
+      /* transformation type: */
+#define NPP_OBJ_SET  1  /* c[dst] := alpha * c[src] */
+#define NPP_OBJ_ADD  2  /* c[dst] := c[dst] + alpha * c[src] */
+#define NPP_OBJ_CHK  3  /* lo <= alpha * c[src] + beta * c[dst] <= hi
+                           must hold */
+#define NPP_OBJ_PUT  4  /* *ptr := c[src] */
+      int dst, src;
+      /* column reference numbers; 0 means the constant term c0 */
+      double alpha, beta;
+      /* multipliers (beta is used by NPP_OBJ_CHK only) */
+      double lo, hi;
+      /* range of alpha * c[src] (NPP_OBJ_CHK only) */
+      double *ptr;
+      /* objective coefficient kept in a transformation stack entry
+         (NPP_OBJ_PUT only) */
+      NPPOBJ *next;
+      /* pointer to next entry */
+};
+
 struct NPPLFE
 {     /* linear form element */
       int ref;
@@ -335,6 +367,28 @@ void npp_del_col(NPP *npp, NPPCOL *col);
 void npp_del_aij(NPP *npp, NPPAIJ *aij);
 /* remove element from the constraint matrix */
 
+#define npp_obj_lin _glp_npp_obj_lin
+void npp_obj_lin(NPP *npp, int type, int dst, int src, double alpha);
+/* record linear transformation of the objective function */
+
+#define npp_obj_chk _glp_npp_obj_chk
+void npp_obj_chk(NPP *npp, int src, double alpha, double lo,
+      double hi);
+/* record condition on objective coefficient */
+
+#define npp_obj_chk2 _glp_npp_obj_chk2
+void npp_obj_chk2(NPP *npp, int src, double alpha, int src2,
+      double beta, double lo, double hi);
+/* record condition on two objective coefficients */
+
+#define npp_obj_put _glp_npp_obj_put
+void npp_obj_put(NPP *npp, double *ptr, int src);
+/* record objective coefficient kept in transformation entry */
+
+#define npp_obj_replay _glp_npp_obj_replay
+int npp_obj_replay(NPP *npp, glp_prob *orig, double c[]);
+/* transform objective of the original problem */
+
 #define npp_load_prob _glp_npp_load_prob
 void npp_load_prob(NPP *npp, glp_prob *orig, int names, int sol,
       int scaling);
@@ -487,6 +541,14 @@ int npp_is_partitioning(NPP *npp, NPPROW *row);
 int npp_reduce_ineq_coef(NPP *npp, NPPROW *row);
 /* reduce inequality constraint coefficients */
 
+#define npp_dom_col _glp_npp_dom_col
+int npp_dom_col(NPP *npp, NPPCOL *q);
+/* process dominated column */
+
+#define npp_global_pass _glp_npp_global_pass
+int npp_global_pass(NPP *npp, int *count);
+/* remove parallel rows and columns and probe binary columns */
+
 #define npp_clean_prob _glp_npp_clean_prob
 void npp_clean_prob(NPP *npp);
 /* perform initial LP/MIP processing */
@@ -40,6 +40,9 @@ NPP *npp_create_wksp(void)
       npp->c_head = npp->c_tail = NULL;
       npp->stack = dmp_create_pool();
       npp->top = NULL;
+      npp->o_rec = 0;
+      npp->o_head = npp->o_tail = NULL;
+      npp->threads = 1;
 #if 0 /* 16/XII-2009 */
       memset(&npp->count, 0, sizeof(npp->count));
 #endif
@@ -258,6 +261,126 @@ void *npp_push_tse(NPP *npp, int (*func)(NPP *npp, void *info),
       return tse->info;
 }
 
+/***********************************************************************
+*  Transformations of the objective function are linear in its original
+*  coefficients, except that some of them are applicable only if some
+*  coefficient has a particular sign. If the flag o_rec is set, every
+*  such transformation is recorded in addition to changing the column
+*  coefficients, so npp_obj_replay can apply the same transformations
+*  to another objective of the original problem. Since objective
+*  coefficients kept in transformation stack entries are used on
+*  recovering dual values, they are recorded, too. */
+
+static NPPOBJ *obj_add(NPP *npp, int type)
+{     /* add new entry to the list of objective transformations */
+      NPPOBJ *obj;
+      obj = dmp_get_atom(npp->stack, sizeof(NPPOBJ));
+      memset(obj, 0, sizeof(NPPOBJ));
+      obj->type = type;
+      obj->next = NULL;
+      if (npp->o_tail == NULL)
+         npp->o_head = obj;
+      else
+         npp->o_tail->next = obj;
+      npp->o_tail = obj;
+      return obj;
+}
+
+void npp_obj_lin(NPP *npp, int type, int dst, int src, double alpha)
+{     /* record linear transformation of the objective function */
+      NPPOBJ *obj;
+      xassert(type == NPP_OBJ_SET || type == NPP_OBJ_ADD);
+      if (npp->o_rec)
+      {  obj = obj_add(npp, type);
+         obj->dst = dst, obj->src = src, obj->alpha = alpha;
+      }
+      return;
+}
+
+void npp_obj_chk(NPP *npp, int src, double alpha, double lo,
+      double hi)
+{     /* record condition on objective coefficient */
+      NPPOBJ *obj;
+      if (npp->o_rec)
+      {  obj = obj_add(npp, NPP_OBJ_CHK);
+         obj->src = src, obj->alpha = alpha;
+         obj->lo = lo, obj->hi = hi;
+      }
+      return;
+}
+
+void npp_obj_chk2(NPP *npp, int src, double alpha, int src2,
+      double beta, double lo, double hi)
+{     /* record condition on two objective coefficients */
+      NPPOBJ *obj;
+      if (npp->o_rec)
+      {  obj = obj_add(npp, NPP_OBJ_CHK);
+         obj->src = src, obj->alpha = alpha;
+         obj->dst = src2, obj->beta = beta;
+         obj->lo = lo, obj->hi = hi;
+      }
+      return;
+}
+
+void npp_obj_put(NPP *npp, double *ptr, int src)
+{     /* record objective coefficient kept in transformation entry */
+      NPPOBJ *obj;
+      if (npp->o_rec)
+      {  obj = obj_add(npp, NPP_OBJ_PUT);
+         obj->src = src, obj->ptr = ptr;
+      }
+      return;
+}
+
+int npp_obj_replay(NPP *npp, glp_prob *orig, double c[])
+{     /* transform objective of the original problem; on exit c[0] is
+         the constant term and c[1], ..., c[ncols] are coefficients of
+         all columns of the transformed (minimization) problem; the
+         routine returns non-zero if some transformation is not valid
+         for the objective given, in which case coefficients kept in
+         transformation entries are not changed */
+      NPPOBJ *obj;
+      int j, pass;
+      double dir, t;
+      xassert(npp->o_rec);
+      xassert(npp->orig_dir == orig->dir);
+      xassert(npp->orig_n == orig->n);
+      xassert(!npp->scaling);
+      dir = (npp->orig_dir == GLP_MIN ? +1.0 : -1.0);
+      /* the first pass checks conditions, the second one stores new
+         coefficients in transformation entries */
+      for (pass = 1; pass <= 2; pass++)
+      {  c[0] = dir * orig->c0;
+         for (j = 1; j <= npp->orig_n; j++)
+            c[j] = dir * orig->col[j]->coef;
+         for (j = npp->orig_n+1; j <= npp->ncols; j++)
+            c[j] = 0.0;
+         for (obj = npp->o_head; obj != NULL; obj = obj->next)
+         {  switch (obj->type)
+            {  case NPP_OBJ_SET:
+                  c[obj->dst] = obj->alpha * c[obj->src];
+                  break;
+               case NPP_OBJ_ADD:
+                  c[obj->dst] += obj->alpha * c[obj->src];
+                  break;
+               case NPP_OBJ_CHK:
+                  t = obj->alpha * c[obj->src] +
+                      obj->beta * c[obj->dst];
+                  if (!(obj->lo <= t && t <= obj->hi))
+                     return 1;
+                  break;
+               case NPP_OBJ_PUT:
+                  if (pass == 2)
+                     *obj->ptr = c[obj->src];
+                  break;
+               default:
+                  xassert(obj != obj);
+            }
+         }
+      }
+      return 0;
+}
+
 #if 1 /* 23/XII-2009 */
 void npp_erase_row(NPP *npp, NPPROW *row)
 {     /* erase row content to make it empty */
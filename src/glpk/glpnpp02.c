@@ -501,6 +501,7 @@ void npp_free_col(NPP *npp, NPPCOL *q)
       s->lb = 0.0, s->ub = +DBL_MAX;
       /* duplicate objective coefficient */
       s->coef = -q->coef;
+      npp_obj_lin(npp, NPP_OBJ_SET, s->j, q->j, -1.0);
       /* duplicate column of the constraint matrix */
       for (aij = q->ptr; aij != NULL; aij = aij->c_next)
          npp_add_aij(npp, aij->row, s, -aij->val);
@@ -660,6 +661,7 @@ void npp_lbnd_col(NPP *npp, NPPCOL *q)
       info->bnd = q->lb;
       /* substitute x[q] into objective row */
       npp->c0 += q->coef * q->lb;
+      npp_obj_lin(npp, NPP_OBJ_ADD, 0, q->j, q->lb);
       /* substitute x[q] into constraint rows */
       for (aij = q->ptr; aij != NULL; aij = aij->c_next)
       {  i = aij->row;
@@ -828,6 +830,8 @@ void npp_ubnd_col(NPP *npp, NPPCOL *q)
       /* substitute x[q] into objective row */
       npp->c0 += q->coef * q->ub;
       q->coef = -q->coef;
+      npp_obj_lin(npp, NPP_OBJ_ADD, 0, q->j, q->ub);
+      npp_obj_lin(npp, NPP_OBJ_SET, q->j, q->j, -1.0);
       /* substitute x[q] into constraint rows */
       for (aij = q->ptr; aij != NULL; aij = aij->c_next)
       {  i = aij->row;
@@ -1118,6 +1122,7 @@ void npp_fixed_col(NPP *npp, NPPCOL *q)
       info->s = q->lb;
       /* substitute x[q] = s[q] into objective row */
       npp->c0 += q->coef * q->lb;
+      npp_obj_lin(npp, NPP_OBJ_ADD, 0, q->j, q->lb);
       /* substitute x[q] = s[q] into constraint rows */
       for (aij = q->ptr; aij != NULL; aij = aij->c_next)
       {  i = aij->row;
@@ -1383,6 +1388,7 @@ int npp_make_fixed(NPP *npp, NPPCOL *q)
          rcv_make_fixed, sizeof(struct make_fixed));
       info->q = q->j;
       info->c = q->coef;
+      npp_obj_put(npp, &info->c, q->j);
       info->ptr = NULL;
       /* save column coefficients a[i,q] (needed for basic solution
          only) */
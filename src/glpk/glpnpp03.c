@@ -201,22 +201,32 @@ int npp_empty_col(NPP *npp, NPPCOL *q)
       {  /* free column */
          info->stat = GLP_NF;
          q->lb = q->ub = 0.0;
+         npp_obj_chk(npp, q->j, 1.0, -eps, +eps);
       }
       else if (q->ub == +DBL_MAX)
-lo:   {  /* column with lower bound */
-         info->stat = GLP_NL;
+      {  /* column with lower bound */
+         npp_obj_chk(npp, q->j, 1.0, -eps, +DBL_MAX);
+lo:      info->stat = GLP_NL;
          q->ub = q->lb;
       }
       else if (q->lb == -DBL_MAX)
-up:   {  /* column with upper bound */
-         info->stat = GLP_NU;
+      {  /* column with upper bound */
+         npp_obj_chk(npp, q->j, 1.0, -DBL_MAX, +eps);
+up:      info->stat = GLP_NU;
          q->lb = q->ub;
       }
       else if (q->lb != q->ub)
-      {  /* double-bounded column */
-         if (q->coef >= +DBL_EPSILON) goto lo;
-         if (q->coef <= -DBL_EPSILON) goto up;
-         if (fabs(q->lb) <= fabs(q->ub)) goto lo; else goto up;
+      {  /* double-bounded column; the bound chosen is optimal only if
+            the objective coefficient has appropriate sign */
+         if (q->coef >= +DBL_EPSILON ||
+            (q->coef > -DBL_EPSILON && fabs(q->lb) <= fabs(q->ub)))
+         {  npp_obj_chk(npp, q->j, 1.0, -DBL_EPSILON, +DBL_MAX);
+            goto lo;
+         }
+         else
+         {  npp_obj_chk(npp, q->j, 1.0, -DBL_MAX, +DBL_EPSILON);
+            goto up;
+         }
       }
       else
       {  /* fixed column */
@@ -446,6 +456,7 @@ int npp_eq_singlet(NPP *npp, NPPROW *p)
       info->q = q->j;
       info->apq = aij->val;
       info->c = q->coef;
+      npp_obj_put(npp, &info->c, q->j);
       info->ptr = NULL;
       /* save column coefficients a[i,q], i != p (not needed for MIP
          solution) */
@@ -941,6 +952,7 @@ int npp_ineq_singlet(NPP *npp, NPPROW *p)
       info->q = q->j;
       info->apq = apq->val;
       info->c = q->coef;
+      npp_obj_put(npp, &info->c, q->j);
       info->lb = p->lb;
       info->ub = p->ub;
       info->lb_changed = (char)lb_changed;
@@ -1259,6 +1271,7 @@ void npp_implied_slack(NPP *npp, NPPCOL *q)
       info->apq = aij->val;
       info->b = p->lb;
       info->c = q->coef;
+      npp_obj_put(npp, &info->c, q->j);
       info->ptr = NULL;
       /* save row coefficients a[p,j], j != q, and substitute x[q]
          into the objective row */
@@ -1270,8 +1283,11 @@ void npp_implied_slack(NPP *npp, NPPCOL *q)
          lfe->next = info->ptr;
          info->ptr = lfe;
          aij->col->coef -= info->c * (aij->val / info->apq);
+         npp_obj_lin(npp, NPP_OBJ_ADD, aij->col->j, q->j,
+            - aij->val / info->apq);
       }
       npp->c0 += info->c * (info->b / info->apq);
+      npp_obj_lin(npp, NPP_OBJ_ADD, 0, q->j, info->b / info->apq);
       /* compute new row bounds */
       if (info->apq > 0.0)
       {  p->lb = (q->ub == +DBL_MAX ?
@@ -1492,6 +1508,7 @@ int npp_implied_free(NPP *npp, NPPCOL *q)
       struct implied_free *info;
       NPPROW *p;
       NPPAIJ *apq, *aij;
+      int lb_inf, ub_inf;
       double alfa, beta, l, u, pi, eps;
       /* the column must be non-fixed singleton */
       xassert(q->lb < q->ub);
@@ -1570,6 +1587,7 @@ int npp_implied_free(NPP *npp, NPPCOL *q)
          rcv_implied_free, sizeof(struct implied_free));
       info->p = p->i;
       info->stat = -1;
+      lb_inf = (p->lb == -DBL_MAX), ub_inf = (p->ub == +DBL_MAX);
       /* compute row multiplier pi[p] */
       pi = q->coef / apq->val;
       /* check dual feasibility for row p */
@@ -1611,6 +1629,15 @@ nu:      {  info->stat = GLP_NU;
          }
          if (fabs(p->lb) <= fabs(p->ub)) goto nl; else goto nu;
       }
+      /* the bound chosen is active only if the row multiplier has
+         appropriate sign (or is close to zero, if the other bound does
+         not exist) */
+      if (info->stat == GLP_NL)
+         npp_obj_chk(npp, q->j, 1.0 / apq->val,
+            ub_inf ? -1e-5 : -DBL_EPSILON, +DBL_MAX);
+      else
+         npp_obj_chk(npp, q->j, 1.0 / apq->val,
+            -DBL_MAX, lb_inf ? +1e-5 : +DBL_EPSILON);
       return 0;
 }
 
@@ -1776,6 +1803,22 @@ NPPCOL *npp_eq_doublet(NPP *npp, NPPROW *p)
       /* choose column to be eliminated */
       {  NPPAIJ *a1, *a2;
          a1 = p->ptr, a2 = a1->r_next;
+#if 1 /* 19/X-2026 */
+         /* pivot a[p,q] is chosen to be largest in magnitude, so that
+            |a[p,r] / a[p,q]| <= 1.1 and coefficients of other rows do
+            not grow much on elimination; if both coefficients are
+            close to each other, the shorter column is chosen to
+            minimize fill-in */
+         if (fabs(a1->val) > 1.1 * fabs(a2->val))
+            apq = a1, apr = a2;
+         else if (fabs(a2->val) > 1.1 * fabs(a1->val))
+            apq = a2, apr = a1;
+         else if (npp_col_nnz(npp, a1->col) <= npp_col_nnz(npp,
+            a2->col))
+            apq = a1, apr = a2;
+         else
+            apq = a2, apr = a1;
+#else
          if (fabs(a2->val) < 0.001 * fabs(a1->val))
          {  /* only first column can be eliminated, because second one
                has too small constraint coefficient */
@@ -1798,6 +1841,7 @@ NPPCOL *npp_eq_doublet(NPP *npp, NPPROW *p)
                apq = a2, apr = a1;
             }
          }
+#endif
       }
       /* now columns q and r have been chosen */
       q = apq->col, r = apr->col;
@@ -2067,6 +2111,8 @@ struct forcing_col
       /* constraint coefficient a[p,j] */
       double c;
       /* objective coefficient c[j] */
+      double d;
+      /* reduced cost d[j] (computed on recovering) */
       NPPLFE *ptr;
       /* list of non-zero coefficients a[i,j], i != p */
       struct forcing_col *next;
@@ -2139,6 +2185,7 @@ int npp_forcing_row(NPP *npp, NPPROW *p, int at)
             col->stat = -1; /* will be set below */
             col->a = apj->val;
             col->c = j->coef;
+            npp_obj_put(npp, &col->c, j->j);
             col->ptr = NULL;
             col->next = info->ptr;
             info->ptr = col;
@@ -2199,12 +2246,13 @@ static int rcv_forcing_row(NPP *npp, void *_info)
          }
       }
       /* compute reduced costs d[j] for all columns with formula (10)
-         and store them in col.c instead objective coefficients */
+         and store them in col.d (objective coefficients are kept, so
+         the solution can be recovered once again) */
       for (col = info->ptr; col != NULL; col = col->next)
       {  d = col->c;
          for (lfe = col->ptr; lfe != NULL; lfe = lfe->next)
             d -= lfe->val * npp->r_pi[lfe->ref];
-         col->c = d;
+         col->d = d;
       }
       /* consider columns j, whose multipliers lambda[j] has wrong
          sign in solution to the transformed problem (where lambda[j] =
@@ -2212,7 +2260,7 @@ static int rcv_forcing_row(NPP *npp, void *_info)
          zero last on changing row multiplier pi[p]; see (14) */
       piv = NULL, big = 0.0;
       for (col = info->ptr; col != NULL; col = col->next)
-      {  d = col->c; /* d[j] */
+      {  d = col->d; /* d[j] */
          temp = fabs(d / col->a);
          if (col->stat == GLP_NL)
          {  /* column j has active lower bound */
@@ -2238,7 +2286,7 @@ static int rcv_forcing_row(NPP *npp, void *_info)
             npp->c_stat[piv->j] = GLP_BS;
          }
          /* assign new value to row multiplier pi[p] = d[p] / a[p,q] */
-         npp->r_pi[info->p] = piv->c / piv->a;
+         npp->r_pi[info->p] = piv->d / piv->a;
       }
 done: return 0;
 }
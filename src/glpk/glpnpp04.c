@@ -197,6 +197,7 @@ int npp_binarize_prob(NPP *npp)
             bin->is_int = 1;
             bin->lb = 0.0, bin->ub = 1.0;
             bin->coef = (double)temp * col->coef;
+            npp_obj_lin(npp, NPP_OBJ_SET, bin->j, col->j, (double)temp);
             /* store column reference number for x[1] */
             if (info->j == 0)
                info->j = bin->j;
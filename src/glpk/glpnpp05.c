@@ -256,9 +256,9 @@ int npp_process_row(NPP *npp, NPPROW *row, int hard)
                xassert(ret != ret);
          }
       }
-#if 0
-      /* sometimes this causes too large round-off errors; probably
-         pivot coefficient should be chosen more carefully */
+#if 1 /* 19/X-2026 */
+      /* pivot coefficient is chosen by the routine npp_eq_doublet to
+         be largest in magnitude to avoid large round-off errors */
       if (row->ptr->r_next->r_next == NULL)
       {  /* row doubleton */
          if (row->lb == row->ub)
@@ -507,7 +507,10 @@ int npp_improve_bounds(NPP *npp, NPPROW *row, int flag)
 *     corresponding row if it becomes free;
 *
 *  3) removing bounds of column, which is implied free variable, and
-*     replacing corresponding row by equality constraint.
+*     replacing corresponding row by equality constraint;
+*
+*  4) fixing and removing dominated column (see the routine
+*     npp_dom_col).
 *
 *  Additionally the routine may activate affected rows and/or columns
 *  for further processing.
@@ -601,6 +604,15 @@ slack:      {  /* implied slack variable */
             }
          }
       }
+#if 1 /* 19/X-2026 */
+      if (npp_dom_col(npp, col) == 0)
+      {  /* dominated column was fixed and deleted */
+#ifdef GLP_DEBUG
+         xprintf("W");
+#endif
+         return 0;
+      }
+#endif
       /* column still exists */
       return 0;
 }
@@ -622,9 +634,15 @@ slack:      {  /* implied slack variable */
 *
 *  1) initial LP/MIP processing (see the routine npp_clean_prob),
 *
-*  2) basic row processing (see the routine npp_process_row), and
+*  2) basic row processing (see the routine npp_process_row),
+*
+*  3) basic column processing (see the routine npp_process_col), and
 *
-*  3) basic column processing (see the routine npp_process_col).
+*  4) removing parallel rows and columns and probing binary columns
+*     (see the routine npp_global_pass).
+*
+*  Steps 2)-4) are repeated while reductions are made in step 4), but
+*  not more than NPP_ROUNDS times.
 *
 *  If the flag hard is on, the routine attempts to improve current
 *  column bounds multiple times within the main processing loop, in
@@ -649,11 +667,14 @@ slack:      {  /* implied slack variable */
 *
 *  GLP_ENODFS  dual infeasibility detected. */
 
+#define NPP_ROUNDS 4
+/* maximal number of rounds of global reductions */
+
 int npp_process_prob(NPP *npp, int hard)
 {     /* perform basic LP/MIP processing */
       NPPROW *row;
       NPPCOL *col;
-      int processing, ret;
+      int processing, round, count, ret;
       /* perform initial LP/MIP processing */
       npp_clean_prob(npp);
       /* activate all remaining rows and columns */
@@ -661,6 +682,10 @@ int npp_process_prob(NPP *npp, int hard)
          row->temp = 1;
       for (col = npp->c_head; col != NULL; col = col->next)
          col->temp = 1;
+#if 1 /* 19/X-2026 */
+      round = 0;
+loop:
+#endif
       /* main processing loop */
       processing = 1;
       while (processing)
@@ -684,6 +709,22 @@ int npp_process_prob(NPP *npp, int hard)
             processing = 1;
          }
       }
+#if 1 /* 19/X-2026 */
+      /* perform reductions, which consider the whole problem */
+      if (++round <= NPP_ROUNDS)
+      {  ret = npp_global_pass(npp, &count);
+         if (ret != 0) goto done;
+         if (count > 0)
+         {  /* activate all remaining rows and columns and repeat
+               basic processing */
+            for (row = npp->r_head; row != NULL; row = row->next)
+               row->temp = 1;
+            for (col = npp->c_head; col != NULL; col = col->next)
+               col->temp = 1;
+            goto loop;
+         }
+      }
+#endif
 #if 1 /* 23/XII-2009 */
       if (npp->sol == GLP_MIP && !hard)
       {  /* improve current column bounds (optional) */
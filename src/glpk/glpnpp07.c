@@ -0,0 +1,945 @@
+/* glpnpp07.c (dominated columns, parallel rows/columns, probing) */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+*  2009, 2010, 2011, 2013 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include <pthread.h>
+#include "glpenv.h"
+#include "glpnpp.h"
+
+/***********************************************************************
+*  fix_col - fix column at its bound
+*
+*  This routine fixes column q, which is known to have an optimal value
+*  equal to its lower bound (stat = GLP_NL), upper bound (GLP_NU) or
+*  zero (GLP_NF, free column), and then removes it from the problem.
+*
+*  RECOVERING BASIC SOLUTION
+*
+*  Column q is recovered as non-basic with status stat. Its reduced
+*  cost is dual feasible due to the condition used to fix the column.
+*
+*  RECOVERING INTERIOR-POINT SOLUTION
+*
+*  None needed.
+*
+*  RECOVERING MIP SOLUTION
+*
+*  None needed. */
+
+struct fix_col
+{     /* column fixed at its bound */
+      int q;
+      /* column reference number */
+      char stat;
+      /* status of column q in basic solution (GLP_NL, GLP_NU or
+         GLP_NF) */
+};
+
+static int rcv_fix_col(NPP *npp, void *info);
+
+static void fix_col(NPP *npp, NPPCOL *q, int stat)
+{     /* fix column at its bound */
+      struct fix_col *info;
+      NPPAIJ *aij;
+      /* create transformation stack entry */
+      info = npp_push_tse(npp,
+         rcv_fix_col, sizeof(struct fix_col));
+      info->q = q->j;
+      info->stat = (char)stat;
+      /* fix the column */
+      if (stat == GLP_NL)
+         q->ub = q->lb;
+      else if (stat == GLP_NU)
+         q->lb = q->ub;
+      else if (stat == GLP_NF)
+         q->lb = q->ub = 0.0;
+      else
+         xassert(stat != stat);
+      /* activate rows affected by the column, since their bounds will
+         change */
+      for (aij = q->ptr; aij != NULL; aij = aij->c_next)
+         npp_activate_row(npp, aij->row);
+      /* process fixed column */
+      npp_fixed_col(npp, q);
+      /* column was deleted */
+      return;
+}
+
+static int rcv_fix_col(NPP *npp, void *_info)
+{     /* recover column fixed at its bound */
+      struct fix_col *info = _info;
+      if (npp->sol == GLP_SOL)
+      {  /* the column was recovered as fixed by rcv_fixed_col */
+         if (npp->c_stat[info->q] != GLP_NS)
+         {  npp_error();
+            return 1;
+         }
+         npp->c_stat[info->q] = info->stat;
+      }
+      return 0;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  npp_dom_col - process dominated column
+*
+*  SYNOPSIS
+*
+*  #include "glpnpp.h"
+*  int npp_dom_col(NPP *npp, NPPCOL *q);
+*
+*  DESCRIPTION
+*
+*  The routine npp_dom_col processes column q, which is not fixed.
+*
+*  Let c[q] >= 0, and for every row i, where a[i,q] != 0, decreasing
+*  x[q] cannot violate row i, i.e. row i has no lower bound if a[i,q]
+*  > 0 and no upper bound if a[i,q] < 0. Then, if x[q] has a lower
+*  bound, it can be fixed at this bound, since for any feasible point
+*  the point, where x[q] is replaced by l[q], is also feasible and has
+*  not greater objective value. Similarly, if c[q] <= 0, increasing
+*  x[q] cannot violate any row, and x[q] has an upper bound, it can be
+*  fixed at its upper bound. Both cases are valid for MIP as well.
+*
+*  RETURNS
+*
+*  0 - column has been fixed and removed from the problem;
+*
+*  1 - column is not dominated.
+*
+*  RECOVERING BASIC SOLUTION
+*
+*  Column q is recovered as non-basic on its lower (upper) bound. Since
+*  row multipliers satisfy pi[i] <= 0 for rows having upper bound only
+*  and pi[i] >= 0 for rows having lower bound only, its reduced cost
+*
+*     d[q] = c[q] - sum a[i,q] pi[i]
+*                    i
+*
+*  has the same sign as c[q], i.e. it is dual feasible. */
+
+int npp_dom_col(NPP *npp, NPPCOL *q)
+{     /* process dominated column */
+      NPPAIJ *aij;
+      int down, up;
+      /* the column must not be fixed */
+      xassert(q->lb < q->ub);
+      /* determine directions, in which x[q] can be changed without
+         violating any row */
+      down = up = 1;
+      for (aij = q->ptr; aij != NULL; aij = aij->c_next)
+      {  if (aij->val > 0.0)
+         {  if (aij->row->lb != -DBL_MAX) down = 0;
+            if (aij->row->ub != +DBL_MAX) up = 0;
+         }
+         else
+         {  if (aij->row->ub != +DBL_MAX) down = 0;
+            if (aij->row->lb != -DBL_MAX) up = 0;
+         }
+         if (!(down || up)) return 1;
+      }
+      if (down && q->coef >= 0.0 && q->lb != -DBL_MAX)
+      {  npp_obj_chk(npp, q->j, 1.0, 0.0, +DBL_MAX);
+         fix_col(npp, q, GLP_NL);
+         return 0;
+      }
+      if (up && q->coef <= 0.0 && q->ub != +DBL_MAX)
+      {  npp_obj_chk(npp, q->j, 1.0, -DBL_MAX, 0.0);
+         fix_col(npp, q, GLP_NU);
+         return 0;
+      }
+      return 1;
+}
+
+/***********************************************************************
+*  dup_row - process parallel rows
+*
+*  This routine processes rows p and q, where a[q] = lambda * a[p],
+*  lambda != 0. Row q is equivalent to the following bounds of row p:
+*
+*     L[q] / lambda <= sum a[p,j] x[j] <= U[q] / lambda,
+*                       j
+*
+*  (bounds are swapped if lambda < 0), so the bounds of row p are
+*  replaced by their intersection with these bounds, and row q is
+*  removed from the problem.
+*
+*  RETURNS
+*
+*  0 - rows are not processed due to almost coincident bounds;
+*
+*  1 - row q has been removed;
+*
+*  2 - primal infeasibility detected.
+*
+*  RECOVERING BASIC SOLUTION
+*
+*  If row p is basic, row q is also basic. Otherwise, let row p be
+*  active on its lower or upper bound (for active equality the bound
+*  is determined by the sign of pi[p]). If this bound belonged to row
+*  p before processing, row q is basic; otherwise, row q is active on
+*  the corresponding bound, row p becomes basic, and the multipliers
+*  are pi[q] = pi[p] / lambda, pi[p] = 0.
+*
+*  RECOVERING INTERIOR-POINT SOLUTION
+*
+*  The multiplier pi[p] is moved to row q in the same way.
+*
+*  RECOVERING MIP SOLUTION
+*
+*  None needed. */
+
+struct dup_row
+{     /* parallel rows */
+      int p, q;
+      /* row reference numbers */
+      double lambda;
+      /* a[q] = lambda * a[p] */
+      char p_lb, p_ub;
+      /* flags meaning that the lower/upper bound of row p after
+         processing is its original bound rather than bound of row q */
+      char p_eq, q_eq;
+      /* flags meaning that row p/q was equality constraint */
+};
+
+static int rcv_dup_row(NPP *npp, void *info);
+
+static int dup_row(NPP *npp, NPPROW *p, NPPROW *q, double lambda)
+{     /* process parallel rows */
+      struct dup_row *info;
+      double lb, ub, eps;
+      int p_lb, p_ub;
+      /* determine bounds of row p implied by row q */
+      if (lambda > 0.0)
+      {  lb = (q->lb == -DBL_MAX ? -DBL_MAX : q->lb / lambda);
+         ub = (q->ub == +DBL_MAX ? +DBL_MAX : q->ub / lambda);
+      }
+      else
+      {  lb = (q->ub == +DBL_MAX ? -DBL_MAX : q->ub / lambda);
+         ub = (q->lb == -DBL_MAX ? +DBL_MAX : q->lb / lambda);
+      }
+      /* intersect them with bounds of row p */
+      p_lb = (lb <= p->lb);
+      if (p_lb) lb = p->lb;
+      p_ub = (ub >= p->ub);
+      if (p_ub) ub = p->ub;
+      if (lb > ub)
+      {  eps = 1e-9 * (1.0 + (fabs(lb) > fabs(ub) ? fabs(lb) :
+            fabs(ub)));
+         return lb - ub > eps ? 2 : 0;
+      }
+      /* create transformation stack entry */
+      info = npp_push_tse(npp,
+         rcv_dup_row, sizeof(struct dup_row));
+      info->p = p->i;
+      info->q = q->i;
+      info->lambda = lambda;
+      info->p_lb = (char)p_lb;
+      info->p_ub = (char)p_ub;
+      info->p_eq = (char)(p->lb == p->ub);
+      info->q_eq = (char)(q->lb == q->ub);
+      /* change bounds of row p and remove row q */
+      p->lb = lb, p->ub = ub;
+      npp_del_row(npp, q);
+      return 1;
+}
+
+static int rcv_dup_row(NPP *npp, void *_info)
+{     /* recover parallel rows */
+      struct dup_row *info = _info;
+      int stat, lower, own;
+      double pi;
+      if (npp->sol == GLP_MIP)
+         return 0;
+      pi = npp->r_pi[info->p];
+      if (npp->sol == GLP_SOL)
+      {  stat = npp->r_stat[info->p];
+         if (stat == GLP_BS)
+         {  npp->r_stat[info->q] = GLP_BS;
+            npp->r_pi[info->q] = 0.0;
+            return 0;
+         }
+         if (stat == GLP_NL)
+            lower = 1;
+         else if (stat == GLP_NU)
+            lower = 0;
+         else if (stat == GLP_NS)
+            lower = (pi >= 0.0);
+         else
+         {  npp_error();
+            return 1;
+         }
+      }
+      else
+         lower = (pi >= 0.0);
+      own = (lower ? info->p_lb : info->p_ub);
+      if (own)
+      {  /* active bound belongs to row p */
+         if (npp->sol == GLP_SOL && !info->p_eq)
+            npp->r_stat[info->p] = (char)(lower ? GLP_NL : GLP_NU);
+         npp->r_stat[info->q] = GLP_BS;
+         npp->r_pi[info->q] = 0.0;
+      }
+      else
+      {  /* active bound belongs to row q */
+         if (info->lambda < 0.0) lower = !lower;
+         if (npp->sol == GLP_SOL)
+         {  if (info->q_eq)
+               npp->r_stat[info->q] = GLP_NS;
+            else
+               npp->r_stat[info->q] = (char)(lower ? GLP_NL : GLP_NU);
+            npp->r_stat[info->p] = GLP_BS;
+         }
+         npp->r_pi[info->q] = pi / info->lambda;
+         npp->r_pi[info->p] = 0.0;
+      }
+      return 0;
+}
+
+/***********************************************************************
+*  dup_col - process parallel columns
+*
+*  This routine processes columns j and k, where a[k] = lambda * a[j],
+*  lambda != 0, and x[j] is continuous. Changing x[k] by -t and x[j] by
+*  lambda * t does not change any row, while the objective changes by
+*  -t * d, where d = c[k] - lambda * c[j]. Thus, if d >= 0 and x[j] can
+*  be increased by lambda * t for any t >= 0 (i.e. it has no upper
+*  bound if lambda > 0 or no lower bound if lambda < 0), x[k] can be
+*  fixed at its lower bound. Similarly, if d <= 0 and x[j] can be
+*  decreased by lambda * t, x[k] can be fixed at its upper bound, and
+*  if d = 0 and x[j] is free, free x[k] can be fixed at zero.
+*
+*  RETURNS
+*
+*  0 - column k has been fixed and removed from the problem;
+*
+*  1 - column k is not dominated by column j.
+*
+*  RECOVERING BASIC SOLUTION
+*
+*  Column k is recovered as non-basic. Its reduced cost is
+*  d[k] = d + lambda * d[j], where d[j] has the sign which makes d[k]
+*  dual feasible, since x[j] has no bound in the corresponding
+*  direction. */
+
+static int dup_col(NPP *npp, NPPCOL *j, NPPCOL *k, double lambda)
+{     /* process parallel columns */
+      double d, eps = 1e-9;
+      int up, down;
+      xassert(!j->is_int);
+      d = k->coef - lambda * j->coef;
+      /* determine whether x[j] can absorb decreasing (down) and
+         increasing (up) of x[k] */
+      if (lambda > 0.0)
+         down = (j->ub == +DBL_MAX), up = (j->lb == -DBL_MAX);
+      else
+         down = (j->lb == -DBL_MAX), up = (j->ub == +DBL_MAX);
+      if (down && d >= -eps && k->lb != -DBL_MAX)
+      {  npp_obj_chk2(npp, k->j, 1.0, j->j, -lambda, -eps, +DBL_MAX);
+         fix_col(npp, k, GLP_NL);
+         return 0;
+      }
+      if (up && d <= +eps && k->ub != +DBL_MAX)
+      {  npp_obj_chk2(npp, k->j, 1.0, j->j, -lambda, -DBL_MAX, +eps);
+         fix_col(npp, k, GLP_NU);
+         return 0;
+      }
+      if (down && up && fabs(d) <= eps && k->lb == -DBL_MAX &&
+          k->ub == +DBL_MAX)
+      {  npp_obj_chk2(npp, k->j, 1.0, j->j, -lambda, -eps, +eps);
+         fix_col(npp, k, GLP_NF);
+         return 0;
+      }
+      return 1;
+}
+
+/***********************************************************************
+*  Parallel rows and columns are found by hashing. The hash code of a
+*  vector does not depend on the order of its elements and is invariant
+*  to scaling, since every element is divided by the element having the
+*  smallest index. Rows and columns having the same hash code and the
+*  same length are then compared explicitly.
+*
+*  Probing is applied to binary columns of MIP. For each of x[j] = 0
+*  and x[j] = 1 implied activity bounds of rows containing x[j] are
+*  checked for infeasibility; fixing of other binary columns implied
+*  by these rows is also propagated to rows containing such columns.
+*  If x[j] = v leads to infeasibility, x[j] is fixed at 1 - v.
+*
+*  Hash codes, implied activity bounds and probing results are computed
+*  on a snapshot of the problem, which is not changed until all these
+*  computations have finished; thus, rows and columns are processed
+*  concurrently by npp->threads threads. The reductions themselves are
+*  then made by the calling thread in a fixed order, so the result does
+*  not depend on the number of threads. */
+
+#define PAR_MIN 100000
+/* threads are used only if the number of constraint coefficients is
+   not less than this value */
+
+#define BUCKET_MAX 20
+/* maximal number of rows/columns, with which each row/column having
+   the same hash code is compared */
+
+#define PROBE_LEN 50
+/* maximal length of rows used to derive fixing of other columns on
+   probing */
+
+typedef struct GPASS GPASS;
+typedef struct GWRK GWRK;
+typedef struct GKEY GKEY;
+
+struct GPASS
+{     /* global pass common storage */
+      NPP *npp;
+      int nr, nc, nb;
+      /* number of rows, columns and binary columns */
+      NPPROW **row; /* NPPROW *row[1+nr]; */
+      NPPCOL **col; /* NPPCOL *col[1+nc]; */
+      /* rows and columns of the snapshot */
+      GKEY *rkey; /* GKEY rkey[1+nr]; */
+      GKEY *ckey; /* GKEY ckey[1+nc]; */
+      /* hash codes of rows and columns */
+      double *lmin, *lmax; /* double lmin/lmax[1+nrows]; */
+      int *nmin, *nmax; /* int nmin/nmax[1+nrows]; */
+      /* implied bounds of row i are lmin[i] (-inf, if nmin[i] > 0)
+         and lmax[i] (+inf, if nmax[i] > 0), where nmin[i] and nmax[i]
+         are numbers of infinite terms */
+      int *bin; /* int bin[1+nb]; */
+      /* positions of binary columns in the array col */
+      char *res; /* char res[1+nb]; */
+      /* probing results: bit 0 means that x[j] = 0 is infeasible, bit
+         1 means that x[j] = 1 is infeasible */
+};
+
+struct GKEY
+{     /* hash key of row/column */
+      unsigned int h;
+      /* hash code */
+      int len;
+      /* number of elements */
+      int pos;
+      /* position in the array row/col */
+};
+
+struct GWRK
+{     /* worker thread */
+      GPASS *G;
+      int first, step;
+      /* items first, first + step, ... are processed by the worker */
+      int stamp;
+      int *rmark; /* int rmark[1+nrows]; */
+      double *dmin, *dmax; /* double dmin/dmax[1+nrows]; */
+      /* changes of implied row bounds due to fixed columns, valid if
+         rmark[i] = stamp */
+      int *cmark; /* int cmark[1+ncols]; */
+      NPPCOL **queue; /* NPPCOL *queue[1+ncols]; */
+      char *qval; /* char qval[1+ncols]; */
+      /* columns fixed on probing */
+      pthread_t tid;
+};
+
+static unsigned int hash_elem(int ref, double val, double ref_val)
+{     /* hash code of element ratio */
+      double r = val / ref_val;
+      long long q;
+      if (r > 1e12) r = 1e12;
+      if (r < -1e12) r = -1e12;
+      q = (long long)floor(r * 1e6 + 0.5);
+      return ((unsigned int)ref * 2654435761u) ^
+         ((unsigned int)(q ^ (q >> 32)) * 2246822519u);
+}
+
+static void hash_row(GPASS *G, int k)
+{     /* compute hash code and implied bounds of row */
+      NPPROW *row = G->row[k];
+      NPPAIJ *aij, *ref;
+      unsigned int h, t;
+      int len, i = row->i, nmin = 0, nmax = 0;
+      double lmin = 0.0, lmax = 0.0;
+      ref = row->ptr;
+      for (aij = row->ptr; aij != NULL; aij = aij->r_next)
+         if (aij->col->j < ref->col->j) ref = aij;
+      h = 0, len = 0;
+      for (aij = row->ptr; aij != NULL; aij = aij->r_next)
+      {  NPPCOL *col = aij->col;
+         t = hash_elem(col->j, aij->val, ref->val);
+         h += t * (t | 1);
+         len++;
+         if (aij->val > 0.0)
+         {  if (col->lb == -DBL_MAX)
+               nmin++;
+            else
+               lmin += aij->val * col->lb;
+            if (col->ub == +DBL_MAX)
+               nmax++;
+            else
+               lmax += aij->val * col->ub;
+         }
+         else
+         {  if (col->ub == +DBL_MAX)
+               nmin++;
+            else
+               lmin += aij->val * col->ub;
+            if (col->lb == -DBL_MAX)
+               nmax++;
+            else
+               lmax += aij->val * col->lb;
+         }
+      }
+      G->rkey[k].h = h, G->rkey[k].len = len, G->rkey[k].pos = k;
+      G->lmin[i] = lmin, G->nmin[i] = nmin;
+      G->lmax[i] = lmax, G->nmax[i] = nmax;
+      return;
+}
+
+static void hash_col(GPASS *G, int k)
+{     /* compute hash code of column */
+      NPPCOL *col = G->col[k];
+      NPPAIJ *aij, *ref;
+      unsigned int h, t;
+      int len;
+      ref = col->ptr;
+      for (aij = col->ptr; aij != NULL; aij = aij->c_next)
+         if (aij->row->i < ref->row->i) ref = aij;
+      h = 0, len = 0;
+      for (aij = col->ptr; aij != NULL; aij = aij->c_next)
+      {  t = hash_elem(aij->row->i, aij->val, ref->val);
+         h += t * (t | 1);
+         len++;
+      }
+      G->ckey[k].h = h, G->ckey[k].len = len, G->ckey[k].pos = k;
+      return;
+}
+
+static int is_binary(NPPCOL *col)
+{     /* check if column is binary */
+      return col->is_int && col->lb == 0.0 && col->ub == 1.0;
+}
+
+static double row_tol(double b)
+{     /* tolerance used to check row bound on probing */
+      return 1e-6 * (1.0 + fabs(b));
+}
+
+static int row_viol(GWRK *W, NPPROW *row, double dmin, double dmax)
+{     /* check if row cannot be satisfied, where dmin and dmax are
+         changes of its implied bounds */
+      GPASS *G = W->G;
+      int i = row->i;
+      if (G->nmin[i] == 0 && row->ub != +DBL_MAX &&
+          G->lmin[i] + dmin > row->ub + row_tol(row->ub))
+         return 1;
+      if (G->nmax[i] == 0 && row->lb != -DBL_MAX &&
+          G->lmax[i] + dmax < row->lb - row_tol(row->lb))
+         return 1;
+      return 0;
+}
+
+static int probe(GWRK *W, NPPCOL *col, int v)
+{     /* check if x[col] = v is infeasible */
+      NPPCOL *c, *m;
+      NPPAIJ *aij, *aim;
+      NPPROW *row;
+      int i, t, nq, w, len, bad0, bad1;
+      double a, dmin, dmax;
+      W->stamp++;
+      nq = 1;
+      W->queue[1] = col, W->qval[1] = (char)v;
+      W->cmark[col->j] = W->stamp;
+      for (t = 1; t <= nq; t++)
+      {  c = W->queue[t], w = W->qval[t];
+         for (aij = c->ptr; aij != NULL; aij = aij->c_next)
+         {  row = aij->row, i = row->i;
+            if (W->rmark[i] != W->stamp)
+            {  W->rmark[i] = W->stamp;
+               W->dmin[i] = W->dmax[i] = 0.0;
+            }
+            /* replace term a * x[c], l[c] <= x[c] <= u[c], in implied
+               row bounds by a * w */
+            a = aij->val;
+            if (a > 0.0)
+            {  W->dmin[i] += a * ((double)w - c->lb);
+               W->dmax[i] += a * ((double)w - c->ub);
+            }
+            else
+            {  W->dmin[i] += a * ((double)w - c->ub);
+               W->dmax[i] += a * ((double)w - c->lb);
+            }
+            if (row_viol(W, row, W->dmin[i], W->dmax[i]))
+               return 1;
+            if (t > 1) continue;
+            /* derive fixing of other binary columns in the row */
+            len = 0;
+            for (aim = row->ptr; aim != NULL; aim = aim->r_next)
+               if (++len > PROBE_LEN) break;
+            if (len > PROBE_LEN) continue;
+            for (aim = row->ptr; aim != NULL; aim = aim->r_next)
+            {  m = aim->col;
+               if (W->cmark[m->j] == W->stamp || !is_binary(m))
+                  continue;
+               a = aim->val;
+               dmin = W->dmin[i] - (a > 0.0 ? 0.0 : a);
+               dmax = W->dmax[i] - (a > 0.0 ? a : 0.0);
+               /* x[m] = 0 and x[m] = 1 */
+               bad0 = row_viol(W, row, dmin, dmax);
+               bad1 = row_viol(W, row, dmin + a, dmax + a);
+               if (bad0 && bad1)
+                  return 1;
+               if (bad0 || bad1)
+               {  nq++;
+                  W->queue[nq] = m, W->qval[nq] = (char)bad0;
+                  W->cmark[m->j] = W->stamp;
+               }
+            }
+         }
+      }
+      return 0;
+}
+
+static void run_worker(GWRK *W, int phase)
+{     /* run tasks assigned to the worker */
+      GPASS *G = W->G;
+      int k;
+      if (phase == 1)
+      {  /* rows and columns are processed concurrently */
+         for (k = W->first; k <= G->nr + G->nc; k += W->step)
+         {  if (k <= G->nr)
+               hash_row(G, k);
+            else
+               hash_col(G, k - G->nr);
+         }
+      }
+      else
+      {  for (k = W->first; k <= G->nb; k += W->step)
+         {  NPPCOL *col = G->col[G->bin[k]];
+            G->res[k] = (char)(probe(W, col, 0) |
+               probe(W, col, 1) << 1);
+         }
+      }
+      return;
+}
+
+struct GARG
+{     /* argument of worker thread */
+      GWRK *W;
+      int phase;
+};
+
+static void *worker_thread(void *arg)
+{     /* worker thread routine */
+      struct GARG *A = arg;
+      run_worker(A->W, A->phase);
+      return NULL;
+}
+
+static void run_phase(GWRK *wrk, int nthreads, int phase)
+{     /* run phase using nthreads threads */
+      struct GARG *arg;
+      int t, nwrk;
+      arg = xcalloc(nthreads, sizeof(struct GARG));
+      for (t = 0; t < nthreads; t++)
+         arg[t].W = &wrk[t], arg[t].phase = phase;
+      /* tasks of the workers failed to start are run by the calling
+         thread */
+      for (nwrk = 1; nwrk < nthreads; nwrk++)
+      {  if (pthread_create(&wrk[nwrk].tid, NULL, worker_thread,
+               &arg[nwrk]) != 0)
+            break;
+      }
+      run_worker(&wrk[0], phase);
+      for (t = nwrk; t < nthreads; t++)
+         run_worker(&wrk[t], phase);
+      for (t = 1; t < nwrk; t++)
+         pthread_join(wrk[t].tid, NULL);
+      xfree(arg);
+      return;
+}
+
+static int fcmp(const void *p1, const void *p2)
+{     /* compare hash keys */
+      const GKEY *k1 = p1, *k2 = p2;
+      if (k1->h < k2->h) return -1;
+      if (k1->h > k2->h) return +1;
+      if (k1->len < k2->len) return -1;
+      if (k1->len > k2->len) return +1;
+      if (k1->pos < k2->pos) return -1;
+      if (k1->pos > k2->pos) return +1;
+      return 0;
+}
+
+static int par_rows(NPPROW *p, NPPROW *q, int mark[],
+      double val[], int stamp, double *lambda)
+{     /* check if row q is parallel to row p */
+      NPPAIJ *aij;
+      int lp = 0, lq = 0;
+      double t;
+      for (aij = p->ptr; aij != NULL; aij = aij->r_next)
+      {  mark[aij->col->j] = stamp;
+         val[aij->col->j] = aij->val;
+         lp++;
+      }
+      xassert(q->ptr != NULL);
+      if (mark[q->ptr->col->j] != stamp) return 0;
+      *lambda = q->ptr->val / val[q->ptr->col->j];
+      for (aij = q->ptr; aij != NULL; aij = aij->r_next)
+      {  if (mark[aij->col->j] != stamp) return 0;
+         t = *lambda * val[aij->col->j];
+         if (fabs(aij->val - t) > 1e-9 * fabs(aij->val)) return 0;
+         lq++;
+      }
+      return lp == lq;
+}
+
+static int par_cols(NPPCOL *j, NPPCOL *k, int mark[],
+      double val[], int stamp, double *lambda)
+{     /* check if column k is parallel to column j */
+      NPPAIJ *aij;
+      int lj = 0, lk = 0;
+      double t;
+      for (aij = j->ptr; aij != NULL; aij = aij->c_next)
+      {  mark[aij->row->i] = stamp;
+         val[aij->row->i] = aij->val;
+         lj++;
+      }
+      xassert(k->ptr != NULL);
+      if (mark[k->ptr->row->i] != stamp) return 0;
+      *lambda = k->ptr->val / val[k->ptr->row->i];
+      for (aij = k->ptr; aij != NULL; aij = aij->c_next)
+      {  if (mark[aij->row->i] != stamp) return 0;
+         t = *lambda * val[aij->row->i];
+         if (fabs(aij->val - t) > 1e-9 * fabs(aij->val)) return 0;
+         lk++;
+      }
+      return lj == lk;
+}
+
+/***********************************************************************
+*  NAME
+*
+*  npp_global_pass - remove parallel rows and columns and probe binary
+*  columns
+*
+*  SYNOPSIS
+*
+*  #include "glpnpp.h"
+*  int npp_global_pass(NPP *npp, int *count);
+*
+*  DESCRIPTION
+*
+*  The routine npp_global_pass performs reductions, which need to
+*  consider the whole problem rather than a single row or column:
+*
+*  1) removing parallel rows (see the routine dup_row);
+*
+*  2) fixing dominated parallel columns (see the routine dup_col);
+*
+*  3) fixing binary columns by probing (MIP only).
+*
+*  Rows and columns are analyzed concurrently (see comments above).
+*  On exit the number of reductions made is stored in *count.
+*
+*  RETURNS
+*
+*  0           success;
+*
+*  GLP_ENOPFS  primal/integer infeasibility detected. */
+
+int npp_global_pass(NPP *npp, int *count)
+{     GPASS _G, *G = &_G;
+      GWRK *wrk;
+      NPPROW *row;
+      NPPCOL *col;
+      NPPAIJ *aij;
+      char *gone;
+      double *val, lambda;
+      int *mark, stamp, a, b, e, k, t, nnz, nthreads, ret;
+      *count = 0;
+      /* build the snapshot */
+      G->npp = npp;
+      G->nr = G->nc = G->nb = 0;
+      nnz = 0;
+      for (row = npp->r_head; row != NULL; row = row->next)
+         G->nr++;
+      for (col = npp->c_head; col != NULL; col = col->next)
+      {  G->nc++;
+         for (aij = col->ptr; aij != NULL; aij = aij->c_next)
+            nnz++;
+      }
+      if (G->nr == 0 || G->nc == 0)
+      {  ret = 0;
+         goto skip;
+      }
+      G->row = xcalloc(1+G->nr, sizeof(NPPROW *));
+      G->col = xcalloc(1+G->nc, sizeof(NPPCOL *));
+      G->rkey = xcalloc(1+G->nr, sizeof(GKEY));
+      G->ckey = xcalloc(1+G->nc, sizeof(GKEY));
+      G->lmin = xcalloc(1+npp->nrows, sizeof(double));
+      G->lmax = xcalloc(1+npp->nrows, sizeof(double));
+      G->nmin = xcalloc(1+npp->nrows, sizeof(int));
+      G->nmax = xcalloc(1+npp->nrows, sizeof(int));
+      G->bin = xcalloc(1+G->nc, sizeof(int));
+      G->res = xcalloc(1+G->nc, sizeof(char));
+      k = 0;
+      for (row = npp->r_head; row != NULL; row = row->next)
+         G->row[++k] = row;
+      k = 0;
+      for (col = npp->c_head; col != NULL; col = col->next)
+      {  G->col[++k] = col;
+         if (npp->sol == GLP_MIP && is_binary(col) && col->ptr != NULL)
+            G->bin[++G->nb] = k;
+      }
+      /* compute hash codes, implied row bounds and probing results */
+      nthreads = (nnz >= PAR_MIN ? npp->threads : 1);
+      wrk = xcalloc(nthreads, sizeof(GWRK));
+      for (t = 0; t < nthreads; t++)
+      {  wrk[t].G = G;
+         wrk[t].first = 1 + t, wrk[t].step = nthreads;
+         wrk[t].stamp = 0;
+         if (G->nb > 0)
+         {  wrk[t].rmark = xcalloc(1+npp->nrows, sizeof(int));
+            wrk[t].dmin = xcalloc(1+npp->nrows, sizeof(double));
+            wrk[t].dmax = xcalloc(1+npp->nrows, sizeof(double));
+            wrk[t].cmark = xcalloc(1+npp->ncols, sizeof(int));
+            wrk[t].queue = xcalloc(1+npp->ncols, sizeof(NPPCOL *));
+            wrk[t].qval = xcalloc(1+npp->ncols, sizeof(char));
+            memset(wrk[t].rmark, 0, (1+npp->nrows) * sizeof(int));
+            memset(wrk[t].cmark, 0, (1+npp->ncols) * sizeof(int));
+         }
+      }
+      run_phase(wrk, nthreads, 1);
+      if (G->nb > 0)
+         run_phase(wrk, nthreads, 2);
+      for (t = 0; t < nthreads; t++)
+      {  if (G->nb > 0)
+         {  xfree(wrk[t].rmark);
+            xfree(wrk[t].dmin);
+            xfree(wrk[t].dmax);
+            xfree(wrk[t].cmark);
+            xfree(wrk[t].queue);
+            xfree(wrk[t].qval);
+         }
+      }
+      xfree(wrk);
+      /* remove parallel rows */
+      k = (npp->nrows > npp->ncols ? npp->nrows : npp->ncols);
+      mark = xcalloc(1+k, sizeof(int));
+      memset(mark, 0, (1+k) * sizeof(int));
+      val = xcalloc(1+k, sizeof(double));
+      stamp = 0;
+      gone = xcalloc(1+G->nr, sizeof(char));
+      memset(gone, 0, 1+G->nr);
+      qsort(&G->rkey[1], G->nr, sizeof(GKEY), fcmp);
+      for (b = 1; b <= G->nr; b = e)
+      {  for (e = b+1; e <= G->nr; e++)
+            if (!(G->rkey[b].h == G->rkey[e].h &&
+                  G->rkey[b].len == G->rkey[e].len)) break;
+         for (a = b; a < e; a++)
+         {  NPPROW *p = G->row[G->rkey[a].pos];
+            if (gone[G->rkey[a].pos] || p->ptr == NULL) continue;
+            if (p->lb == -DBL_MAX && p->ub == +DBL_MAX) continue;
+            for (k = a+1; k < e && k <= a+BUCKET_MAX; k++)
+            {  NPPROW *q = G->row[G->rkey[k].pos];
+               if (gone[G->rkey[k].pos] || q->ptr == NULL) continue;
+               if (!par_rows(p, q, mark, val, ++stamp, &lambda))
+                  continue;
+               switch (dup_row(npp, p, q, lambda))
+               {  case 0:
+                     break;
+                  case 1:
+                     gone[G->rkey[k].pos] = 1;
+                     npp_activate_row(npp, p);
+                     (*count)++;
+                     break;
+                  case 2:
+                     ret = GLP_ENOPFS;
+                     goto done;
+                  default:
+                     xassert(npp != npp);
+               }
+            }
+         }
+      }
+      /* fix dominated parallel columns */
+      xfree(gone);
+      gone = xcalloc(1+G->nc, sizeof(char));
+      memset(gone, 0, 1+G->nc);
+      qsort(&G->ckey[1], G->nc, sizeof(GKEY), fcmp);
+      for (b = 1; b <= G->nc; b = e)
+      {  for (e = b+1; e <= G->nc; e++)
+            if (!(G->ckey[b].h == G->ckey[e].h &&
+                  G->ckey[b].len == G->ckey[e].len)) break;
+         for (a = b; a < e; a++)
+         {  NPPCOL *j = G->col[G->ckey[a].pos];
+            if (gone[G->ckey[a].pos] || j->ptr == NULL) continue;
+            for (k = a+1; k < e && k <= a+BUCKET_MAX; k++)
+            {  NPPCOL *q = G->col[G->ckey[k].pos];
+               if (gone[G->ckey[k].pos] || q->ptr == NULL) continue;
+               if (!par_cols(j, q, mark, val, ++stamp, &lambda))
+                  continue;
+               if (!j->is_int && dup_col(npp, j, q, lambda) == 0)
+               {  gone[G->ckey[k].pos] = 1;
+                  (*count)++;
+               }
+               else if (!q->is_int &&
+                  dup_col(npp, q, j, 1.0 / lambda) == 0)
+               {  gone[G->ckey[a].pos] = 1;
+                  (*count)++;
+                  break;
+               }
+            }
+         }
+      }
+      /* fix binary columns by probing */
+      for (k = 1; k <= G->nb; k++)
+      {  if (gone[G->bin[k]] || G->res[k] == 0) continue;
+         col = G->col[G->bin[k]];
+         if (G->res[k] == 3)
+         {  ret = GLP_ENOPFS;
+            goto done;
+         }
+         col->lb = col->ub = (G->res[k] == 1 ? 1.0 : 0.0);
+         for (aij = col->ptr; aij != NULL; aij = aij->c_next)
+            npp_activate_row(npp, aij->row);
+         npp_fixed_col(npp, col);
+         (*count)++;
+      }
+      ret = 0;
+done: xfree(mark);
+      xfree(val);
+      xfree(gone);
+      xfree(G->row);
+      xfree(G->col);
+      xfree(G->rkey);
+      xfree(G->ckey);
+      xfree(G->lmin);
+      xfree(G->lmax);
+      xfree(G->nmin);
+      xfree(G->nmax);
+      xfree(G->bin);
+      xfree(G->res);
+skip: return ret;
+}
+
+/* eof */
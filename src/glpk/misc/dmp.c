@@ -215,6 +215,32 @@ size_t dmp_in_use(DMP *pool)
          pool->count;
 }
 
+#if 1 /* 19/X-2026 */
+/***********************************************************************
+*  NAME
+*
+*  dmp_size - determine how much memory is allocated to pool
+*
+*  SYNOPSIS
+*
+*  #include "dmp.h"
+*  size_t dmp_size(DMP *pool);
+*
+*  RETURNS
+*
+*  The routine returns the total size, in bytes, of memory blocks
+*  allocated to the specified memory pool. Note that these blocks are
+*  freed only on deleting the pool, even if all its atoms are free. */
+
+size_t dmp_size(DMP *pool)
+{     void *block;
+      size_t size = 0;
+      for (block = pool->block; block != NULL; block = *(void **)block)
+         size += DMP_BLK_SIZE;
+      return size;
+}
+#endif
+
 /***********************************************************************
 *  NAME
 *
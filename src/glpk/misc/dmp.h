@@ -54,6 +54,12 @@ void dmp_free_atom(DMP *pool, void *atom, int size);
 size_t dmp_in_use(DMP *pool);
 /* determine how many atoms are still in use */
 
+#if 1 /* 19/X-2026 */
+#define dmp_size _glp_dmp_size
+size_t dmp_size(DMP *pool);
+/* determine how much memory is allocated to pool */
+#endif
+
 #define dmp_delete_pool _glp_dmp_delete_pool
 void dmp_delete_pool(DMP *pool);
 /* delete dynamic memory pool */
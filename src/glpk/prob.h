@@ -73,6 +73,11 @@ struct glp_prob
       /* number of columns, 0 <= n <= n_max */
       int nnz;
       /* number of non-zero constraint coefficients, nnz >= 0 */
+      int rev;
+      /* revision count of the constraint matrix; it is incremented
+         every time the matrix pattern, its coefficients or scale
+         factors change, so simplex sessions can detect whether their
+         working LP is still up to date */
       GLPROW **row; /* GLPROW *row[1+m_max]; */
       /* row[i], 1 <= i <= m, is a pointer to i-th row */
       GLPCOL **col; /* GLPCOL *col[1+n_max]; */
@@ -130,6 +135,10 @@ struct glp_prob
          GLP_NOFEAS - no feasible solution exists */
       double ipt_obj;
       /* objective function value */
+      int ipt_xret;
+      /* code returned by the simplex solver on cleaning up the basis
+         recovered by the crossover; -1 means the crossover has not been
+         performed */
       /*--------------------------------------------------------------*/
       /* integer solution (MIP) */
       int mip_stat;
@@ -140,6 +149,22 @@ struct glp_prob
          GLP_NOFEAS - no integer solution exists */
       double mip_obj;
       /* objective function value */
+      /*--------------------------------------------------------------*/
+      /* solution pool (MIP) */
+      int sp_max;
+      /* maximal number of solutions in the pool; 0 means the pool
+         does not exist */
+      int sp_cnt;
+      /* number of solutions in the pool, 0 <= sp_cnt <= sp_max */
+      int sp_n;
+      /* number of columns the pooled solutions were obtained for */
+      double *sp_obj; /* double sp_obj[1+sp_max]; */
+      /* sp_obj[k], 1 <= k <= sp_cnt, is the objective value of k-th
+         pooled solution; solutions are ordered by their objective
+         values, the best one first */
+      double *sp_x; /* double sp_x[1+sp_max*sp_n]; */
+      /* sp_x[(k-1)*sp_n+j] is the value of j-th column in k-th pooled
+         solution */
 };
 
 struct GLPROW
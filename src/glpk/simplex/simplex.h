@@ -25,15 +25,24 @@
 #define SIMPLEX_H
 
 #include "prob.h"
+#include "spxws.h"
 
 #define spx_primal _glp_spx_primal
 int spx_primal(glp_prob *P, const glp_smcp *parm);
 /* driver to primal simplex method */
 
+#define spx_primal_ws _glp_spx_primal_ws
+int spx_primal_ws(glp_prob *P, const glp_smcp *parm, SPXWS *ws);
+/* driver to primal simplex method using persistent workspace */
+
 #define spy_dual _glp_spy_dual
 int spy_dual(glp_prob *P, const glp_smcp *parm);
 /* driver to dual simplex method */
 
+#define spy_dual_ws _glp_spy_dual_ws
+int spy_dual_ws(glp_prob *P, const glp_smcp *parm, SPXWS *ws);
+/* driver to dual simplex method using persistent workspace */
+
 #endif
 
 /* eof */
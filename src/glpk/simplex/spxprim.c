@@ -128,6 +128,9 @@ struct csa
       /* display output frequency, iterations */
       int out_dly;
       /* display output delay, milliseconds */
+      int (*stop_fn)(void *info);
+      void *stop_info;
+      /* termination request callback */
       /*--------------------------------------------------------------*/
       /* working parameters */
       double tm_beg;
@@ -667,6 +670,9 @@ skip: return;
 *  GLP_ETMLIM
 *     Time limit has been exhausted.
 *
+*  GLP_ESTOP
+*     Termination has been requested by the application.
+*
 *  GLP_EFAIL
 *     The solver failed to solve LP instance. */
 
@@ -819,6 +825,22 @@ loop: /* main loop starts here */
          ret = GLP_ETMLIM;
          goto fini;
       }
+      /* check if the application requested termination */
+      if (csa->stop_fn != NULL && csa->stop_fn(csa->stop_info))
+      {  if (csa->beta_st != 1)
+            csa->beta_st = 0;
+         if (csa->d_st != 1)
+            csa->d_st = 0;
+         if (!(csa->beta_st && csa->d_st))
+            goto loop;
+         display(csa, 1);
+         if (msg_lev >= GLP_MSG_ALL)
+            xprintf("SEARCH TERMINATED BY APPLICATION\n");
+         csa->p_stat = (csa->phase == 2 ? GLP_FEAS : GLP_INFEAS);
+         csa->d_stat = GLP_UNDEF; /* will be set below */
+         ret = GLP_ESTOP;
+         goto fini;
+      }
       /* display the search progress */
       display(csa, 0);
       /* select eligible non-basic variables */
@@ -983,6 +1005,12 @@ fini: /* restore original objective function */
 
 int spx_primal(glp_prob *P, const glp_smcp *parm)
 {     /* driver to primal simplex method */
+      return spx_primal_ws(P, parm, NULL);
+}
+
+int spx_primal_ws(glp_prob *P, const glp_smcp *parm, SPXWS *ws)
+{     /* driver to primal simplex method; if ws is not NULL, working LP
+       * and its basis should be already loaded with spx_load_ws */
       struct csa csa_, *csa = &csa_;
       SPXLP lp;
 #if USE_AT
@@ -991,15 +1019,24 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       SPXNT nt;
 #endif
       SPXSE se;
-      int ret, *map, *daeh;
+      int ret, shift, *map, *daeh;
       /* build working LP and its initial basis */
       memset(csa, 0, sizeof(struct csa));
-      csa->lp = &lp;
-      spx_init_lp(csa->lp, P, EXCL);
-      spx_alloc_lp(csa->lp);
-      map = talloc(1+P->m+P->n, int);
-      spx_build_lp(csa->lp, P, EXCL, SHIFT, map);
-      spx_build_basis(csa->lp, P, map);
+      if (ws == NULL)
+      {  csa->lp = &lp;
+         spx_init_lp(csa->lp, P, EXCL);
+         spx_alloc_lp(csa->lp);
+         map = talloc(1+P->m+P->n, int);
+         spx_build_lp(csa->lp, P, EXCL, SHIFT, map);
+         spx_build_basis(csa->lp, P, map);
+         shift = SHIFT;
+      }
+      else
+      {  /* working LP kept in workspace is never shifted */
+         csa->lp = &ws->lp;
+         map = ws->map;
+         shift = 0;
+      }
       switch (P->dir)
       {  case GLP_MIN:
             csa->dir = +1;
@@ -1014,17 +1051,28 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       memcpy(csa->c, csa->lp->c, (1+csa->lp->n) * sizeof(double));
 #if USE_AT
       /* build matrix A in row-wise format */
-      csa->at = &at;
       csa->nt = NULL;
-      spx_alloc_at(csa->lp, csa->at);
-      spx_build_at(csa->lp, csa->at);
+      if (ws == NULL)
+      {  csa->at = &at;
+         spx_alloc_at(csa->lp, csa->at);
+         spx_build_at(csa->lp, csa->at);
+      }
+      else
+         csa->at = spx_ws_at(ws);
 #else
       /* build matrix N in row-wise format for initial basis */
       csa->at = NULL;
-      csa->nt = &nt;
-      spx_alloc_nt(csa->lp, csa->nt);
-      spx_init_nt(csa->lp, csa->nt);
-      spx_build_nt(csa->lp, csa->nt);
+      if (ws == NULL)
+      {  csa->nt = &nt;
+         spx_alloc_nt(csa->lp, csa->nt);
+         spx_init_nt(csa->lp, csa->nt);
+         spx_build_nt(csa->lp, csa->nt);
+      }
+      else
+      {  csa->nt = spx_ws_nt(ws);
+         /* the solver keeps matrix N consistent with the basis */
+         ws->nt_ok = 1;
+      }
 #endif
       /* allocate and initialize working components */
       csa->phase = 0;
@@ -1068,6 +1116,8 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       csa->tm_lim = parm->tm_lim;
       csa->out_frq = parm->out_frq;
       csa->out_dly = parm->out_dly;
+      csa->stop_fn = parm->stop_fn;
+      csa->stop_info = parm->stop_info;
       /* initialize working parameters */
       csa->tm_beg = xtime();
       csa->it_beg = csa->it_cnt = P->it_cnt;
@@ -1084,7 +1134,14 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       /* if the solver failed, do not store basis header and basic
        * solution components to problem object */
       if (ret == GLP_EFAIL)
+      {  if (ws != NULL)
+         {  /* working basis no longer corresponds to the original one;
+             * the basis factorization cannot be used anymore */
+            ws->head_ok = 0;
+            P->valid = 0;
+         }
          goto skip;
+      }
       /* convert working LP basis to original LP basis and store it to
        * problem object */
       daeh = talloc(1+csa->lp->n, int);
@@ -1094,7 +1151,7 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
       spx_eval_pi(csa->lp, csa->work);
       /* convert working LP solution to original LP solution and store
        * it to problem object */
-      spx_store_sol(csa->lp, P, SHIFT, map, daeh, csa->beta, csa->work,
+      spx_store_sol(csa->lp, P, shift, map, daeh, csa->beta, csa->work,
          csa->d);
       tfree(daeh);
       /* save simplex iteration count */
@@ -1117,13 +1174,15 @@ int spx_primal(glp_prob *P, const glp_smcp *parm)
          xassert(P->some != 0);
       }
 skip: /* deallocate working objects and arrays */
-      spx_free_lp(csa->lp);
-      tfree(map);
+      if (ws == NULL)
+      {  spx_free_lp(csa->lp);
+         tfree(map);
+         if (csa->at != NULL)
+            spx_free_at(csa->lp, csa->at);
+         if (csa->nt != NULL)
+            spx_free_nt(csa->lp, csa->nt);
+      }
       tfree(csa->c);
-      if (csa->at != NULL)
-         spx_free_at(csa->lp, csa->at);
-      if (csa->nt != NULL)
-         spx_free_nt(csa->lp, csa->nt);
       tfree(csa->beta);
       tfree(csa->d);
       if (csa->se != NULL)
@@ -0,0 +1,319 @@
+/* spxws.c */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2015 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#include "glpenv.h"
+#include "spxprob.h"
+#include "spxws.h"
+
+/***********************************************************************
+*  spx_init_ws - initialize persistent simplex workspace
+*
+*  This routine initializes the workspace as empty. The working LP is
+*  built on the first call to the routine spx_load_ws. */
+
+void spx_init_ws(SPXWS *ws)
+{     memset(ws, 0, sizeof(SPXWS));
+      return;
+}
+
+/***********************************************************************
+*  spx_free_ws - deallocate persistent simplex workspace
+*
+*  This routine frees all the memory allocated to the workspace and
+*  returns it to the initial (empty) state. */
+
+void spx_free_ws(SPXWS *ws)
+{     int rebuilds = ws->rebuilds;
+      if (ws->m != 0)
+      {  spx_free_at(&ws->lp, &ws->at);
+         spx_free_nt(&ws->lp, &ws->nt);
+         spx_free_lp(&ws->lp);
+         tfree(ws->map);
+      }
+      spx_init_ws(ws);
+      ws->rebuilds = rebuilds;
+      return;
+}
+
+/***********************************************************************
+*  refresh_lp - refresh objective and bounds of working LP
+*
+*  This routine copies scaled objective coefficients and bounds of all
+*  variables from the original LP to the working LP, which is assumed
+*  to have the same constraint matrix. It takes O(m+n) time. */
+
+static void refresh_lp(SPXWS *ws, glp_prob *P)
+{     SPXLP *lp = &ws->lp;
+      int m = lp->m;
+      double *c = lp->c;
+      double *l = lp->l;
+      double *u = lp->u;
+      int k, type;
+      double dir, lb, ub;
+      xassert(P->dir == GLP_MIN || P->dir == GLP_MAX);
+      dir = (P->dir == GLP_MIN ? +1.0 : -1.0);
+      c[0] = dir * P->c0;
+      memset(&lp->b[1], 0, m * sizeof(double));
+      for (k = 1; k <= m+P->n; k++)
+      {  if (k <= m)
+         {  GLPROW *row = P->row[k];
+            c[k] = 0.0;
+            type = row->type;
+            lb = row->lb * row->rii, ub = row->ub * row->rii;
+         }
+         else
+         {  GLPCOL *col = P->col[k-m];
+            c[k] = dir * col->coef * col->sjj;
+            type = col->type;
+            lb = col->lb / col->sjj, ub = col->ub / col->sjj;
+         }
+         switch (type)
+         {  case GLP_FR:
+               l[k] = -DBL_MAX, u[k] = +DBL_MAX;
+               break;
+            case GLP_LO:
+               l[k] = lb, u[k] = +DBL_MAX;
+               break;
+            case GLP_UP:
+               l[k] = -DBL_MAX, u[k] = ub;
+               break;
+            case GLP_DB:
+               l[k] = lb, u[k] = ub;
+               xassert(l[k] != u[k]);
+               break;
+            case GLP_FX:
+               l[k] = u[k] = lb;
+               break;
+            default:
+               xassert(type != type);
+         }
+      }
+      return;
+}
+
+/***********************************************************************
+*  build_lp - build working LP from scratch
+*
+*  This routine (re)allocates and builds the working LP for the current
+*  constraint matrix of the original LP. */
+
+static void build_lp(SPXWS *ws, glp_prob *P)
+{     spx_free_ws(ws);
+      ws->m = P->m;
+      ws->n = P->n;
+      ws->nnz = P->nnz;
+      ws->rev = P->rev;
+      spx_init_lp(&ws->lp, P, 0);
+      spx_alloc_lp(&ws->lp);
+      ws->map = talloc(1+P->m+P->n, int);
+      spx_build_lp(&ws->lp, P, 0, 0, ws->map);
+      /* row-wise matrices are allocated once, but built on demand */
+      spx_alloc_at(&ws->lp, &ws->at);
+      ws->at_ok = 0;
+      spx_alloc_nt(&ws->lp, &ws->nt);
+      spx_init_nt(&ws->lp, &ws->nt);
+      ws->nt_ok = 0;
+      ws->head_ok = 0;
+      ws->rebuilds++;
+      return;
+}
+
+/***********************************************************************
+*  spx_load_ws - synchronize workspace with original LP
+*
+*  This routine makes the working LP kept in the workspace correspond
+*  to the original LP and moves the basis factorization driver from the
+*  original LP object to the working LP object (as the routine
+*  spx_build_basis does).
+*
+*  If the constraint matrix of the original LP has not been changed
+*  since the working LP was built, only objective coefficients and
+*  bounds are refreshed. Besides, if the basis of the original LP is
+*  the one the solver left in the workspace, the basis header (and
+*  therefore the matrix N) is kept as is, and only flags of non-basic
+*  variables are updated from their current statuses.
+*
+*  The basis factorization of the original LP should be valid. */
+
+void spx_load_ws(SPXWS *ws, glp_prob *P)
+{     SPXLP *lp;
+      int m, n, i, j, k, stat;
+      xassert(P->valid);
+      if (!(ws->m == P->m && ws->n == P->n && ws->nnz == P->nnz &&
+            ws->rev == P->rev))
+         build_lp(ws, P);
+      else
+         refresh_lp(ws, P);
+      lp = &ws->lp;
+      m = lp->m, n = lp->n;
+      xassert(n == P->m + P->n);
+      /* check if the basis is the one left by the solver */
+      if (ws->head_ok)
+      {  for (i = 1; i <= m; i++)
+         {  if (lp->head[i] != P->head[i])
+            {  ws->head_ok = 0;
+               break;
+            }
+         }
+      }
+      if (!ws->head_ok)
+      {  /* build basis header from scratch */
+         spx_build_basis(lp, P, ws->map);
+         ws->head_ok = 1;
+         ws->nt_ok = 0;
+         return;
+      }
+      /* the basic set is the same, so only flags of non-basic variables
+       * need to be updated, since bounds might have changed */
+      for (j = 1; j <= n-m; j++)
+      {  k = lp->head[m+j];
+         if (k <= m)
+            stat = P->row[k]->stat;
+         else
+            stat = P->col[k-m]->stat;
+         xassert(stat != GLP_BS);
+         lp->flag[j] = (char)(stat == GLP_NU);
+      }
+      /* acquire basis factorization */
+      lp->valid = 1;
+      lp->bfd = P->bfd;
+      P->valid = 0;
+      P->bfd = NULL;
+      return;
+}
+
+/***********************************************************************
+*  spx_ws_at - obtain constraint matrix in row-wise format
+*
+*  This routine returns a pointer to the row-wise representation of the
+*  constraint matrix, building it if it has not been built yet. */
+
+SPXAT *spx_ws_at(SPXWS *ws)
+{     xassert(ws->m != 0);
+      if (!ws->at_ok)
+      {  spx_build_at(&ws->lp, &ws->at);
+         ws->at_ok = 1;
+      }
+      return &ws->at;
+}
+
+/***********************************************************************
+*  spx_ws_nt - obtain matrix N in row-wise format for current basis
+*
+*  This routine returns a pointer to the row-wise representation of the
+*  matrix N for the current basis, rebuilding it if the basis header has
+*  been changed since the matrix was built last time.
+*
+*  The caller should reset the flag ws->nt_ok if it changes the basis
+*  header without updating the matrix N. */
+
+SPXNT *spx_ws_nt(SPXWS *ws)
+{     xassert(ws->m != 0);
+      if (!ws->nt_ok)
+      {  spx_build_nt(&ws->lp, &ws->nt);
+         ws->nt_ok = 1;
+      }
+      return &ws->nt;
+}
+
+/***********************************************************************
+*  spx_ws_meth - choose simplex method to re-optimize from current basis
+*
+*  This routine computes values of basic variables and reduced costs of
+*  non-basic variables for the current basis of the working LP, which
+*  should be valid, and checks which kind of feasibility has survived
+*  changes made to the original LP since the last re-optimization.
+*
+*  The routine returns one of the following codes:
+*
+*  GLP_PRIMAL  the basis is primal feasible (changes in the objective
+*              only), so the primal simplex should be used;
+*
+*  GLP_DUAL    the basis is dual feasible, but not primal feasible
+*              (changes in bounds only), so the dual simplex should be
+*              used;
+*
+*  0           the basis is neither primal nor dual feasible. */
+
+int spx_ws_meth(SPXWS *ws, double tol_bnd, double tol_dj)
+{     SPXLP *lp = &ws->lp;
+      int m = lp->m;
+      int n = lp->n;
+      int *head = lp->head;
+      char *flag = lp->flag;
+      double *l = lp->l;
+      double *u = lp->u;
+      int i, j, k, p_feas, d_feas;
+      double *beta, *pi, dj, eps;
+      xassert(lp->valid);
+      beta = talloc(1+m, double);
+      pi = talloc(1+m, double);
+      /* check primal feasibility */
+      spx_eval_beta(lp, beta);
+      p_feas = 1;
+      for (i = 1; i <= m && p_feas; i++)
+      {  k = head[i]; /* x[k] = xB[i] */
+         if (l[k] != -DBL_MAX)
+         {  eps = tol_bnd * (1.0 + fabs(l[k]));
+            if (beta[i] < l[k] - eps)
+               p_feas = 0;
+         }
+         if (u[k] != +DBL_MAX)
+         {  eps = tol_bnd * (1.0 + fabs(u[k]));
+            if (beta[i] > u[k] + eps)
+               p_feas = 0;
+         }
+      }
+      /* check dual feasibility */
+      spx_eval_pi(lp, pi);
+      d_feas = 1;
+      for (j = 1; j <= n-m && d_feas; j++)
+      {  k = head[m+j]; /* x[k] = xN[j] */
+         if (l[k] == u[k])
+         {  /* xN[j] is fixed variable; skip it */
+            continue;
+         }
+         dj = spx_eval_dj(lp, pi, j);
+         eps = tol_dj * (1.0 + fabs(lp->c[k]));
+         if (l[k] == -DBL_MAX && u[k] == +DBL_MAX)
+         {  /* xN[j] is free variable */
+            if (fabs(dj) > eps)
+               d_feas = 0;
+         }
+         else if (!flag[j])
+         {  /* xN[j] is on its lower bound */
+            if (dj < -eps)
+               d_feas = 0;
+         }
+         else
+         {  /* xN[j] is on its upper bound */
+            if (dj > +eps)
+               d_feas = 0;
+         }
+      }
+      tfree(beta);
+      tfree(pi);
+      return p_feas ? GLP_PRIMAL : d_feas ? GLP_DUAL : 0;
+}
+
+/* eof */
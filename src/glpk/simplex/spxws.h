@@ -0,0 +1,88 @@
+/* spxws.h */
+
+/***********************************************************************
+*  This code is part of GLPK (GNU Linear Programming Kit).
+*
+*  Copyright (C) 2015 Andrew Makhorin, Department for Applied
+*  Informatics, Moscow Aviation Institute, Moscow, Russia. All rights
+*  reserved. E-mail: <mao@gnu.org>.
+*
+*  GLPK is free software: you can redistribute it and/or modify it
+*  under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  GLPK is distributed in the hope that it will be useful, but WITHOUT
+*  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+*  or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public
+*  License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with GLPK. If not, see <http://www.gnu.org/licenses/>.
+***********************************************************************/
+
+#ifndef SPXWS_H
+#define SPXWS_H
+
+#include "prob.h"
+#include "spxat.h"
+#include "spxnt.h"
+
+typedef struct SPXWS SPXWS;
+
+struct SPXWS
+{     /* persistent simplex workspace; it keeps the working LP, the
+       * row-wise constraint matrix and the basis header alive between
+       * consecutive re-optimizations of the same problem object, so
+       * only objective coefficients, bounds and flags of non-basic
+       * variables need to be refreshed when the constraint matrix has
+       * not been changed */
+      int m, n, nnz, rev;
+      /* dimensions and matrix revision of the original LP the working
+       * LP was built for; m = 0 means the working LP does not exist */
+      SPXLP lp;
+      /* working LP; it is built with no variables excluded and with no
+       * bounds shifted, so k-th original variable is x[k] */
+      int *map; /* int map[1+m+n]; */
+      /* identity mapping as provided by the routine spx_build_lp */
+      int head_ok;
+      /* if this flag is set, the basis header lp.head is the one the
+       * solver left on its last run */
+      SPXAT at;
+      int at_ok;
+      /* constraint matrix in row-wise format (used by dual simplex) */
+      SPXNT nt;
+      int nt_ok;
+      /* matrix N in row-wise format for the basis lp.head (used by
+       * primal simplex) */
+      int rebuilds;
+      /* number of times the working LP has been (re)built */
+};
+
+#define spx_init_ws _glp_spx_init_ws
+void spx_init_ws(SPXWS *ws);
+/* initialize persistent simplex workspace */
+
+#define spx_load_ws _glp_spx_load_ws
+void spx_load_ws(SPXWS *ws, glp_prob *P);
+/* synchronize workspace with original LP and acquire its basis */
+
+#define spx_ws_at _glp_spx_ws_at
+SPXAT *spx_ws_at(SPXWS *ws);
+/* obtain constraint matrix in row-wise format */
+
+#define spx_ws_nt _glp_spx_ws_nt
+SPXNT *spx_ws_nt(SPXWS *ws);
+/* obtain matrix N in row-wise format for current basis */
+
+#define spx_ws_meth _glp_spx_ws_meth
+int spx_ws_meth(SPXWS *ws, double tol_bnd, double tol_dj);
+/* choose simplex method to re-optimize from current basis */
+
+#define spx_free_ws _glp_spx_free_ws
+void spx_free_ws(SPXWS *ws);
+/* deallocate persistent simplex workspace */
+
+#endif
+
+/* eof */
@@ -10,12 +10,94 @@
 
 #include "nodeglpk.hpp"
 #include "problem.hpp"
+#include "mathprogmodel.hpp"
 
 
 namespace NodeGLPK {
     
     using namespace v8;
 
+    /**
+     * MathprogOutput collects what the display and printf statements of a model write to the terminal and the
+     * records written to "JS" output tables. The GLPK hooks get it as their info pointer; they may run on a
+     * worker thread while the main thread takes the collected data, so it is guarded by a lock.
+     */
+    class MathprogOutput {
+     public:
+        enum Mode { TERMINAL, EVENT, BUFFER };
+
+        /// A batch of records of an output table; str[k] is empty if all values of field k are numeric,
+        /// otherwise str[k][r] is the value of row r if isstr[k][r] is set and num[k][r] is used if not.
+        struct Batch {
+            std::string table;
+            std::vector<std::string> fields;
+            int rows;
+            std::vector<std::vector<double>> num;
+            std::vector<std::vector<std::string>> str;
+            std::vector<std::vector<char>> isstr;
+        };
+
+        MathprogOutput() : mode(TERMINAL) {}
+
+        // emits an event the way the terminal hook emits 'log', with the environment of the calling thread
+        static void Emit(const char *event, const char *s) {
+            HookInfo *hook = static_cast<HookInfo*>(glp_term_info());
+            if (!hook) return;
+            if (hook->emitter) {
+                hook->emitter->emit(event, s);
+            } else if (hook->fn && hook->sender) {
+                hook->fn(static_cast<const void*>(hook->sender), event, s);
+            }
+        }
+
+        static void OutHook(void *info, const char *s) {
+            MathprogOutput *out = static_cast<MathprogOutput*>(info);
+            if (out->mode == EVENT) {
+                Emit("output", s);
+            } else {
+                std::lock_guard<std::mutex> lock(out->lock);
+                out->text += s;
+            }
+        }
+
+        // arrays passed by the table driver are 1-based, str[k][r] is NULL for numeric values
+        static int TabHook(void *info, const char *table, int nf, const char *name[], int nr, const double *num[],
+                           const char **str[]) {
+            MathprogOutput *out = static_cast<MathprogOutput*>(info);
+            Batch batch;
+            batch.table = table;
+            batch.rows = nr;
+            batch.fields.resize(nf);
+            batch.num.resize(nf);
+            batch.str.resize(nf);
+            batch.isstr.resize(nf);
+            for (int k = 0; k < nf; k++) {
+                batch.fields[k] = name[k+1];
+                batch.num[k].assign(num[k+1] + 1, num[k+1] + 1 + nr);
+                for (int r = 0; r < nr; r++) {
+                    if (!str[k+1][r+1]) continue;
+                    if (batch.str[k].empty()) {
+                        batch.str[k].resize(nr);
+                        batch.isstr[k].assign(nr, 0);
+                    }
+                    batch.str[k][r] = str[k+1][r+1];
+                    batch.isstr[k][r] = 1;
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(out->lock);
+                out->batches.push_back(std::move(batch));
+            }
+            Emit("table", table);
+            return 0;
+        }
+
+        std::atomic<Mode> mode;
+        std::mutex lock;
+        std::string text;
+        std::vector<Batch> batches;
+    };
+
     class Mathprog : public node::ObjectWrap {
     public:
         static void Init(Handle<Object> exports){
@@ -30,16 +112,26 @@ namespace NodeGLPK {
             Nan::SetPrototypeMethod(tpl, "readModel", ReadModel);
             Nan::SetPrototypeMethod(tpl, "readDataSync", ReadDataSync);
             Nan::SetPrototypeMethod(tpl, "readData", ReadData);
+            Nan::SetPrototypeMethod(tpl, "putSetDataSync", PutSetDataSync);
+            Nan::SetPrototypeMethod(tpl, "putParDataSync", PutParDataSync);
+            Nan::SetPrototypeMethod(tpl, "updateParDataSync", UpdateParDataSync);
+            Nan::SetPrototypeMethod(tpl, "setThreads", SetThreads);
+            Nan::SetPrototypeMethod(tpl, "getParCount", GetParCount);
             Nan::SetPrototypeMethod(tpl, "generateSync", GenerateSync);
             Nan::SetPrototypeMethod(tpl, "generate", Generate);
             Nan::SetPrototypeMethod(tpl, "delete", Delete);
             Nan::SetPrototypeMethod(tpl, "buildProbSync", BuildProbSync);
             Nan::SetPrototypeMethod(tpl, "buildProb", BuildProb);
+            Nan::SetPrototypeMethod(tpl, "updateSync", UpdateSync);
+            Nan::SetPrototypeMethod(tpl, "update", Update);
             Nan::SetPrototypeMethod(tpl, "postsolveSync", PostsolveSync);
             Nan::SetPrototypeMethod(tpl, "postsolve", Postsolve);
             Nan::SetPrototypeMethod(tpl, "getLine", getLine);
             Nan::SetPrototypeMethod(tpl, "getLastError", getLastError);
             Nan::SetPrototypeMethod(tpl, "memStats", MemStats);
+            Nan::SetPrototypeMethod(tpl, "setOutput", SetOutput);
+            Nan::SetPrototypeMethod(tpl, "takeOutput", TakeOutput);
+            Nan::SetPrototypeMethod(tpl, "takeTables", TakeTables);
             
             constructor.Reset(tpl);
             exports->Set(Nan::New<String>("Mathprog").ToLocalChecked(), tpl->GetFunction());
@@ -50,14 +142,35 @@ namespace NodeGLPK {
              emitter_(std::make_shared<NodeEvent::EventEmitter>()),
              info_{std::make_shared<HookInfo>(emitter_)}, 
              env_state_(make_shared_environ_state(info_)),
+             output_(std::make_shared<MathprogOutput>()),
              counters_{0,0,0,0}
              {
            GLPKEnvStateGuard mguard{env_state_, info_};
            handle = glp_mpl_alloc_wksp();
+           glp_mpl_tab_hook(handle, MathprogOutput::TabHook, output_.get());
+           thread = false;
+        };
+        // an instance of a compiled model, whose workspace already holds the translated model section
+        explicit Mathprog(std::shared_ptr<MathprogModelPool> pool)
+           : node::ObjectWrap(),
+             pool_(pool),
+             output_(std::make_shared<MathprogOutput>()),
+             counters_{0,0,0,0}
+             {
+           MathprogWorkspace ws = pool_->acquire();
+           emitter_ = ws.emitter;
+           info_ = ws.info;
+           env_state_ = ws.env_state;
+           handle = ws.handle;
+           glp_mpl_tab_hook(handle, MathprogOutput::TabHook, output_.get());
            thread = false;
         };
         ~Mathprog(){
-            if(handle) {
+            if(handle && pool_) {
+                UnhookOutput(handle);
+                pool_->release(MathprogWorkspace{emitter_, info_, env_state_, handle});
+                handle = NULL;
+            } else if(handle) {
                 GLPKEnvStateGuard mguard{env_state_, info_};
                 glp_mpl_free_wksp(handle);
                 handle = NULL;
@@ -67,9 +180,16 @@ namespace NodeGLPK {
         
         static NAN_METHOD(New){
             V8CHECK(!info.IsConstructCall(), "Constructor Mathprog requires 'new'");
+            V8CHECK(info.Length() > 1, "Wrong number of arguments");
+            std::shared_ptr<MathprogModelPool> pool;
+            if (info.Length() == 1) {
+                V8CHECK(!info[0]->IsObject(), "Wrong arguments");
+                pool = MathprogModel::PoolOf(info[0]);
+                V8CHECK(!pool, "model not compiled");
+            }
             
             GLP_CATCH_RET(
-                Mathprog* obj = new Mathprog();
+                Mathprog* obj = pool ? new Mathprog(pool) : new Mathprog();
                 obj->Wrap(info.This());
                       info.GetReturnValue().Set(info.This());
             );
@@ -104,6 +224,20 @@ namespace NodeGLPK {
             ret->Set(Nan::New<v8::String>("total").ToLocalChecked(), Nan::New<v8::Number>(counters.mem_total));
             ret->Set(Nan::New<v8::String>("tpeak").ToLocalChecked(), Nan::New<v8::Number>(counters.mem_tpeak));
 
+            // the translator memory pools: atoms in use and bytes allocated to each of them
+            if (mp->handle && !mp->thread.load()) {
+                Local<v8::Object> pools = Nan::New<v8::Object>();
+                size_t count, total;
+                const char *name;
+                for (int k = 1; (name = glp_mpl_pool_stats(mp->handle, k, &count, &total)) != NULL; k++) {
+                    Local<v8::Object> pool = Nan::New<v8::Object>();
+                    pool->Set(Nan::New<v8::String>("count").ToLocalChecked(), Nan::New<v8::Number>(count));
+                    pool->Set(Nan::New<v8::String>("total").ToLocalChecked(), Nan::New<v8::Number>(total));
+                    pools->Set(Nan::New<v8::String>(name).ToLocalChecked(), pool);
+                }
+                ret->Set(Nan::New<v8::String>("pools").ToLocalChecked(), pools);
+            }
+
             info.GetReturnValue().Set(ret);
         }
         
@@ -195,7 +329,234 @@ namespace NodeGLPK {
         }
         
         GLP_BIND_VALUE_STR(Mathprog, ReadDataSync, glp_mpl_read_data);
+
+        /// Components of n-tuples or values passed to glp_mpl_put_set_data/glp_mpl_put_par_data. Like the other
+        /// arrays passed to GLPK they are indexed from 1. A Float64Array is used in place, an Array may mix
+        /// numbers and strings; null or undefined stands for no components.
+        class Components {
+        public:
+            Components() : length(0), num(NULL) {}
+
+            bool Parse(Local<Value> value, const char* name) {
+                if (value->IsNull() || value->IsUndefined()) return true;
+                if (value->IsFloat64Array()) {
+                    typed_.reset(new Nan::TypedArrayContents<double>(value));
+                    length = typed_->length();
+                    num = **typed_;
+                    return true;
+                }
+                if (!value->IsArray()) {
+                    Nan::ThrowTypeError((std::string(name) + ": should be a Float64Array or an Array").c_str());
+                    return false;
+                }
+                Local<Array> list = Local<Array>::Cast(value);
+                length = list->Length();
+                nums_.assign(length, 0.0);
+                strs_.resize(length);
+                for (uint32_t k = 1; k < length; k++) {
+                    Local<Value> item = list->Get(k);
+                    if (item->IsNumber()) {
+                        nums_[k] = item->NumberValue();
+                    } else if (item->IsString()) {
+                        // strs_ is never resized from here on, so the pointers stay valid
+                        strs_[k] = V8TOCSTRING(item);
+                        if (str_.empty()) str_.assign(length, NULL);
+                        str_[k] = strs_[k].c_str();
+                    } else {
+                        Nan::ThrowTypeError((std::string(name) + ": items should be numbers or strings").c_str());
+                        return false;
+                    }
+                }
+                num = nums_.data();
+                return true;
+            }
+
+            /// @returns the number of components, not counting the unused location 0
+            size_t count() const { return length > 0 ? length - 1 : 0; }
+            const char** str() { return str_.empty() ? NULL : str_.data(); }
+
+            size_t length;
+            const double* num;
+
+        private:
+            std::unique_ptr<Nan::TypedArrayContents<double>> typed_;
+            std::vector<double> nums_;
+            std::vector<std::string> strs_;
+            std::vector<const char*> str_;
+        };
+
+        static NAN_METHOD(PutSetDataSync) {
+            V8CHECK(info.Length() < 3 || info.Length() > 4, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsString() || !info[1]->IsInt32(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+
+            int dimen = info[1]->Int32Value();
+            V8CHECK(dimen < 1, "dimen: should be positive");
+            Components members, subscript;
+            if (!members.Parse(info[2], "members")) return;
+            if (info.Length() == 4 && !subscript.Parse(info[3], "subscript")) return;
+            V8CHECK(members.count() % dimen != 0, "members: should hold whole n-tuples");
+
+            GLP_CREATE_HOOK_GUARDS(mp);
+            GLP_CATCH_RET(info.GetReturnValue().Set(glp_mpl_put_set_data(mp->handle, V8TOCSTRING(info[0]),
+                static_cast<int>(subscript.count()), subscript.num, subscript.str(), dimen,
+                static_cast<int>(members.count() / dimen), members.num, members.str()));)
+        }
+
+        static NAN_METHOD(PutParDataSync) {
+            V8CHECK(info.Length() != 4, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsString() || !info[1]->IsInt32(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+
+            int dim = info[1]->Int32Value();
+            V8CHECK(dim < 0, "dim: should not be negative");
+            Components subscripts, values;
+            if (!subscripts.Parse(info[2], "subscripts")) return;
+            if (!values.Parse(info[3], "values")) return;
+            V8CHECK(subscripts.count() != values.count() * dim, "subscripts: should hold dim components per value");
+
+            GLP_CREATE_HOOK_GUARDS(mp);
+            GLP_CATCH_RET(info.GetReturnValue().Set(glp_mpl_put_par_data(mp->handle, V8TOCSTRING(info[0]), dim,
+                static_cast<int>(values.count()), subscripts.num, subscripts.str(), values.num, values.str()));)
+        }
         
+        // changes parameter data of a generated model, as putParDataSync does before generating; the changes
+        // take effect on the next update
+        static NAN_METHOD(UpdateParDataSync) {
+            V8CHECK(info.Length() != 4, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsString() || !info[1]->IsInt32(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+
+            int dim = info[1]->Int32Value();
+            V8CHECK(dim < 0, "dim: should not be negative");
+            Components subscripts, values;
+            if (!subscripts.Parse(info[2], "subscripts")) return;
+            if (!values.Parse(info[3], "values")) return;
+            V8CHECK(subscripts.count() != values.count() * dim, "subscripts: should hold dim components per value");
+
+            GLP_CREATE_HOOK_GUARDS(mp);
+            GLP_CATCH_RET(info.GetReturnValue().Set(glp_mpl_update_par_data(mp->handle, V8TOCSTRING(info[0]), dim,
+                static_cast<int>(values.count()), subscripts.num, subscripts.str(), values.num, values.str()));)
+        }
+
+        // constraints of the model are evaluated by the given number of worker threads on generating; rows and
+        // columns are numbered as in the serial generation
+        static NAN_METHOD(SetThreads) {
+            V8CHECK(info.Length() != 1, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsInt32(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+            V8CHECK(info[0]->Int32Value() < 1, "threads: should be positive");
+
+            GLP_CREATE_HOOK_GUARDS(mp);
+            GLP_CATCH_RET(glp_mpl_set_threads(mp->handle, info[0]->Int32Value());)
+        }
+
+        // number of elemental constraints evaluated by the worker threads on the last generating; it is zero if
+        // the model has been generated serially
+        GLP_BIND_VALUE(Mathprog, GetParCount, glp_mpl_get_par_cnt);
+
+        // a pooled workspace outlives the instance, so it must not keep pointing to its output
+        static void UnhookOutput(glp_tran *handle) {
+            glp_mpl_out_hook(handle, NULL, NULL);
+            glp_mpl_tab_hook(handle, NULL, NULL);
+        }
+
+        // the output of display and printf statements goes to the terminal (default), to 'output' events or
+        // to a buffer read with takeOutput
+        static NAN_METHOD(SetOutput) {
+            V8CHECK(info.Length() != 1, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsString(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+
+            std::string mode = V8TOCSTRING(info[0]);
+            V8CHECK(mode != "terminal" && mode != "event" && mode != "buffer",
+                    "output: should be 'terminal', 'event' or 'buffer'");
+
+            if (mode == "terminal") {
+                mp->output_->mode = MathprogOutput::TERMINAL;
+                glp_mpl_out_hook(mp->handle, NULL, NULL);
+            } else {
+                mp->output_->mode = (mode == "event") ? MathprogOutput::EVENT : MathprogOutput::BUFFER;
+                glp_mpl_out_hook(mp->handle, MathprogOutput::OutHook, mp->output_.get());
+            }
+        }
+
+        static NAN_METHOD(TakeOutput) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+
+            std::string text;
+            {
+                std::lock_guard<std::mutex> lock(mp->output_->lock);
+                text.swap(mp->output_->text);
+            }
+            info.GetReturnValue().Set(Nan::CopyBuffer(text.data(), static_cast<uint32_t>(text.size()))
+                .ToLocalChecked());
+        }
+
+        // the batches written to "JS" tables: [{table, fields, rows, columns}], a column of numbers is a
+        // Float64Array, a column holding strings is an Array
+        static NAN_METHOD(TakeTables) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+
+            std::vector<MathprogOutput::Batch> batches;
+            {
+                std::lock_guard<std::mutex> lock(mp->output_->lock);
+                batches.swap(mp->output_->batches);
+            }
+            Local<Array> ret = Nan::New<Array>(static_cast<int>(batches.size()));
+            for (size_t i = 0; i < batches.size(); i++) {
+                const MathprogOutput::Batch& batch = batches[i];
+                int nf = static_cast<int>(batch.fields.size());
+                Local<Array> fields = Nan::New<Array>(nf);
+                Local<Array> columns = Nan::New<Array>(nf);
+                for (int k = 0; k < nf; k++) {
+                    fields->Set(k, Nan::New<String>(batch.fields[k]).ToLocalChecked());
+                    if (batch.str[k].empty()) {
+                        Local<ArrayBuffer> buffer = ArrayBuffer::New(Isolate::GetCurrent(), batch.rows * sizeof(double));
+                        memcpy(buffer->GetContents().Data(), batch.num[k].data(), batch.rows * sizeof(double));
+                        columns->Set(k, Float64Array::New(buffer, 0, batch.rows));
+                    } else {
+                        Local<Array> column = Nan::New<Array>(batch.rows);
+                        for (int r = 0; r < batch.rows; r++) {
+                            if (batch.isstr[k][r])
+                                column->Set(r, Nan::New<String>(batch.str[k][r]).ToLocalChecked());
+                            else
+                                column->Set(r, Nan::New<Number>(batch.num[k][r]));
+                        }
+                        columns->Set(k, column);
+                    }
+                }
+                Local<Object> obj = Nan::New<Object>();
+                obj->Set(Nan::New<String>("table").ToLocalChecked(), Nan::New<String>(batch.table).ToLocalChecked());
+                obj->Set(Nan::New<String>("fields").ToLocalChecked(), fields);
+                obj->Set(Nan::New<String>("rows").ToLocalChecked(), Nan::New<Int32>(batch.rows));
+                obj->Set(Nan::New<String>("columns").ToLocalChecked(), columns);
+                ret->Set(static_cast<uint32_t>(i), obj);
+            }
+            info.GetReturnValue().Set(ret);
+        }
+
         class GenerateWorker : public Nan::AsyncWorker {
         public:
             GenerateWorker(Nan::Callback *callback, Mathprog *mp, char *file)
@@ -264,8 +625,8 @@ namespace NodeGLPK {
         
         class BuildProbWorker : public Nan::AsyncWorker {
         public:
-            BuildProbWorker(Nan::Callback *callback, Mathprog *mp, Problem *lp)
-            : Nan::AsyncWorker(callback), mp(mp), lp(lp){
+            BuildProbWorker(Nan::Callback *callback, Mathprog *mp, Problem *lp, int names, bool release)
+            : Nan::AsyncWorker(callback), mp(mp), lp(lp), names(names), release(release){
                 
             }
             void WorkComplete() {
@@ -275,7 +636,7 @@ namespace NodeGLPK {
             }
             void Execute () {
                 try {
-                    glp_mpl_build_prob(mp->handle, lp->handle);
+                    Build(mp, lp, names, release);
                 } catch (std::string s){
                     SetErrorMessage(s.c_str());
                 }
@@ -283,11 +644,49 @@ namespace NodeGLPK {
         public:
             Mathprog *mp;
             Problem *lp;
+            int names;
+            bool release;
         };
-        
+
+        // builds the problem instance; with release the generated content and data are discarded right
+        // away (as by glp_mpl_reset), which frees the translator memory but rules out postsolve
+        static void Build(Mathprog *mp, Problem *lp, int names, bool release){
+            glp_mpl_build_prob1(mp->handle, lp->handle, names);
+            if (release && glp_mpl_reset(mp->handle))
+                throw std::string("unable to release the model content");
+        }
+
+        // options of buildProb: names (boolean, true by default); without names the problem is loaded
+        // noticeably faster, rows and columns are then only known by their numbers; release (boolean)
+        static bool ParseBuildOptions(Local<Value> value, int &names, bool &release){
+            names = GLP_ON;
+            release = false;
+            if (value->IsUndefined()) return true;
+            V8CHECKBOOL(!value->IsObject(), "Wrong arguments");
+            Local<Object> obj = value->ToObject();
+            Local<Array> props = obj->GetPropertyNames();
+            for(uint32_t i = 0; i < props->Length(); i++){
+                Local<Value> key = props->Get(i);
+                Local<Value> val = obj->Get(key);
+                std::string keystr = std::string(V8TOCSTRING(key));
+                if (keystr == "names"){
+                    V8CHECKBOOL(!val->IsBoolean(), "names: should be boolean");
+                    names = val->BooleanValue() ? GLP_ON : GLP_OFF;
+                } else if (keystr == "release"){
+                    V8CHECKBOOL(!val->IsBoolean(), "release: should be boolean");
+                    release = val->BooleanValue();
+                } else {
+                    std::string error("Unknow field: ");
+                    error += keystr;
+                    V8CHECKBOOL(true, error.c_str());
+                }
+            }
+            return true;
+        }
+
         static NAN_METHOD(BuildProb) {
-            V8CHECK(info.Length() != 2, "Wrong number of arguments");
-            V8CHECK(!info[0]->IsObject() || !info[1]->IsFunction(), "Wrong arguments");
+            V8CHECK((info.Length() < 2) || (info.Length() > 3), "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[info.Length() - 1]->IsFunction(), "Wrong arguments");
             
             Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
             V8CHECK(!mp->handle, "object deleted");
@@ -296,10 +695,13 @@ namespace NodeGLPK {
             Problem* lp = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
             V8CHECK(!lp || !lp->handle, "invalid problem");
             V8CHECK(lp->thread.load(), "an async operation is inprogress");
-            
-            
-            Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
-            BuildProbWorker *worker = new BuildProbWorker(callback, mp, lp);
+
+            int names;
+            bool release;
+            if (!ParseBuildOptions(info.Length() == 3 ? info[1] : Nan::Undefined().As<Value>(), names, release)) return;
+
+            Nan::Callback *callback = new Nan::Callback(info[info.Length() - 1].As<Function>());
+            BuildProbWorker *worker = new BuildProbWorker(callback, mp, lp, names, release);
             mp->thread = true;
             lp->thread = true;
             GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, mp->emitter_, mp->env_state_);
@@ -307,7 +709,7 @@ namespace NodeGLPK {
         }
         
         static NAN_METHOD(BuildProbSync){
-            V8CHECK(info.Length() != 1, "Wrong number of arguments");
+            V8CHECK((info.Length() < 1) || (info.Length() > 2), "Wrong number of arguments");
             V8CHECK(!info[0]->IsObject(), "Wrong arguments");
             
             Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
@@ -316,9 +718,86 @@ namespace NodeGLPK {
             
             Problem* lp = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
             V8CHECK(!lp || !lp->handle, "invalid problem");
-            
-            GLP_CREATE_HOOK_GUARDS(mp); 
-            GLP_CATCH_RET(glp_mpl_build_prob(mp->handle, lp->handle);)
+
+            int names;
+            bool release;
+            if (!ParseBuildOptions(info.Length() == 2 ? info[1] : Nan::Undefined().As<Value>(), names, release)) return;
+
+            GLP_CREATE_HOOK_GUARDS(mp);
+            GLP_CATCH_RET(Build(mp, lp, names, release);)
+        }
+
+        class UpdateWorker : public Nan::AsyncWorker {
+        public:
+            UpdateWorker(Nan::Callback *callback, Mathprog *mp, Problem *lp)
+            : Nan::AsyncWorker(callback), mp(mp), lp(lp), ret(1){
+
+            }
+            void WorkComplete() {
+                mp->thread = false;
+                lp->thread = false;
+                Nan::AsyncWorker::WorkComplete();
+            }
+            void Execute () {
+                try {
+                    ret = UpdateProb(mp, lp);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+            }
+            virtual void HandleOKCallback() {
+                Local<Value> info[] = {Nan::Null(), Nan::New<Int32>(ret)};
+                callback->Call(2, info);
+            }
+        public:
+            Mathprog *mp;
+            Problem *lp;
+            int ret;
+        };
+
+        // regenerates the model objects depending on the changed parameter data and applies the changes to the
+        // problem instance built from the model; only the affected rows and columns are changed, so the basis
+        // of the instance is kept for re-optimization
+        static int UpdateProb(Mathprog *mp, Problem *lp){
+            int ret = glp_mpl_update(mp->handle);
+            if (ret == 0) glp_mpl_update_prob(mp->handle, lp->handle);
+            return ret;
+        }
+
+        static NAN_METHOD(Update) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[1]->IsFunction(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!lp || !lp->handle, "invalid problem");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+            UpdateWorker *worker = new UpdateWorker(callback, mp, lp);
+            mp->thread = true;
+            lp->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, mp->emitter_, mp->env_state_);
+            Nan::AsyncQueueWorker(decorated);
+        }
+
+        static NAN_METHOD(UpdateSync){
+            V8CHECK(info.Length() != 1, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject(), "Wrong arguments");
+
+            Mathprog* mp = ObjectWrap::Unwrap<Mathprog>(info.Holder());
+            V8CHECK(!mp->handle, "object deleted");
+            V8CHECK(mp->thread.load(), "an async operation is inprogress");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!lp || !lp->handle, "invalid problem");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            GLP_CREATE_HOOK_GUARDS(mp);
+            GLP_CATCH_RET(info.GetReturnValue().Set(UpdateProb(mp, lp));)
         }
 
         class PostsolveWorker : public Nan::AsyncWorker {
@@ -414,6 +893,15 @@ namespace NodeGLPK {
             V8CHECK(!obj->handle, "object already deleted");
             V8CHECK(obj->thread, "an async operation is inprogress")
 
+            if (obj->pool_) {
+                // back to the pool of the compiled model, ready for the next instance
+                UnhookOutput(obj->handle);
+                obj->pool_->release(MathprogWorkspace{obj->emitter_, obj->info_, obj->env_state_, obj->handle});
+                obj->pool_ = nullptr;
+                obj->handle = NULL;
+                obj->env_state_ = NULL;
+                return;
+            }
             GLP_CREATE_HOOK_GUARDS(obj); 
             GLP_CATCH_RET(glp_mpl_free_wksp(obj->handle);)
             obj->emitter_->removeAllListeners();
@@ -427,9 +915,11 @@ namespace NodeGLPK {
         std::atomic<bool> thread;
 
     private:
+        std::shared_ptr<MathprogModelPool> pool_;
         std::shared_ptr<NodeEvent::EventEmitter> emitter_;
         std::shared_ptr<HookInfo> info_;
         std::shared_ptr<glp_environ_state_t> env_state_;
+        std::shared_ptr<MathprogOutput> output_;
         struct glp_memory_counters counters_;
     };
     
@@ -0,0 +1,311 @@
+#pragma once
+#ifndef _NODE_GLPK_MATHPROGMODEL_HPP
+#define _NODE_GLPK_MATHPROGMODEL_HPP
+#include <eventemitter.hpp>
+
+#include <node.h>
+#include <node_object_wrap.h>
+#include "glpk/glpk.h"
+#include "common.h"
+
+#include "nodeglpk.hpp"
+
+
+namespace NodeGLPK {
+
+    using namespace v8;
+
+    /// A MathProg translator workspace together with the environment it was allocated in. A workspace must
+    /// always be used with its own environment, so they are pooled together.
+    struct MathprogWorkspace {
+        static MathprogWorkspace create() {
+            MathprogWorkspace ws;
+            ws.emitter = std::make_shared<NodeEvent::EventEmitter>();
+            ws.info = std::make_shared<HookInfo>(ws.emitter);
+            ws.env_state = make_shared_environ_state(ws.info);
+            GLPKEnvStateGuard mguard{ws.env_state, ws.info};
+            ws.handle = glp_mpl_alloc_wksp();
+            return ws;
+        }
+
+        /// Frees the workspace (unless it was already freed in its environment) and its environment.
+        void destroy() {
+            if (handle) {
+                GLPKEnvStateGuard mguard{env_state, info};
+                glp_mpl_free_wksp(handle);
+            }
+            emitter->removeAllListeners();
+            struct glp_memory_counters counters;
+            _global_memory_statistics.removeStateCounters(env_state, counters);
+            handle = NULL;
+            env_state = NULL;
+        }
+
+        std::shared_ptr<NodeEvent::EventEmitter> emitter;
+        std::shared_ptr<HookInfo> info;
+        std::shared_ptr<glp_environ_state_t> env_state;
+        glp_tran *handle;
+    };
+
+    /**
+     * MathprogModelPool keeps the idle workspaces of a compiled model. Every idle workspace holds the translated
+     * model section and no data, so an instance of the model is created without parsing the model again.
+     * The pool is shared by the MathprogModel object and the Mathprog instances taken from it; it is only used
+     * on the main thread, the workspaces themselves may be used on any thread.
+     */
+    class MathprogModelPool {
+     public:
+        explicit MathprogModelPool(const std::string& file) : file_(file), closed_(false) {}
+        ~MathprogModelPool() { close(); }
+
+        /// Takes an idle workspace, or translates the model section into a new one if the pool is empty.
+        /// Throws the error message (as std::string, like the GLPK error hook) if the translation fails.
+        MathprogWorkspace acquire() {
+            if (closed_) throw std::string("model deleted");
+            if (!idle_.empty()) {
+                MathprogWorkspace ws = idle_.back();
+                idle_.pop_back();
+                return ws;
+            }
+            MathprogWorkspace ws = MathprogWorkspace::create();
+            int ret;
+            std::string msg;
+            {
+                GLPKEnvStateGuard mguard{ws.env_state, ws.info};
+                ret = glp_mpl_read_model(ws.handle, file_.c_str(), GLP_ON);
+                if (ret && glp_mpl_getlasterror(ws.handle)) msg = glp_mpl_getlasterror(ws.handle);
+            }
+            if (ret) {
+                ws.destroy();
+                throw msg.empty() ? std::string("unable to read model") : msg;
+            }
+            return ws;
+        }
+
+        /// Adds a workspace holding a freshly translated model section.
+        void add(MathprogWorkspace ws) {
+            if (closed_)
+                ws.destroy();
+            else
+                idle_.push_back(ws);
+        }
+
+        /// Returns a workspace to the pool, discarding its data and generated content. The workspace is freed
+        /// instead if it cannot be reset (e.g. its processing failed) or the pool has been closed.
+        void release(MathprogWorkspace ws) {
+            ws.emitter->removeAllListeners();
+            int ret = 1;
+            if (!closed_) {
+                GLPKEnvStateGuard mguard{ws.env_state, ws.info};
+                try {
+                    ret = glp_mpl_reset(ws.handle);
+                } catch (std::string) {
+                    ret = 1;
+                }
+            }
+            if (ret)
+                ws.destroy();
+            else
+                idle_.push_back(ws);
+        }
+
+        /// Frees all idle workspaces; workspaces released afterwards are freed as well.
+        void close() {
+            closed_ = true;
+            for (auto& ws : idle_) ws.destroy();
+            idle_.clear();
+        }
+
+        size_t idle() const { return idle_.size(); }
+
+     private:
+        std::string file_;
+        bool closed_;
+        std::vector<MathprogWorkspace> idle_;
+    };
+
+    /**
+     * MathprogModel translates a model section once and hands out pooled workspaces to `new Mathprog(model)`,
+     * each of which only reads its own data and generates its own instance. Instances are independent and may
+     * be generated concurrently; deleting one returns its workspace to the pool.
+     */
+    class MathprogModel : public node::ObjectWrap {
+    public:
+        static void Init(Handle<Object> exports){
+            // Prepare constructor template
+            Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(New);
+            tpl->SetClassName(Nan::New<String>("MathprogModel").ToLocalChecked());
+            tpl->InstanceTemplate()->SetInternalFieldCount(1);
+
+            // prototypes
+            Nan::SetPrototypeMethod(tpl, "compileSync", CompileSync);
+            Nan::SetPrototypeMethod(tpl, "compile", Compile);
+            Nan::SetPrototypeMethod(tpl, "idle", Idle);
+            Nan::SetPrototypeMethod(tpl, "getLastError", getLastError);
+            Nan::SetPrototypeMethod(tpl, "delete", Delete);
+
+            constructor.Reset(tpl);
+            exports->Set(Nan::New<String>("MathprogModel").ToLocalChecked(), tpl->GetFunction());
+        }
+
+        /// @returns the pool of a compiled model, or nullptr if the object is not a compiled model
+        static std::shared_ptr<MathprogModelPool> PoolOf(Local<Value> value) {
+            if (!value->IsObject() || !Nan::New(constructor)->HasInstance(value)) return nullptr;
+            MathprogModel* model = ObjectWrap::Unwrap<MathprogModel>(value->ToObject());
+            return model->pool_;
+        }
+
+    private:
+        explicit MathprogModel() : node::ObjectWrap(), deleted(false) {
+            thread = false;
+        };
+        ~MathprogModel(){
+            if (pool_) pool_->close();
+        };
+
+        static NAN_METHOD(New){
+            V8CHECK(!info.IsConstructCall(), "Constructor MathprogModel requires 'new'");
+
+            GLP_CATCH_RET(
+                MathprogModel* obj = new MathprogModel();
+                obj->Wrap(info.This());
+                      info.GetReturnValue().Set(info.This());
+            );
+        }
+
+        // the workspace holding the translated model section becomes the first one of the pool; on failure
+        // it is freed
+        static int Finish(MathprogModel* model, MathprogWorkspace& ws, int ret) {
+            if (ret == 0) {
+                model->pool_ = std::make_shared<MathprogModelPool>(model->file_);
+                model->pool_->add(ws);
+            } else {
+                ws.destroy();
+            }
+            return ret;
+        }
+
+        // translates the model section, keeping the error message for getLastError
+        static int Translate(MathprogModel* model, MathprogWorkspace& ws) {
+            int ret = glp_mpl_read_model(ws.handle, model->file_.c_str(), GLP_ON);
+            model->error_.clear();
+            if (ret && glp_mpl_getlasterror(ws.handle)) model->error_ = glp_mpl_getlasterror(ws.handle);
+            return ret;
+        }
+
+        class CompileWorker : public Nan::AsyncWorker {
+        public:
+            CompileWorker(Nan::Callback *callback, MathprogModel *model, MathprogWorkspace ws)
+            : Nan::AsyncWorker(callback), model(model), ws(ws), ret(1){
+
+            }
+            void WorkComplete() {
+                model->thread = false;
+                Finish(model, ws, ret);
+                Nan::AsyncWorker::WorkComplete();
+            }
+            void Execute () {
+                try {
+                    ret = Translate(model, ws);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+                // a failed workspace is freed here, while its environment is in place
+                if (ret) {
+                    glp_mpl_free_wksp(ws.handle);
+                    ws.handle = NULL;
+                }
+            }
+            virtual void HandleOKCallback() {
+                Local<Value> info[] = {Nan::Null(), Nan::New<Int32>(ret)};
+                callback->Call(2, info);
+            }
+        public:
+            MathprogModel *model;
+            MathprogWorkspace ws;
+            int ret;
+        };
+
+        static NAN_METHOD(Compile) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsString() || !info[1]->IsFunction(), "Wrong arguments");
+
+            MathprogModel* model = ObjectWrap::Unwrap<MathprogModel>(info.Holder());
+            V8CHECK(model->deleted, "object deleted");
+            V8CHECK(model->thread.load(), "an async operation is inprogress");
+            V8CHECK(model->pool_, "model already compiled");
+
+            model->file_ = V8TOCSTRING(info[0]);
+            MathprogWorkspace ws = MathprogWorkspace::create();
+            Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+            CompileWorker *worker = new CompileWorker(callback, model, ws);
+            model->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, ws.emitter, ws.env_state);
+            Nan::AsyncQueueWorker(decorated);
+        }
+
+        static NAN_METHOD(CompileSync) {
+            V8CHECK(info.Length() != 1, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsString(), "Wrong arguments");
+
+            MathprogModel* model = ObjectWrap::Unwrap<MathprogModel>(info.Holder());
+            V8CHECK(model->deleted, "object deleted");
+            V8CHECK(model->thread.load(), "an async operation is inprogress");
+            V8CHECK(model->pool_, "model already compiled");
+
+            model->file_ = V8TOCSTRING(info[0]);
+            MathprogWorkspace ws = MathprogWorkspace::create();
+            int ret = 1;
+            {
+                GLPKEnvStateGuard mguard{ws.env_state, ws.info};
+                GLP_CATCH(ret = Translate(model, ws);)
+            }
+            info.GetReturnValue().Set(Finish(model, ws, ret));
+        }
+
+        static NAN_METHOD(Idle) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+            MathprogModel* model = ObjectWrap::Unwrap<MathprogModel>(info.Holder());
+            V8CHECK(model->deleted, "object deleted");
+
+            info.GetReturnValue().Set(Nan::New<Number>(static_cast<double>(model->pool_ ? model->pool_->idle() : 0)));
+        }
+
+        static NAN_METHOD(getLastError){
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+            MathprogModel* model = ObjectWrap::Unwrap<MathprogModel>(info.Holder());
+            V8CHECK(model->deleted, "object deleted");
+            V8CHECK(model->thread.load(), "an async operation is inprogress");
+
+            if (!model->error_.empty())
+                info.GetReturnValue().Set(Nan::New<String>(model->error_).ToLocalChecked());
+            else
+                info.GetReturnValue().Set(Nan::Null());
+        }
+
+        static NAN_METHOD(Delete) {
+            MathprogModel* obj = ObjectWrap::Unwrap<MathprogModel>(info.Holder());
+            V8CHECK(obj->deleted, "object already deleted");
+            V8CHECK(obj->thread, "an async operation is inprogress")
+
+            // instances still in use keep the pool alive; their workspaces are freed when they are deleted
+            if (obj->pool_) obj->pool_->close();
+            obj->pool_ = nullptr;
+            obj->deleted = true;
+        }
+
+        static Nan::Persistent<FunctionTemplate> constructor;
+        bool deleted;
+        std::atomic<bool> thread;
+
+    private:
+        std::string file_;
+        std::string error_;
+        std::shared_ptr<MathprogModelPool> pool_;
+    };
+
+    Nan::Persistent<FunctionTemplate> MathprogModel::constructor;
+}
+#endif
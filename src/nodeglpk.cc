@@ -6,6 +6,7 @@
 #include "tree.hpp"
 #include "problem.hpp"
 #include "mathprog.hpp"
+#include "presolver.hpp"
 #include "common.h"
 
 #include "glpk/glpk.h"
@@ -20,6 +21,7 @@ NodeEvent::uv_rwlock TermHookManager::lock_;
 
 std::atomic<bool> term_output{false};
 MemoryStatistics _global_memory_statistics{};
+BasisCache _global_basis_cache{};
 
 int stdoutTermHook(void*, const char *s) {
     if(term_output.load()) {
@@ -56,6 +58,52 @@ extern "C" {
         NodeGLPK::term_output = info[0]->BooleanValue();
     }
 
+    NAN_METHOD(SetBasisCache) {
+        V8CHECK(info.Length() != 1, "Wrong number of arguments");
+        V8CHECK(!info[0]->IsObject(), "Wrong arguments");
+
+        size_t max_entries = 0, max_bytes = 0;
+        Local<Object> obj = info[0]->ToObject();
+        Local<Array> props = obj->GetPropertyNames();
+        for(uint32_t i = 0; i < props->Length(); i++){
+            Local<Value> key = props->Get(i);
+            Local<Value> val = obj->Get(key);
+            std::string keystr = std::string(V8TOCSTRING(key));
+            if (keystr == "maxEntries"){
+                V8CHECK(!val->IsUint32(), "maxEntries: should be uint32");
+                max_entries = val->Uint32Value();
+            } else if (keystr == "maxBytes"){
+                V8CHECK(!val->IsNumber() || val->NumberValue() < 0, "maxBytes: should be a positive Number");
+                max_bytes = static_cast<size_t>(val->NumberValue());
+            } else {
+                std::string error("Unknow field: ");
+                error += keystr;
+                V8CHECK(true, error.c_str());
+            }
+        }
+        _global_basis_cache.configure(max_entries, max_bytes);
+    }
+
+    NAN_METHOD(BasisCacheStats) {
+        V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+        BasisCache::Stats stats = _global_basis_cache.stats();
+        Local<v8::Object> ret = Nan::New<v8::Object>();
+        ret->Set(Nan::New<v8::String>("hits").ToLocalChecked(), Nan::New<v8::Number>(stats.hits));
+        ret->Set(Nan::New<v8::String>("misses").ToLocalChecked(), Nan::New<v8::Number>(stats.misses));
+        ret->Set(Nan::New<v8::String>("evictions").ToLocalChecked(), Nan::New<v8::Number>(stats.evictions));
+        ret->Set(Nan::New<v8::String>("entries").ToLocalChecked(), Nan::New<v8::Number>(stats.entries));
+        ret->Set(Nan::New<v8::String>("bytes").ToLocalChecked(), Nan::New<v8::Number>(stats.bytes));
+
+        info.GetReturnValue().Set(ret);
+    }
+
+    NAN_METHOD(ClearBasisCache) {
+        V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+        _global_basis_cache.clear();
+    }
+
 #ifdef HAVE_ENV
     NAN_METHOD(glpMemInfo) {
         V8CHECK(info.Length() != 0, "Wrong number of arguments");
@@ -72,6 +120,9 @@ extern "C" {
     
     void Init(Handle<Object> exports) {
         exports->Set(Nan::New<String>("termOutput").ToLocalChecked(), Nan::New<FunctionTemplate>(TermOutput)->GetFunction());
+        exports->Set(Nan::New<String>("setBasisCache").ToLocalChecked(), Nan::New<FunctionTemplate>(SetBasisCache)->GetFunction());
+        exports->Set(Nan::New<String>("basisCacheStats").ToLocalChecked(), Nan::New<FunctionTemplate>(BasisCacheStats)->GetFunction());
+        exports->Set(Nan::New<String>("clearBasisCache").ToLocalChecked(), Nan::New<FunctionTemplate>(ClearBasisCache)->GetFunction());
 #ifdef HAVE_ENV
         exports->Set(Nan::New<String>("glpMemInfo").ToLocalChecked(), Nan::New<FunctionTemplate>(glpMemInfo)->GetFunction());
 #endif
@@ -144,6 +195,7 @@ extern "C" {
         GLP_DEFINE_CONSTANT(exports, GLP_BR_MFV, BR_MFV);
         GLP_DEFINE_CONSTANT(exports, GLP_BR_DTH, BR_DTH);
         GLP_DEFINE_CONSTANT(exports, GLP_BR_PCH, BR_PCH);
+        GLP_DEFINE_CONSTANT(exports, GLP_BR_RLB, BR_RLB);
         
         GLP_DEFINE_CONSTANT(exports, GLP_BT_DFS, BT_DFS);
         GLP_DEFINE_CONSTANT(exports, GLP_BT_BFS, BT_BFS);
@@ -218,6 +270,8 @@ extern "C" {
         Problem::Init(exports);
         Tree::Init(exports);
         Mathprog::Init(exports);
+        MathprogModel::Init(exports);
+        Presolver::Init(exports);
     }
     
 }
@@ -2,10 +2,14 @@
 #ifndef _NODE_GLPK_NODEGLPK_H
 #define _NODE_GLPK_NODEGLPK_H
 
+#include <algorithm>
+#include <list>
 #include <memory>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
+#include <string.h>
 
 #include <eventemitter.hpp>
 
@@ -89,11 +93,167 @@ class MemoryStatistics {
     NodeEvent::uv_rwlock lock_;
 };
 
+/**
+ * BasisCache is a threadsafe, process wide LRU cache of optimal simplex bases. Bases are keyed on a structural
+ * fingerprint of the problem (names, bound types and sparsity pattern, but not the data), so a model that is
+ * rebuilt with different data can warm start from the basis of its previous instance.
+ * The cache is disabled until a positive entry limit is configured.
+ */
+class BasisCache {
+ public:
+     struct Stats {
+         size_t hits, misses, evictions, entries, bytes;
+     };
+
+     BasisCache() : max_entries_(0), max_bytes_(0), bytes_(0), hits_(0), misses_(0), evictions_(0), lock_{} {}
+     ~BasisCache() noexcept = default;
+
+     /// @param[in] max_entries - The maximum number of bases kept; 0 disables the cache
+     /// @param[in] max_bytes - The maximum memory used by the cached bases; 0 means no limit
+     void configure(size_t max_entries, size_t max_bytes) {
+         std::unique_lock<NodeEvent::uv_rwlock> guard{lock_};
+         max_entries_ = max_entries;
+         max_bytes_ = max_bytes;
+         evict();
+     }
+
+     bool enabled() {
+         NodeEvent::shared_lock<NodeEvent::uv_rwlock> guard{lock_};
+         return max_entries_ > 0;
+     }
+
+     /// Drops all cached bases and resets the statistics.
+     void clear() {
+         std::unique_lock<NodeEvent::uv_rwlock> guard{lock_};
+         lru_.clear();
+         index_.clear();
+         bytes_ = 0;
+         hits_ = misses_ = evictions_ = 0;
+     }
+
+     Stats stats() {
+         NodeEvent::shared_lock<NodeEvent::uv_rwlock> guard{lock_};
+         return Stats{hits_, misses_, evictions_, lru_.size(), bytes_};
+     }
+
+     /// Installs the cached basis for the problem, unless the problem already has a basis of its own.
+     /// Must be called with the problem's environment guard in place.
+     ///
+     /// @param[in] P - The problem
+     /// @param[in] user_basis - True if the statuses of the problem have been set by the user, so they are kept
+     /// @param[out] installed - Set to true if a cached basis was installed
+     /// @returns the fingerprint of the problem to be passed to remember(), or 0 if the cache is disabled
+     uint64_t warmStart(glp_prob* P, bool user_basis, bool& installed) {
+         installed = false;
+         if (!enabled() || glp_get_num_rows(P) == 0) return 0;
+         uint64_t key = fingerprint(P);
+         if (user_basis || glp_bf_exists(P) || glp_get_status(P) != GLP_UNDEF) return key;
+
+         std::unique_lock<NodeEvent::uv_rwlock> guard{lock_};
+         auto it = index_.find(key);
+         if (it == index_.end()) {
+             misses_++;
+             return key;
+         }
+         hits_++;
+         installed = true;
+         lru_.splice(lru_.begin(), lru_, it->second);
+         const Entry& entry = *it->second;
+         int m = glp_get_num_rows(P);
+         for (int i = 1; i <= m; i++) glp_set_row_stat(P, i, entry.stat[i - 1]);
+         for (int j = 1; j <= glp_get_num_cols(P); j++) glp_set_col_stat(P, j, entry.stat[m + j - 1]);
+         return key;
+     }
+
+     /// Stores the basis of the problem if it is optimal.
+     ///
+     /// @param[in] key - The fingerprint returned by warmStart()
+     /// @param[in] P - The problem
+     void remember(uint64_t key, glp_prob* P) {
+         if (!key || glp_get_status(P) != GLP_OPT) return;
+         int m = glp_get_num_rows(P), n = glp_get_num_cols(P);
+         std::vector<char> stat(m + n);
+         for (int i = 1; i <= m; i++) stat[i - 1] = static_cast<char>(glp_get_row_stat(P, i));
+         for (int j = 1; j <= n; j++) stat[m + j - 1] = static_cast<char>(glp_get_col_stat(P, j));
+
+         std::unique_lock<NodeEvent::uv_rwlock> guard{lock_};
+         if (max_entries_ == 0) return;
+         auto it = index_.find(key);
+         if (it != index_.end()) {
+             bytes_ -= it->second->size();
+             lru_.erase(it->second);
+         }
+         lru_.push_front(Entry{key, std::move(stat)});
+         index_[key] = lru_.begin();
+         bytes_ += lru_.front().size();
+         evict();
+     }
+
+     /// Computes an FNV-1a hash of the problem structure: dimensions, names, bound types, column kinds and
+     /// the sparsity pattern of the constraint matrix.
+     static uint64_t fingerprint(glp_prob* P) {
+         uint64_t h = 14695981039346656037ULL;
+         auto mix = [&h](const void* data, size_t len) {
+             const unsigned char* p = static_cast<const unsigned char*>(data);
+             for (size_t k = 0; k < len; k++) {
+                 h ^= p[k];
+                 h *= 1099511628211ULL;
+             }
+         };
+         auto mixName = [&mix](const char* name) {
+             if (name) mix(name, strlen(name));
+             mix("", 1);
+         };
+         int m = glp_get_num_rows(P), n = glp_get_num_cols(P);
+         mix(&m, sizeof(m));
+         mix(&n, sizeof(n));
+         for (int i = 1; i <= m; i++) {
+             int type = glp_get_row_type(P, i);
+             mix(&type, sizeof(type));
+             mixName(glp_get_row_name(P, i));
+         }
+         std::vector<int> ind(1 + m);
+         for (int j = 1; j <= n; j++) {
+             int type[2] = {glp_get_col_type(P, j), glp_get_col_kind(P, j)};
+             mix(type, sizeof(type));
+             mixName(glp_get_col_name(P, j));
+             int len = glp_get_mat_col(P, j, ind.data(), NULL);
+             std::sort(ind.begin() + 1, ind.begin() + 1 + len);
+             mix(&len, sizeof(len));
+             mix(ind.data() + 1, len * sizeof(int));
+         }
+         return h ? h : 1;
+     }
+
+ private:
+     struct Entry {
+         uint64_t key;
+         std::vector<char> stat;
+         size_t size() const { return sizeof(Entry) + stat.size(); }
+     };
+
+     void evict() {
+         while (!lru_.empty() && (lru_.size() > max_entries_ || (max_bytes_ && bytes_ > max_bytes_))) {
+             bytes_ -= lru_.back().size();
+             index_.erase(lru_.back().key);
+             lru_.pop_back();
+             evictions_++;
+         }
+     }
+
+     std::list<Entry> lru_;
+     std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+     size_t max_entries_, max_bytes_, bytes_;
+     size_t hits_, misses_, evictions_;
+     NodeEvent::uv_rwlock lock_;
+};
+
 int stdoutTermHook(void*, const char* s);
 int eventTermHook(void* info, const char* s);
 void _ErrorHook(void* s);
 
 extern MemoryStatistics _global_memory_statistics;
+extern BasisCache _global_basis_cache;
 
 /// TermHookManager provides static methods for managing TermHooks, and hook registration
 class TermHookManager {
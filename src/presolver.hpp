@@ -0,0 +1,313 @@
+#pragma once
+#ifndef _NODE_GLPK_PRESOLVER_HPP
+#define _NODE_GLPK_PRESOLVER_HPP
+#include <eventemitter.hpp>
+
+#include <node.h>
+#include <node_object_wrap.h>
+#include "glpk/glpk.h"
+#include "common.h"
+
+#include "nodeglpk.hpp"
+#include "problem.hpp"
+
+
+namespace NodeGLPK {
+
+    using namespace v8;
+
+    class Presolver : public node::ObjectWrap {
+    public:
+        static void Init(Handle<Object> exports){
+            // Prepare constructor template
+            Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(New);
+            tpl->SetClassName(Nan::New<String>("Presolver").ToLocalChecked());
+            tpl->InstanceTemplate()->SetInternalFieldCount(1);
+
+            // prototypes
+            Nan::SetPrototypeMethod(tpl, "on", On);
+            Nan::SetPrototypeMethod(tpl, "presolveSync", PresolveSync);
+            Nan::SetPrototypeMethod(tpl, "presolve", Presolve);
+            Nan::SetPrototypeMethod(tpl, "updateObjSync", UpdateObjSync);
+            Nan::SetPrototypeMethod(tpl, "postsolveSync", PostsolveSync);
+            Nan::SetPrototypeMethod(tpl, "postsolve", Postsolve);
+            Nan::SetPrototypeMethod(tpl, "delete", Delete);
+
+            constructor.Reset(tpl);
+            exports->Set(Nan::New<String>("Presolver").ToLocalChecked(), tpl->GetFunction());
+        }
+    private:
+       explicit Presolver()
+           : node::ObjectWrap(),
+             emitter_(std::make_shared<NodeEvent::EventEmitter>()),
+             info_{std::make_shared<HookInfo>(emitter_)},
+             env_state_(make_shared_environ_state(info_)),
+             counters_{0,0,0,0}
+             {
+           GLPKEnvStateGuard mguard{env_state_, info_};
+           handle = glp_npp_alloc_wksp();
+           thread = false;
+        };
+        ~Presolver(){
+            if(handle) {
+                GLPKEnvStateGuard mguard{env_state_, info_};
+                glp_npp_free_wksp(handle);
+                handle = NULL;
+            }
+            env_state_ = NULL;
+        };
+
+        static NAN_METHOD(New){
+            V8CHECK(!info.IsConstructCall(), "Constructor Presolver requires 'new'");
+
+            GLP_CATCH_RET(
+                Presolver* obj = new Presolver();
+                obj->Wrap(info.This());
+                      info.GetReturnValue().Set(info.This());
+            );
+        }
+
+        static NAN_METHOD(On) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!(info[0]->IsString() || !info[1]->IsFunction()), "Wrong arguments");
+
+            Presolver* ps = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!ps->handle, "object deleted");
+
+            auto s = std::string(*v8::String::Utf8Value(info[0]->ToString()));
+            Nan::Callback* callback = new Nan::Callback(info[1].As<Function>());
+
+            ps->emitter_->on(s, callback);
+        }
+
+        // options of presolve: sol (GLP_SOL, GLP_IPT or GLP_MIP), names
+        // and hard (booleans)
+        static bool ParseOptions(Local<Value> value, int &sol, int &names, int &hard){
+            sol = GLP_SOL;
+            names = GLP_OFF;
+            hard = GLP_OFF;
+            if (value->IsUndefined()) return true;
+            V8CHECKBOOL(!value->IsObject(), "Wrong arguments");
+            Local<Object> obj = value->ToObject();
+            Local<Array> props = obj->GetPropertyNames();
+            for(uint32_t i = 0; i < props->Length(); i++){
+                Local<Value> key = props->Get(i);
+                Local<Value> val = obj->Get(key);
+                std::string keystr = std::string(V8TOCSTRING(key));
+                if (keystr == "sol"){
+                    V8CHECKBOOL(!val->IsInt32(), "sol: should be int32");
+                    sol = val->Int32Value();
+                    V8CHECKBOOL((sol != GLP_SOL) && (sol != GLP_IPT) && (sol != GLP_MIP), "sol: invalid value");
+                } else if (keystr == "names"){
+                    V8CHECKBOOL(!val->IsBoolean(), "names: should be boolean");
+                    names = val->BooleanValue() ? GLP_ON : GLP_OFF;
+                } else if (keystr == "hard"){
+                    V8CHECKBOOL(!val->IsBoolean(), "hard: should be boolean");
+                    hard = val->BooleanValue() ? GLP_ON : GLP_OFF;
+                } else {
+                    std::string error("Unknow field: ");
+                    error += keystr;
+                    V8CHECKBOOL(true, error.c_str());
+                }
+            }
+            return true;
+        }
+
+        // the reduced problem is built only if presolve succeeded
+        static int Run(Presolver *ps, Problem *orig, Problem *reduced, int sol, int names, int hard){
+            glp_npp_load_prob(ps->handle, orig->handle, sol, names);
+            int ret = glp_npp_preprocess1(ps->handle, hard);
+            if (ret == 0)
+                glp_npp_build_prob(ps->handle, reduced->handle);
+            return ret;
+        }
+
+        class PresolveWorker : public Nan::AsyncWorker {
+        public:
+            PresolveWorker(Nan::Callback *callback, Presolver *ps, Problem *orig, Problem *reduced, int sol, int names, int hard)
+            : Nan::AsyncWorker(callback), ps(ps), orig(orig), reduced(reduced), sol(sol), names(names), hard(hard){
+
+            }
+            void WorkComplete() {
+                ps->thread = false;
+                orig->thread = false;
+                reduced->thread = false;
+                Nan::AsyncWorker::WorkComplete();
+            }
+            void Execute () {
+                try {
+                    ret = Run(ps, orig, reduced, sol, names, hard);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+            }
+            virtual void HandleOKCallback() {
+                Local<Value> info[] = {Nan::Null(), Nan::New<Int32>(ret)};
+                callback->Call(2, info);
+            }
+        public:
+            Presolver *ps;
+            Problem *orig, *reduced;
+            int sol, names, hard, ret;
+        };
+
+        static NAN_METHOD(Presolve) {
+            V8CHECK((info.Length() < 3) || (info.Length() > 4), "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[1]->IsObject() || !info[info.Length() - 1]->IsFunction(), "Wrong arguments");
+
+            Presolver* ps = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!ps->handle, "object deleted");
+            V8CHECK(ps->thread.load(), "an async operation is inprogress");
+
+            Problem* orig = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!orig || !orig->handle, "invalid problem");
+            V8CHECK(orig->thread.load(), "an async operation is inprogress");
+            Problem* reduced = ObjectWrap::Unwrap<Problem>(info[1]->ToObject());
+            V8CHECK(!reduced || !reduced->handle || (reduced == orig), "invalid problem");
+            V8CHECK(reduced->thread.load(), "an async operation is inprogress");
+
+            int sol, names, hard;
+            if (!ParseOptions(info.Length() == 4 ? info[2] : Nan::Undefined().As<Value>(), sol, names, hard)) return;
+
+            Nan::Callback *callback = new Nan::Callback(info[info.Length() - 1].As<Function>());
+            PresolveWorker *worker = new PresolveWorker(callback, ps, orig, reduced, sol, names, hard);
+            ps->thread = true;
+            orig->thread = true;
+            reduced->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, ps->emitter_, ps->env_state_);
+            Nan::AsyncQueueWorker(decorated);
+        }
+
+        static NAN_METHOD(PresolveSync){
+            V8CHECK((info.Length() < 2) || (info.Length() > 3), "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[1]->IsObject(), "Wrong arguments");
+
+            Presolver* ps = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!ps->handle, "object deleted");
+            V8CHECK(ps->thread.load(), "an async operation is inprogress");
+
+            Problem* orig = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!orig || !orig->handle, "invalid problem");
+            Problem* reduced = ObjectWrap::Unwrap<Problem>(info[1]->ToObject());
+            V8CHECK(!reduced || !reduced->handle || (reduced == orig), "invalid problem");
+
+            int sol, names, hard;
+            if (!ParseOptions(info.Length() == 3 ? info[2] : Nan::Undefined().As<Value>(), sol, names, hard)) return;
+
+            GLP_CREATE_HOOK_GUARDS(ps);
+            GLP_CATCH_RET(info.GetReturnValue().Set(Run(ps, orig, reduced, sol, names, hard));)
+        }
+
+        static NAN_METHOD(UpdateObjSync){
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[1]->IsObject(), "Wrong arguments");
+
+            Presolver* ps = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!ps->handle, "object deleted");
+            V8CHECK(ps->thread.load(), "an async operation is inprogress");
+
+            Problem* orig = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!orig || !orig->handle, "invalid problem");
+            Problem* reduced = ObjectWrap::Unwrap<Problem>(info[1]->ToObject());
+            V8CHECK(!reduced || !reduced->handle, "invalid problem");
+
+            GLP_CREATE_HOOK_GUARDS(ps);
+            GLP_CATCH_RET(info.GetReturnValue().Set(glp_npp_update_obj(ps->handle, orig->handle, reduced->handle));)
+        }
+
+        class PostsolveWorker : public Nan::AsyncWorker {
+        public:
+            PostsolveWorker(Nan::Callback *callback, Presolver *ps, Problem *orig, Problem *reduced)
+            : Nan::AsyncWorker(callback), ps(ps), orig(orig), reduced(reduced){
+
+            }
+            void WorkComplete() {
+                ps->thread = false;
+                orig->thread = false;
+                reduced->thread = false;
+                Nan::AsyncWorker::WorkComplete();
+            }
+            void Execute () {
+                try {
+                    glp_npp_postprocess(ps->handle, reduced->handle);
+                    glp_npp_obtain_sol(ps->handle, orig->handle);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+            }
+        public:
+            Presolver *ps;
+            Problem *orig, *reduced;
+        };
+
+        static NAN_METHOD(Postsolve) {
+            V8CHECK(info.Length() != 3, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[1]->IsObject() || !info[2]->IsFunction(), "Wrong arguments");
+
+            Presolver* ps = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!ps->handle, "object deleted");
+            V8CHECK(ps->thread.load(), "an async operation is inprogress");
+
+            Problem* orig = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!orig || !orig->handle, "invalid problem");
+            V8CHECK(orig->thread.load(), "an async operation is inprogress");
+            Problem* reduced = ObjectWrap::Unwrap<Problem>(info[1]->ToObject());
+            V8CHECK(!reduced || !reduced->handle || (reduced == orig), "invalid problem");
+            V8CHECK(reduced->thread.load(), "an async operation is inprogress");
+
+            Nan::Callback *callback = new Nan::Callback(info[2].As<Function>());
+            PostsolveWorker *worker = new PostsolveWorker(callback, ps, orig, reduced);
+            ps->thread = true;
+            orig->thread = true;
+            reduced->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, ps->emitter_, ps->env_state_);
+            Nan::AsyncQueueWorker(decorated);
+        }
+
+        static NAN_METHOD(PostsolveSync){
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsObject() || !info[1]->IsObject(), "Wrong arguments");
+
+            Presolver* ps = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!ps->handle, "object deleted");
+            V8CHECK(ps->thread.load(), "an async operation is inprogress");
+
+            Problem* orig = ObjectWrap::Unwrap<Problem>(info[0]->ToObject());
+            V8CHECK(!orig || !orig->handle, "invalid problem");
+            Problem* reduced = ObjectWrap::Unwrap<Problem>(info[1]->ToObject());
+            V8CHECK(!reduced || !reduced->handle || (reduced == orig), "invalid problem");
+
+            GLP_CREATE_HOOK_GUARDS(ps);
+            GLP_CATCH_RET(
+                glp_npp_postprocess(ps->handle, reduced->handle);
+                glp_npp_obtain_sol(ps->handle, orig->handle);
+            )
+        }
+
+        static NAN_METHOD(Delete) {
+            Presolver* obj = ObjectWrap::Unwrap<Presolver>(info.Holder());
+            V8CHECK(!obj->handle, "object already deleted");
+            V8CHECK(obj->thread, "an async operation is inprogress")
+
+            GLP_CREATE_HOOK_GUARDS(obj);
+            GLP_CATCH_RET(glp_npp_free_wksp(obj->handle);)
+            obj->emitter_->removeAllListeners();
+            _global_memory_statistics.removeStateCounters(obj->env_state_, obj->counters_);
+            obj->handle = NULL;
+            obj->env_state_ = NULL;
+        }
+
+        static Nan::Persistent<FunctionTemplate> constructor;
+        glp_prep *handle;
+        std::atomic<bool> thread;
+
+    private:
+        std::shared_ptr<NodeEvent::EventEmitter> emitter_;
+        std::shared_ptr<HookInfo> info_;
+        std::shared_ptr<glp_environ_state_t> env_state_;
+        struct glp_memory_counters counters_;
+    };
+
+    Nan::Persistent<FunctionTemplate> Presolver::constructor;
+}
+#endif
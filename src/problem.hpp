@@ -5,12 +5,14 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 #include <node.h>
 #include <node_object_wrap.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <float.h>
 
 #include <eventemitter.hpp>
 
@@ -50,6 +52,10 @@ namespace NodeGLPK {
             Nan::SetPrototypeMethod(tpl, "loadMatrix", LoadMatrix);
             Nan::SetPrototypeMethod(tpl, "simplexSync", SimplexSync);
             Nan::SetPrototypeMethod(tpl, "simplex", Simplex);
+            Nan::SetPrototypeMethod(tpl, "resolveSync", ResolveSync);
+            Nan::SetPrototypeMethod(tpl, "resolve", Resolve);
+            Nan::SetPrototypeMethod(tpl, "sessionInfo", SessionInfo);
+            Nan::SetPrototypeMethod(tpl, "endSession", EndSession);
             Nan::SetPrototypeMethod(tpl, "getObjVal", GetObjVal);
             Nan::SetPrototypeMethod(tpl, "getColPrim", GetColPrim);
             Nan::SetPrototypeMethod(tpl, "setObjName", SetObjName);
@@ -105,6 +111,9 @@ namespace NodeGLPK {
             Nan::SetPrototypeMethod(tpl, "interiorSync", InteriorSync);
             Nan::SetPrototypeMethod(tpl, "interior", Interior);
             Nan::SetPrototypeMethod(tpl, "iptStatus", IptStatus);
+            Nan::SetPrototypeMethod(tpl, "iptXret", IptXret);
+            Nan::SetPrototypeMethod(tpl, "concurrentSolveSync", ConcurrentSolveSync);
+            Nan::SetPrototypeMethod(tpl, "concurrentSolve", ConcurrentSolve);
             Nan::SetPrototypeMethod(tpl, "readMpsSync", ReadMpsSync);
             Nan::SetPrototypeMethod(tpl, "readMps", ReadMps);
             Nan::SetPrototypeMethod(tpl, "writeMpsSync", WriteMpsSync);
@@ -120,6 +129,8 @@ namespace NodeGLPK {
             Nan::SetPrototypeMethod(tpl, "getNumBin", GetNumBin);
             Nan::SetPrototypeMethod(tpl, "intoptSync", IntoptSync);
             Nan::SetPrototypeMethod(tpl, "intopt", Intopt);
+            Nan::SetPrototypeMethod(tpl, "intoptRaceSync", IntoptRaceSync);
+            Nan::SetPrototypeMethod(tpl, "intoptRace", IntoptRace);
             Nan::SetPrototypeMethod(tpl, "readProbSync", ReadProbSync);
             Nan::SetPrototypeMethod(tpl, "readProb", ReadProb);
             Nan::SetPrototypeMethod(tpl, "writeProbSync", WriteProbSync);
@@ -132,6 +143,7 @@ namespace NodeGLPK {
             Nan::SetPrototypeMethod(tpl, "mipObjVal", MipObjVal);
             Nan::SetPrototypeMethod(tpl, "mipRowVal", MipRowVal);
             Nan::SetPrototypeMethod(tpl, "mipColVal", MipColVal);
+            Nan::SetPrototypeMethod(tpl, "mipSolutions", MipSolutions);
             Nan::SetPrototypeMethod(tpl, "checkKkt", CheckKkt);
             Nan::SetPrototypeMethod(tpl, "printSolSync", PrintSolSync);
             Nan::SetPrototypeMethod(tpl, "printSol", PrintSol);
@@ -233,6 +245,8 @@ namespace NodeGLPK {
              info_{std::make_shared<HookInfo>(emitter_)},
              env_state_(make_shared_environ_state(info_)),
              counters_{0,0,0,0},
+             session_(NULL),
+             user_basis_(false),
             thread{false}{
 
            GLPKEnvStateGuard stateguard{env_state_, info_}; 
@@ -242,6 +256,7 @@ namespace NodeGLPK {
         ~Problem(){
             if (handle) {
                 GLPKEnvStateGuard stateguard{env_state_, info_}; 
+                if (session_) glp_delete_session(session_);
                 glp_delete_prob(handle);
                 handle = NULL;
             }
@@ -333,9 +348,23 @@ namespace NodeGLPK {
                           if (!SmcpInit(&scmp, info[0])) return;
                       
                       
-                      glp_simplex(lp->handle, &scmp);
+                      CachedSimplex(lp, &scmp);
             )
         }
+        
+        static int CachedSimplex(Problem *lp, glp_smcp *smcp) {
+            bool installed;
+            uint64_t key = _global_basis_cache.warmStart(lp->handle, lp->user_basis_, installed);
+            lp->user_basis_ = false;
+            int ret = glp_simplex(lp->handle, smcp);
+            if (installed && (ret == GLP_EBADB || ret == GLP_ESING || ret == GLP_ECOND)) {
+                // the cached basis does not suit the data of this instance
+                glp_std_basis(lp->handle);
+                ret = glp_simplex(lp->handle, smcp);
+            }
+            _global_basis_cache.remember(key, lp->handle);
+            return ret;
+        }
 
         class SimplexWorker : public Nan::AsyncWorker {
         public:
@@ -354,7 +383,7 @@ namespace NodeGLPK {
 
             void Execute () {
                 try {
-                    glp_simplex(lp->handle, &smcp);
+                    CachedSimplex(lp, &smcp);
                 } catch (std::string s){
                     SetErrorMessage(s.c_str());
                 }
@@ -382,7 +411,108 @@ namespace NodeGLPK {
             GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, lp->emitter_, lp->env_state_);
             Nan::AsyncQueueWorker(decorated);
         }
+                
+        static NAN_METHOD(ResolveSync) {
+            V8CHECK(info.Length() > 1, "Wrong number of arguments");
+            
+            GLP_CATCH_RET(
+                      glp_smcp scmp;
+                      Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+                      V8CHECK(!lp->handle, "object deleted");
+                      V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+                      GLP_CREATE_HOOK_GUARDS(lp); 
+                      glp_init_smcp(&scmp);
+                      if (info.Length() == 1)
+                          if (!SmcpInit(&scmp, info[0])) return;
+                      
+                      if (!lp->session_) lp->session_ = glp_create_session(lp->handle);
+                      int ret = glp_session_simplex(lp->session_, &scmp);
+                      info.GetReturnValue().Set(ret);
+            )
+        }
+
+        class ResolveWorker : public Nan::AsyncWorker {
+        public:
+            ResolveWorker(Nan::Callback *callback, Problem *lp)
+            : Nan::AsyncWorker(callback), lp(lp){
+                GLP_CREATE_HOOK_GUARDS(lp); 
+                glp_init_smcp(&smcp);
+            }
+
+            void WorkComplete() {
+                lp->thread = false;
+                Nan::AsyncWorker::WorkComplete();
+            }
+
+            void Execute () {
+                try {
+                    if (!lp->session_) lp->session_ = glp_create_session(lp->handle);
+                    ret = glp_session_simplex(lp->session_, &smcp);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+            }
+            void HandleOKCallback() {
+                Local<Value> info[] = {Nan::Null(), Nan::New<Int32>(ret)};
+                callback->Call(2, info);
+            }
+        public:
+            int ret;
+            Problem *lp;
+            glp_smcp smcp;
+        };
+        
+        static NAN_METHOD(Resolve) {
+            V8CHECK(info.Length() > 2, "Wrong number of arguments");
+            V8CHECK(!(info[0]->IsObject() || info[0]->IsNull()) || !info[1]->IsFunction(), "Wrong arguments");
+            
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+            
+            Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+            ResolveWorker *worker = new ResolveWorker(callback, lp);
+            if (!SmcpInit(&worker->smcp, info[0])){
+                worker->Destroy();
+                return;
+            }
+            lp->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, lp->emitter_, lp->env_state_);
+            Nan::AsyncQueueWorker(decorated);
+        }
+        
+        static NAN_METHOD(SessionInfo) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+            
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+            
+            int solves = 0, rebuilds = 0, meth = 0;
+            if (lp->session_) glp_session_info(lp->session_, &solves, &rebuilds, &meth);
+            
+            Local<v8::Object> ret = Nan::New<v8::Object>();
+            ret->Set(Nan::New<v8::String>("solves").ToLocalChecked(), Nan::New<Int32>(solves));
+            ret->Set(Nan::New<v8::String>("rebuilds").ToLocalChecked(), Nan::New<Int32>(rebuilds));
+            ret->Set(Nan::New<v8::String>("meth").ToLocalChecked(), Nan::New<Int32>(meth));
+            info.GetReturnValue().Set(ret);
+        }
         
+        static NAN_METHOD(EndSession) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+            
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+            
+            GLP_CREATE_HOOK_GUARDS(lp); 
+            if (lp->session_) {
+                GLP_CATCH_RET(glp_delete_session(lp->session_);)
+                lp->session_ = NULL;
+            }
+        }
+
         static NAN_METHOD(ExactSync) {
             V8CHECK(info.Length() > 1, "Wrong number of arguments");
             
@@ -462,6 +592,12 @@ namespace NodeGLPK {
                 } else if (keystr == "ordAlg"){
                     V8CHECKBOOL(!val->IsInt32(), "ordAlg: should be int32");
                     iptcp->ord_alg = val->Int32Value();
+                } else if (keystr == "crossover"){
+                    V8CHECKBOOL(!val->IsInt32(), "crossover: should be int32");
+                    iptcp->crossover = val->Int32Value();
+                } else if (keystr == "numThr"){
+                    V8CHECKBOOL(!val->IsInt32(), "numThr: should be int32");
+                    iptcp->num_thr = val->Int32Value();
                 } else {
                     std::string error("Unknow field: ");
                     error += keystr;
@@ -534,6 +670,231 @@ namespace NodeGLPK {
             Nan::AsyncQueueWorker(decorated);
         }
         
+        enum { RACE_PRIMAL, RACE_DUAL, RACE_INTERIOR, RACE_COUNT };
+        
+        static const char* RaceName(int racer){
+            switch (racer){
+                case RACE_PRIMAL: return "primal";
+                case RACE_DUAL: return "dual";
+                case RACE_INTERIOR: return "interior";
+            }
+            return NULL;
+        }
+        
+        static int RaceStop(void *info){
+            return static_cast<std::atomic<bool>*>(info)->load() ? 1 : 0;
+        }
+        
+        static bool ConcurrentInit(glp_smcp* smcp, glp_iptcp* iptcp, Local<Value> value){
+            if (!value->IsObject()) return true;
+            Local<Object> obj = value->ToObject();
+            Local<Array> props = obj->GetPropertyNames();
+            for(uint32_t i = 0; i < props->Length(); i++){
+                Local<Value> key = props->Get(i);
+                Local<Value> val = obj->Get(key);
+                std::string keystr = std::string(V8TOCSTRING(key));
+                if (keystr == "simplex"){
+                    V8CHECKBOOL(!val->IsObject(), "simplex: should be object");
+                    if (!SmcpInit(smcp, val)) return false;
+                } else if (keystr == "interior"){
+                    V8CHECKBOOL(!val->IsObject(), "interior: should be object");
+                    if (!IptcpInit(iptcp, val)) return false;
+                } else {
+                    std::string error("Unknow field: ");
+                    error += keystr;
+                    V8CHECKBOOL(true, error.c_str());
+                }
+            }
+            return true;
+        }
+        
+        /**
+         * Races primal simplex, dual simplex and interior point on private copies of the problem, each in its own
+         * thread with its own GLPK environment. The first solver to finish successfully stops the others and its
+         * solution is copied back to handle; the index of the winner is stored in winner (-1 if every solver
+         * failed, in which case the primal simplex result is reported).
+         * The interior point racer always recovers an optimal basis by crossover and only counts as finished once
+         * the crossover has succeeded, so whichever solver wins, handle gets an optimal basic solution.
+         */
+        static int ConcurrentSolveLP(glp_prob *handle, const glp_smcp *smcp, const glp_iptcp *iptcp, int& winner) {
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::atomic<bool> stop{false};
+            bool release = false;
+            int finished = 0;
+            glp_prob *clones[RACE_COUNT] = {NULL, NULL, NULL};
+            int rets[RACE_COUNT] = {0, 0, 0};
+            std::string errors[RACE_COUNT];
+            winner = -1;
+            
+            // glp_copy_prob allocates the basis factorization driver of the source object on first use; create it
+            // here so that the racers only ever read from handle
+            glp_bfcp bfcp;
+            glp_get_bfcp(handle, &bfcp);
+            
+            auto racer = [&](int id) {
+                auto info = std::make_shared<HookInfo>(nullptr, nullptr);
+                auto state = make_shared_environ_state(info);
+                glp_memory_counters counters{0,0,0,0};
+                {
+                    GLPKEnvStateGuard stateguard{state, info};
+                    int ret = 0;
+                    std::string error;
+                    try {
+                        clones[id] = glp_create_prob();
+                        glp_copy_prob(clones[id], handle, GLP_OFF);
+                        if (id == RACE_INTERIOR){
+                            glp_iptcp parm = *iptcp;
+                            parm.crossover = GLP_ON;
+                            parm.stop_fn = RaceStop;
+                            parm.stop_info = &stop;
+                            ret = glp_interior(clones[id], &parm);
+                            // without an optimal basis the interior point result does not count
+                            if (ret == 0 && glp_ipt_xret(clones[id]) != 0)
+                                ret = GLP_EFAIL;
+                        } else {
+                            glp_smcp parm = *smcp;
+                            parm.meth = (id == RACE_PRIMAL) ? GLP_PRIMAL : GLP_DUALP;
+                            parm.stop_fn = RaceStop;
+                            parm.stop_info = &stop;
+                            ret = glp_simplex(clones[id], &parm);
+                        }
+                    } catch (std::string s){
+                        error = s.empty() ? std::string("solver failed") : s;
+                    }
+                    std::unique_lock<std::mutex> lock{mutex};
+                    rets[id] = ret;
+                    errors[id] = error;
+                    if (error.empty() && ret == 0 && winner < 0){
+                        winner = id;
+                        stop = true;
+                    }
+                    finished++;
+                    cv.notify_all();
+                    // the clone lives in this thread's environment, so keep it until the result is copied back
+                    cv.wait(lock, [&]{ return release; });
+                    lock.unlock();
+                    try {
+                        if (clones[id]) glp_delete_prob(clones[id]);
+                    } catch (std::string){}
+                }
+                _global_memory_statistics.removeStateCounters(state, counters);
+            };
+            
+            std::thread threads[RACE_COUNT];
+            for (int i = 0; i < RACE_COUNT; i++)
+                threads[i] = std::thread(racer, i);
+            
+            int ret = 0;
+            std::string error;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                cv.wait(lock, [&]{ return finished == RACE_COUNT; });
+                try {
+                    if (winner >= 0){
+                        glp_copy_sol(handle, clones[winner], GLP_SOL);
+                        if (winner == RACE_INTERIOR) glp_copy_sol(handle, clones[winner], GLP_IPT);
+                    } else if (errors[RACE_PRIMAL].empty()){
+                        if (clones[RACE_PRIMAL]) glp_copy_sol(handle, clones[RACE_PRIMAL], GLP_SOL);
+                        ret = rets[RACE_PRIMAL];
+                    } else {
+                        error = errors[RACE_PRIMAL];
+                    }
+                } catch (std::string s){
+                    error = s;
+                }
+                release = true;
+                cv.notify_all();
+            }
+            for (int i = 0; i < RACE_COUNT; i++)
+                threads[i].join();
+            
+            if (!error.empty()) throw error;
+            return ret;
+        }
+        
+        static Local<Object> RaceResult(int winner, int ret){
+            Local<Object> result = Nan::New<Object>();
+            if (winner >= 0)
+                result->Set(Nan::New<String>("algorithm").ToLocalChecked(), Nan::New<String>(RaceName(winner)).ToLocalChecked());
+            else
+                result->Set(Nan::New<String>("algorithm").ToLocalChecked(), Nan::Null());
+            GLP_SET_FIELD_INT32(result, "ret", ret);
+            return result;
+        }
+        
+        static NAN_METHOD(ConcurrentSolveSync) {
+            V8CHECK(info.Length() > 1, "Wrong number of arguments");
+            
+            GLP_CATCH_RET(
+                      glp_smcp smcp;
+                      glp_iptcp iptcp;
+                      Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+                      V8CHECK(!lp->handle, "object deleted");
+                      V8CHECK(lp->thread.load(), "an async operation is inprogress");
+                      
+                      GLP_CREATE_HOOK_GUARDS(lp);
+                      glp_init_smcp(&smcp);
+                      glp_init_iptcp(&iptcp);
+                      if (info.Length() == 1)
+                          if (!ConcurrentInit(&smcp, &iptcp, info[0])) return;
+                      
+                      int winner;
+                      int ret = ConcurrentSolveLP(lp->handle, &smcp, &iptcp, winner);
+                      info.GetReturnValue().Set(RaceResult(winner, ret));
+            )
+        }
+        
+        class ConcurrentSolveWorker : public Nan::AsyncWorker {
+        public:
+            ConcurrentSolveWorker(Nan::Callback *callback, Problem *lp)
+            : Nan::AsyncWorker(callback), lp(lp), ret(0), winner(-1){
+                GLP_CREATE_HOOK_GUARDS(lp);
+                glp_init_smcp(&smcp);
+                glp_init_iptcp(&iptcp);
+            }
+            void WorkComplete() {
+                lp->thread = false;
+                Nan::AsyncWorker::WorkComplete();
+            }
+            void Execute () {
+                try {
+                    ret = ConcurrentSolveLP(lp->handle, &smcp, &iptcp, winner);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+            }
+            void HandleOKCallback() {
+                Local<Value> info[] = {Nan::Null(), RaceResult(winner, ret)};
+                callback->Call(2, info);
+            }
+        public:
+            Problem *lp;
+            glp_smcp smcp;
+            glp_iptcp iptcp;
+            int ret;
+            int winner;
+        };
+        
+        static NAN_METHOD(ConcurrentSolve) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!(info[0]->IsObject() || info[0]->IsNull()) || !info[1]->IsFunction(), "Wrong arguments");
+            
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+            
+            Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+            ConcurrentSolveWorker *worker = new ConcurrentSolveWorker(callback, lp);
+            if (!ConcurrentInit(&worker->smcp, &worker->iptcp, info[0])){
+                worker->Destroy();
+                return;
+            }
+            lp->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, lp->emitter_, lp->env_state_);
+            Nan::AsyncQueueWorker(decorated);
+        }
+        
         static bool MpscpInit(glp_mpscp *mpscp, Local<Value> value){
             if (value->IsObject()){
                 Local<Object> obj = value->ToObject();
@@ -819,6 +1180,69 @@ namespace NodeGLPK {
                     } else if (keystr == "cbReasons"){
                         V8CHECKBOOL(!val->IsInt32(), "cbReason: should be int32");
                         iocp->cb_reasons = val->Int32Value();
+                    } else if (keystr == "threads"){
+                        V8CHECKBOOL(!val->IsInt32(), "threads: should be int32");
+                        iocp->threads = val->Int32Value();
+                    } else if (keystr == "detMode"){
+                        V8CHECKBOOL(!val->IsInt32(), "detMode: should be int32");
+                        iocp->det_mode = val->Int32Value();
+                    } else if (keystr == "shareCuts"){
+                        V8CHECKBOOL(!val->IsInt32(), "shareCuts: should be int32");
+                        iocp->share_cuts = val->Int32Value();
+                    } else if (keystr == "nodeMem"){
+                        V8CHECKBOOL(!val->IsInt32(), "nodeMem: should be int32");
+                        iocp->node_mem = val->Int32Value();
+                    } else if (keystr == "relLim"){
+                        V8CHECKBOOL(!val->IsInt32(), "relLim: should be int32");
+                        iocp->rel_lim = val->Int32Value();
+                    } else if (keystr == "sbItLim"){
+                        V8CHECKBOOL(!val->IsInt32(), "sbItLim: should be int32");
+                        iocp->sb_it_lim = val->Int32Value();
+                    } else if (keystr == "sbLook"){
+                        V8CHECKBOOL(!val->IsInt32(), "sbLook: should be int32");
+                        iocp->sb_look = val->Int32Value();
+                    } else if (keystr == "cutPool"){
+                        V8CHECKBOOL(!val->IsInt32(), "cutPool: should be int32");
+                        iocp->cut_pool = val->Int32Value();
+                    } else if (keystr == "solPool"){
+                        V8CHECKBOOL(!val->IsInt32(), "solPool: should be int32");
+                        iocp->sol_pool = val->Int32Value();
+                    } else if (keystr == "poolGap"){
+                        V8CHECKBOOL(!val->IsNumber(), "poolGap: should be a Number");
+                        iocp->pool_gap = val->NumberValue();
+                    } else if (keystr == "poolDiv"){
+                        V8CHECKBOOL(!val->IsInt32(), "poolDiv: should be int32");
+                        iocp->pool_div = val->Int32Value();
+                    } else if (keystr == "rinsHeur"){
+                        V8CHECKBOOL(!val->IsInt32(), "rinsHeur: should be int32");
+                        iocp->rins_heur = val->Int32Value();
+                    } else if (keystr == "lbHeur"){
+                        V8CHECKBOOL(!val->IsInt32(), "lbHeur: should be int32");
+                        iocp->lb_heur = val->Int32Value();
+                    } else if (keystr == "subFreq"){
+                        V8CHECKBOOL(!val->IsInt32(), "subFreq: should be int32");
+                        iocp->sub_freq = val->Int32Value();
+                    } else if (keystr == "subNodes"){
+                        V8CHECKBOOL(!val->IsInt32(), "subNodes: should be int32");
+                        iocp->sub_nodes = val->Int32Value();
+                    } else if (keystr == "subTmLim"){
+                        V8CHECKBOOL(!val->IsInt32(), "subTmLim: should be int32");
+                        iocp->sub_tm_lim = val->Int32Value();
+                    } else if (keystr == "ckptFile"){
+                        V8CHECKBOOL(!val->IsString(), "ckptFile: should be a string");
+                        std::string ckptfile = std::string(V8TOCSTRING(val));
+                        if (iocp->ckpt_file) delete[] iocp->ckpt_file;
+                        iocp->ckpt_file = new char[ckptfile.length() + 1];
+                        memcpy((void *)iocp->ckpt_file, ckptfile.c_str(), ckptfile.length() + 1);
+                    } else if (keystr == "ckptInt"){
+                        V8CHECKBOOL(!val->IsInt32(), "ckptInt: should be int32");
+                        iocp->ckpt_int = val->Int32Value();
+                    } else if (keystr == "resumeFrom"){
+                        V8CHECKBOOL(!val->IsString(), "resumeFrom: should be a string");
+                        std::string resume = std::string(V8TOCSTRING(val));
+                        if (iocp->resume) delete[] iocp->resume;
+                        iocp->resume = new char[resume.length() + 1];
+                        memcpy((void *)iocp->resume, resume.c_str(), resume.length() + 1);
                     } else {
                         std::string error("Unknow field: ");
                         error += keystr;
@@ -847,6 +1271,8 @@ namespace NodeGLPK {
                       }
                       if (iocp.cb_info) delete static_cast<IocpCallbackInfo*>(iocp.cb_info);
                       if (iocp.save_sol) delete[] iocp.save_sol;
+                      if (iocp.ckpt_file) delete[] iocp.ckpt_file;
+                      if (iocp.resume) delete[] iocp.resume;
             )
         }
         
@@ -875,6 +1301,8 @@ namespace NodeGLPK {
             ~IntoptWorker(){
                 if (parm.cb_info) delete static_cast<IocpCallbackInfo*>(parm.cb_info);
                 if (parm.save_sol) delete[] parm.save_sol;
+                if (parm.ckpt_file) delete[] parm.ckpt_file;
+                if (parm.resume) delete[] parm.resume;
             }
 
             void Execute() override {
@@ -983,7 +1411,318 @@ namespace NodeGLPK {
             GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, lp->emitter_, lp->env_state_);
             Nan::AsyncQueueWorker(decorated);
         }
-        
+
+        enum { MIP_RACE_DEFAULT, MIP_RACE_PSEUDOCOST, MIP_RACE_RELIABILITY, MIP_RACE_DEPTH, MIP_RACE_CUTS,
+            MIP_RACE_PROXIMITY, MIP_RACE_COUNT };
+
+        static const char* MipRaceName(int racer){
+            switch (racer){
+                case MIP_RACE_DEFAULT: return "default";
+                case MIP_RACE_PSEUDOCOST: return "pseudocost";
+                case MIP_RACE_RELIABILITY: return "reliability";
+                case MIP_RACE_DEPTH: return "depth";
+                case MIP_RACE_CUTS: return "cuts";
+                case MIP_RACE_PROXIMITY: return "proximity";
+            }
+            return NULL;
+        }
+
+        static void MipRacePreset(glp_iocp *parm, int racer){
+            switch (racer){
+                case MIP_RACE_DEFAULT:
+                    break;
+                case MIP_RACE_PSEUDOCOST:
+                    parm->br_tech = GLP_BR_PCH;
+                    parm->bt_tech = GLP_BT_BPH;
+                    break;
+                case MIP_RACE_RELIABILITY:
+                    parm->br_tech = GLP_BR_RLB;
+                    parm->bt_tech = GLP_BT_BLB;
+                    break;
+                case MIP_RACE_DEPTH:
+                    parm->br_tech = GLP_BR_MFV;
+                    parm->bt_tech = GLP_BT_DFS;
+                    parm->fp_heur = GLP_ON;
+                    break;
+                case MIP_RACE_CUTS:
+                    parm->gmi_cuts = GLP_ON;
+                    parm->mir_cuts = GLP_ON;
+                    parm->cov_cuts = GLP_ON;
+                    parm->clq_cuts = GLP_ON;
+                    break;
+                case MIP_RACE_PROXIMITY:
+                    parm->br_tech = GLP_BR_PCH;
+                    parm->bt_tech = GLP_BT_DFS;
+                    parm->ps_heur = GLP_ON;
+                    break;
+            }
+        }
+
+        class MipRaceShared {
+        public:
+            MipRaceShared(bool minimize): minimize(minimize), incumb(minimize ? DBL_MAX : -DBL_MAX), stop(false) {}
+
+            // glp_iocp.inc_fn: publishes the objective value of the racer's incumbent and returns the best one known
+            static double Exchange(void *info, double obj){
+                MipRaceShared *shared = static_cast<MipRaceShared*>(info);
+                std::lock_guard<std::mutex> lock{shared->mutex};
+                if (shared->minimize ? obj < shared->incumb : obj > shared->incumb)
+                    shared->incumb = obj;
+                return shared->incumb;
+            }
+
+            // glp_iocp.stop_fn
+            static int Stop(void *info){
+                return static_cast<MipRaceShared*>(info)->stop.load() ? 1 : 0;
+            }
+
+            bool minimize;
+            std::mutex mutex;
+            double incumb;
+            std::atomic<bool> stop;
+        };
+
+        static bool IntoptRaceInit(Problem* lp, glp_iocp* iocp, int* racers, Local<Value> value){
+            if (!value->IsObject()) return true;
+            Local<Object> obj = value->ToObject();
+            Local<Array> props = obj->GetPropertyNames();
+            for(uint32_t i = 0; i < props->Length(); i++){
+                Local<Value> key = props->Get(i);
+                Local<Value> val = obj->Get(key);
+                std::string keystr = std::string(V8TOCSTRING(key));
+                if (keystr == "intopt"){
+                    V8CHECKBOOL(!val->IsObject(), "intopt: should be object");
+                    if (!IocpInit(lp, iocp, val)) return false;
+                    // the racers run on private copies of the problem in their own threads, so neither the callback
+                    // nor the solution file can be served, and they cannot share a checkpoint file
+                    V8CHECKBOOL(iocp->cb_func != NULL, "intopt.cbFunc: not supported");
+                    V8CHECKBOOL(iocp->save_sol != NULL, "intopt.saveSol: not supported");
+                    V8CHECKBOOL(iocp->ckpt_file != NULL, "intopt.ckptFile: not supported");
+                } else if (keystr == "racers"){
+                    V8CHECKBOOL(!val->IsInt32(), "racers: should be int32");
+                    *racers = val->Int32Value();
+                    V8CHECKBOOL(*racers < 1 || *racers > MIP_RACE_COUNT, "racers: out of range");
+                } else {
+                    std::string error("Unknow field: ");
+                    error += keystr;
+                    V8CHECKBOOL(true, error.c_str());
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Races glp_intopt with the first nracers presets of the control parameters on private copies of the problem,
+         * each in its own thread with its own GLPK environment. The racers share the objective value of the best
+         * integer feasible solution found so far through glp_iocp.inc_fn, so each of them prunes its tree with it;
+         * the first racer to complete its search or to reach the mip gap tolerance stops the others. The best integer
+         * feasible solution found by any racer is copied back to handle; the index of the racer which stopped the
+         * race is stored in winner (-1 if none has), and the index of the racer whose solution was copied back is
+         * stored in source (-1 if no solution has been found). Since the winner may have pruned its tree with the
+         * incumbent of another racer, the copied solution keeps the status GLP_FEAS even if its optimality has been
+         * proven; IntoptRaceResult reports the status of the race as a whole.
+         */
+        static int IntoptRaceMIP(glp_prob *handle, const glp_iocp *iocp, int nracers, int& winner, int& source) {
+            std::mutex mutex;
+            std::condition_variable cv;
+            MipRaceShared shared(glp_get_obj_dir(handle) == GLP_MIN);
+            bool release = false;
+            int finished = 0;
+            glp_prob *clones[MIP_RACE_COUNT] = {NULL};
+            int rets[MIP_RACE_COUNT] = {0};
+            std::string errors[MIP_RACE_COUNT];
+            winner = -1;
+            source = -1;
+
+            // glp_copy_prob allocates the basis factorization driver of the source object on first use; create it
+            // here so that the racers only ever read from handle
+            glp_bfcp bfcp;
+            glp_get_bfcp(handle, &bfcp);
+
+            auto racer = [&](int id) {
+                auto info = std::make_shared<HookInfo>(nullptr, nullptr);
+                auto state = make_shared_environ_state(info);
+                glp_memory_counters counters{0,0,0,0};
+                {
+                    GLPKEnvStateGuard stateguard{state, info};
+                    int ret = 0;
+                    std::string error;
+                    try {
+                        clones[id] = glp_create_prob();
+                        glp_copy_prob(clones[id], handle, GLP_OFF);
+                        glp_iocp parm = *iocp;
+                        MipRacePreset(&parm, id);
+                        // the racers keep the cores busy, so each of them searches its tree in one thread
+                        parm.threads = 1;
+                        parm.inc_fn = MipRaceShared::Exchange;
+                        parm.inc_info = &shared;
+                        parm.stop_fn = MipRaceShared::Stop;
+                        parm.stop_info = &shared;
+                        ret = glp_intopt(clones[id], &parm);
+                    } catch (std::string s){
+                        error = s.empty() ? std::string("solver failed") : s;
+                    }
+                    std::unique_lock<std::mutex> lock{mutex};
+                    rets[id] = ret;
+                    errors[id] = error;
+                    if (error.empty() && (ret == 0 || ret == GLP_EMIPGAP) && winner < 0){
+                        winner = id;
+                        shared.stop = true;
+                    }
+                    finished++;
+                    cv.notify_all();
+                    // the clone lives in this thread's environment, so keep it until the result is copied back
+                    cv.wait(lock, [&]{ return release; });
+                    lock.unlock();
+                    try {
+                        if (clones[id]) glp_delete_prob(clones[id]);
+                    } catch (std::string){}
+                }
+                _global_memory_statistics.removeStateCounters(state, counters);
+            };
+
+            std::vector<std::thread> threads;
+            for (int i = 0; i < nracers; i++)
+                threads.push_back(std::thread(racer, i));
+
+            int ret = 0;
+            std::string error;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                cv.wait(lock, [&]{ return finished == nracers; });
+                try {
+                    // the racer which completed the search need not hold the best solution itself, since it may
+                    // have pruned its tree with the incumbent of another racer
+                    for (int i = 0; i < nracers; i++){
+                        if (!errors[i].empty() || !clones[i]) continue;
+                        int stat = glp_mip_status(clones[i]);
+                        if (stat != GLP_OPT && stat != GLP_FEAS) continue;
+                        double obj = glp_mip_obj_val(clones[i]);
+                        if (source < 0 || (shared.minimize ? obj < glp_mip_obj_val(clones[source]) :
+                                                             obj > glp_mip_obj_val(clones[source])))
+                            source = i;
+                    }
+                    if (winner >= 0){
+                        ret = rets[winner];
+                    } else if (errors[MIP_RACE_DEFAULT].empty()){
+                        ret = rets[MIP_RACE_DEFAULT];
+                    } else {
+                        error = errors[MIP_RACE_DEFAULT];
+                    }
+                    if (source >= 0){
+                        glp_copy_sol(handle, clones[source], GLP_MIP);
+                    } else if (winner >= 0){
+                        glp_copy_sol(handle, clones[winner], GLP_MIP);
+                    }
+                } catch (std::string s){
+                    error = s;
+                }
+                release = true;
+                cv.notify_all();
+            }
+            for (auto& thread : threads)
+                thread.join();
+
+            if (!error.empty()) throw error;
+            return ret;
+        }
+
+        static Local<Object> IntoptRaceResult(glp_prob *handle, int winner, int source, int ret){
+            Local<Object> result = Nan::New<Object>();
+            if (winner >= 0)
+                result->Set(Nan::New<String>("preset").ToLocalChecked(), Nan::New<String>(MipRaceName(winner)).ToLocalChecked());
+            else
+                result->Set(Nan::New<String>("preset").ToLocalChecked(), Nan::Null());
+            GLP_SET_FIELD_INT32(result, "racer", winner);
+            GLP_SET_FIELD_INT32(result, "source", source);
+            GLP_SET_FIELD_INT32(result, "ret", ret);
+            GLP_SET_FIELD_INT32(result, "status", (ret == 0 && source >= 0) ? GLP_OPT : glp_mip_status(handle));
+            return result;
+        }
+
+        static NAN_METHOD(IntoptRaceSync) {
+            V8CHECK(info.Length() > 1, "Wrong number of arguments");
+
+            GLP_CATCH_RET(
+                      glp_iocp iocp;
+                      int racers = 4;
+                      Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+                      V8CHECK(!lp->handle, "object deleted");
+                      V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+                      GLP_CREATE_HOOK_GUARDS(lp);
+                      glp_init_iocp(&iocp);
+                      bool ok = true;
+                      if (info.Length() == 1)
+                          ok = IntoptRaceInit(lp, &iocp, &racers, info[0]);
+                      if (ok){
+                          int winner, source;
+                          int ret = IntoptRaceMIP(lp->handle, &iocp, racers, winner, source);
+                          info.GetReturnValue().Set(IntoptRaceResult(lp->handle, winner, source, ret));
+                      }
+                      if (iocp.cb_info) delete static_cast<IocpCallbackInfo*>(iocp.cb_info);
+                      if (iocp.save_sol) delete[] iocp.save_sol;
+                      if (iocp.ckpt_file) delete[] iocp.ckpt_file;
+                      if (iocp.resume) delete[] iocp.resume;
+            )
+        }
+
+        class IntoptRaceWorker : public Nan::AsyncWorker {
+        public:
+            IntoptRaceWorker(Nan::Callback *callback, Problem *lp)
+            : Nan::AsyncWorker(callback), lp(lp), racers(4), ret(0), winner(-1), source(-1){
+                GLP_CREATE_HOOK_GUARDS(lp);
+                glp_init_iocp(&iocp);
+            }
+            ~IntoptRaceWorker(){
+                if (iocp.cb_info) delete static_cast<IocpCallbackInfo*>(iocp.cb_info);
+                if (iocp.save_sol) delete[] iocp.save_sol;
+                if (iocp.ckpt_file) delete[] iocp.ckpt_file;
+                if (iocp.resume) delete[] iocp.resume;
+            }
+            void WorkComplete() {
+                lp->thread = false;
+                Nan::AsyncWorker::WorkComplete();
+            }
+            void Execute () {
+                try {
+                    ret = IntoptRaceMIP(lp->handle, &iocp, racers, winner, source);
+                } catch (std::string s){
+                    SetErrorMessage(s.c_str());
+                }
+            }
+            void HandleOKCallback() {
+                Local<Value> info[] = {Nan::Null(), IntoptRaceResult(lp->handle, winner, source, ret)};
+                callback->Call(2, info);
+            }
+        public:
+            Problem *lp;
+            glp_iocp iocp;
+            int racers;
+            int ret;
+            int winner;
+            int source;
+        };
+
+        static NAN_METHOD(IntoptRace) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!(info[0]->IsObject() || info[0]->IsNull()) || !info[1]->IsFunction(), "Wrong arguments");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            Nan::Callback *callback = new Nan::Callback(info[1].As<Function>());
+            IntoptRaceWorker *worker = new IntoptRaceWorker(callback, lp);
+            if (!IntoptRaceInit(lp, &worker->iocp, &worker->racers, info[0])){
+                worker->Destroy();
+                return;
+            }
+            lp->thread = true;
+            GLPKEnvStateDecorator* decorated = new GLPKEnvStateDecorator(worker, lp->emitter_, lp->env_state_);
+            Nan::AsyncQueueWorker(decorated);
+        }
+
         static NAN_METHOD(ReadLpSync) {
             V8CHECK(info.Length() != 1, "Wrong number of arguments");
             V8CHECK(!info[0]->IsString(), "Wrong arguments");
@@ -1457,19 +2196,73 @@ namespace NodeGLPK {
         GLP_BIND_VOID(Problem, UnscaleSync, glp_unscale_prob);
         GLP_ASYNC_VOID(Problem, Unscale, glp_unscale_prob);
         
-        GLP_BIND_VOID_INT32_INT32(Problem, SetRowStat, glp_set_row_stat);
+        // a basis set by the user is never replaced by a cached one, so the basis setters mark it
+        static NAN_METHOD(SetRowStat) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsInt32() || !info[1]->IsInt32(), "Wrong arguments");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            GLP_CREATE_HOOK_GUARDS(lp);
+            GLP_CATCH_RET(glp_set_row_stat(lp->handle, info[0]->Int32Value(), info[1]->Int32Value());)
+            lp->user_basis_ = true;
+        }
         
-        GLP_BIND_VOID_INT32_INT32(Problem, SetColStat, glp_set_col_stat);
+        static NAN_METHOD(SetColStat) {
+            V8CHECK(info.Length() != 2, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsInt32() || !info[1]->IsInt32(), "Wrong arguments");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            GLP_CREATE_HOOK_GUARDS(lp);
+            GLP_CATCH_RET(glp_set_col_stat(lp->handle, info[0]->Int32Value(), info[1]->Int32Value());)
+            lp->user_basis_ = true;
+        }
         
         GLP_BIND_VALUE_INT32(Problem, GetRowStat, glp_get_row_stat);
         
         GLP_BIND_VALUE_INT32(Problem, GetColStat, glp_get_col_stat);
         
-        GLP_BIND_VOID(Problem, StdBasis, glp_std_basis);
+        static NAN_METHOD(StdBasis) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            GLP_CREATE_HOOK_GUARDS(lp);
+            GLP_CATCH_RET(glp_std_basis(lp->handle);)
+            lp->user_basis_ = true;
+        }
         
-        GLP_BIND_VOID_INT32(Problem, AdvBasis, glp_adv_basis);
+        static NAN_METHOD(AdvBasis) {
+            V8CHECK(info.Length() != 1, "Wrong number of arguments");
+            V8CHECK(!info[0]->IsInt32(), "Wrong arguments");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            GLP_CREATE_HOOK_GUARDS(lp);
+            GLP_CATCH_RET(glp_adv_basis(lp->handle, info[0]->Int32Value());)
+            lp->user_basis_ = true;
+        }
         
-        GLP_BIND_VOID(Problem, CpxBasis, glp_cpx_basis);
+        static NAN_METHOD(CpxBasis) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+
+            GLP_CREATE_HOOK_GUARDS(lp);
+            GLP_CATCH_RET(glp_cpx_basis(lp->handle);)
+            lp->user_basis_ = true;
+        }
         
         GLP_BIND_VALUE(Problem, GetStatus, glp_get_status);
         
@@ -1493,6 +2286,8 @@ namespace NodeGLPK {
         
         GLP_BIND_VALUE(Problem, IptStatus, glp_ipt_status);
         
+        GLP_BIND_VALUE(Problem, IptXret, glp_ipt_xret);
+        
         GLP_BIND_VALUE(Problem, IptObjVal, glp_ipt_obj_val);
         
         GLP_BIND_VALUE_INT32(Problem, IptRowPrim, glp_ipt_row_prim);
@@ -1525,6 +2320,40 @@ namespace NodeGLPK {
         
         GLP_BIND_VALUE_INT32(Problem, MipColVal, glp_mip_col_val);
         
+        static NAN_METHOD(MipSolutions) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+            
+            Problem* lp = ObjectWrap::Unwrap<Problem>(info.Holder());
+            V8CHECK(!lp->handle, "object deleted");
+            V8CHECK(lp->thread.load(), "an async operation is inprogress");
+            
+            GLP_CREATE_HOOK_GUARDS(lp);
+            GLP_CATCH_RET(
+                int count = glp_mip_pool_size(lp->handle);
+                int n = glp_get_num_cols(lp->handle);
+                
+                // solutions are returned best first; the value of column j in solution k (both 0-based) is x[k * n + j]
+                Local<ArrayBuffer> objBuf = ArrayBuffer::New(Isolate::GetCurrent(), sizeof(double) * count);
+                Local<ArrayBuffer> xBuf = ArrayBuffer::New(Isolate::GetCurrent(), sizeof(double) * count * n);
+                double* pobj = (double*)objBuf->GetContents().Data();
+                double* px = (double*)xBuf->GetContents().Data();
+                double* sol = (double*)malloc((n + 1) * sizeof(double));
+                for (int k = 1; k <= count; k++){
+                    pobj[k-1] = glp_mip_pool_obj(lp->handle, k);
+                    glp_mip_pool_sol(lp->handle, k, sol);
+                    memcpy(px + (size_t)(k-1) * n, sol + 1, n * sizeof(double));
+                }
+                free(sol);
+                
+                Local<Object> ret = Nan::New<Object>();
+                GLP_SET_FIELD_INT32(ret, "count", count);
+                GLP_SET_FIELD_INT32(ret, "n", n);
+                ret->Set(Nan::New<String>("obj").ToLocalChecked(), Float64Array::New(objBuf, 0, count));
+                ret->Set(Nan::New<String>("x").ToLocalChecked(), Float64Array::New(xBuf, 0, count * n));
+                info.GetReturnValue().Set(ret);
+            )
+        }
+        
         GLP_BIND_VALUE_STR(Problem, PrintSolSync, glp_print_sol);
         GLP_ASYNC_INT32_STR(Problem, PrintSol, glp_print_sol);
         
@@ -1570,6 +2399,10 @@ namespace NodeGLPK {
             V8CHECK(obj->thread, "an async operation is inprogress")
 
             GLP_CREATE_HOOK_GUARDS(obj); 
+            if (obj->session_) {
+                GLP_CATCH_RET(glp_delete_session(obj->session_);)
+                obj->session_ = NULL;
+            }
             GLP_CATCH_RET(glp_delete_prob(obj->handle);)
             obj->emitter_->removeAllListeners();
             _global_memory_statistics.removeStateCounters(obj->env_state_, obj->counters_);
@@ -1613,6 +2446,8 @@ namespace NodeGLPK {
         std::shared_ptr<HookInfo> info_;
         std::shared_ptr<glp_environ_state_t> env_state_;
         struct glp_memory_counters counters_;
+        glp_session *session_;
+        bool user_basis_;
     public:
         glp_prob *handle;
         std::atomic<bool> thread;
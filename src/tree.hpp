@@ -38,6 +38,8 @@ namespace NodeGLPK {
             Nan::SetPrototypeMethod(tpl, "mipGap", MipGap);
             Nan::SetPrototypeMethod(tpl, "rowAttrib", RowAttrib);
             Nan::SetPrototypeMethod(tpl, "poolSize", PoolSize);
+            Nan::SetPrototypeMethod(tpl, "globalPoolStats", GlobalPoolStats);
+            Nan::SetPrototypeMethod(tpl, "spillCount", SpillCount);
             Nan::SetPrototypeMethod(tpl, "delRow", DelRow);
             Nan::SetPrototypeMethod(tpl, "clearPool", ClearPool);
             Nan::SetPrototypeMethod(tpl, "canBranch", CanBranch);
@@ -148,6 +150,29 @@ namespace NodeGLPK {
         
         GLP_BIND_VALUE(Tree, PoolSize, glp_ios_pool_size);
         
+        static NAN_METHOD(GlobalPoolStats) {
+            V8CHECK(info.Length() != 0, "Wrong number of arguments");
+            
+            Tree* host = ObjectWrap::Unwrap<Tree>(info.Holder());
+            V8CHECK(!host->handle, "object deleted");
+            V8CHECK(host->thread.load(), "an async operation is inprogress");
+           
+            GLP_CREATE_HOOK_GUARDS(host); 
+            glp_gpstat stat;
+            GLP_CATCH_RET(glp_ios_gpool_stat(host->handle, &stat);)
+            
+            Local<Object> ret = Nan::New<Object>();
+            GLP_SET_FIELD_INT32(ret, "size", stat.size);
+            GLP_SET_FIELD_INT32(ret, "added", stat.added);
+            GLP_SET_FIELD_INT32(ret, "duplicates", stat.dupl);
+            GLP_SET_FIELD_INT32(ret, "reused", stat.reused);
+            GLP_SET_FIELD_INT32(ret, "removed", stat.removed);
+            
+            info.GetReturnValue().Set(ret);
+        }
+        
+        GLP_BIND_VALUE(Tree, SpillCount, glp_ios_spill_cnt);
+        
         static NAN_METHOD(AddRow) {
             V8CHECK(info.Length() != 7, "Wrong number of arguments");
             V8CHECK(!info[0]->IsString() || !info[1]->IsInt32() || !info[2]->IsInt32() || !info[3]->IsInt32Array()
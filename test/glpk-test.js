@@ -36,6 +36,602 @@ describe("Simplex problem tests", function() {
     });
 })
 
+describe("Simplex re-optimization session tests", function() {
+    it('should re-optimize after objective and bound changes', function(done) {
+        this.timeout(10000)
+        let lp = setupSimplexLP()
+        lp.simplexSync({})
+
+        // objective change keeps the basis primal feasible
+        lp.setObjCoef(3, 20.0)
+        expect(lp.resolveSync({})).to.equal(0)
+        expect(lp.sessionInfo().meth).to.equal(glp.PRIMAL)
+        let ref = setupSimplexLP()
+        ref.setObjCoef(3, 20.0)
+        ref.simplexSync({})
+        expect(lp.getStatus()).to.equal(glp.OPT)
+        expect(lp.getObjVal()).to.be.within(...nearly(ref.getObjVal(), 1000000))
+
+        // bound change keeps the basis dual feasible
+        lp.setRowBnds(1, glp.UP, 0.0, 50.0)
+        lp.resolve({}, function(err, ret) {
+            expect(err).to.be.null
+            expect(ret).to.equal(0)
+            let info = lp.sessionInfo()
+            expect(info.meth).to.equal(glp.DUAL)
+            expect(info.solves).to.equal(2)
+            expect(info.rebuilds).to.equal(1)
+            ref.setRowBnds(1, glp.UP, 0.0, 50.0)
+            ref.simplexSync({})
+            expect(lp.getStatus()).to.equal(glp.OPT)
+            expect(lp.getObjVal()).to.be.within(...nearly(ref.getObjVal(), 1000000))
+            lp.endSession()
+            expect(lp.sessionInfo().solves).to.equal(0)
+            done()
+        })
+    });
+})
+
+describe("Presolver tests", function() {
+    it('should postsolve reduced solutions after objective changes', function() {
+        let lp = setupSimplexLP()
+        let reduced = new glp.Problem()
+        let ps = new glp.Presolver()
+        expect(ps.presolveSync(lp, reduced, {sol: glp.SOL})).to.equal(0)
+        reduced.simplexSync({msgLev: glp.MSG_OFF})
+        ps.postsolveSync(lp, reduced)
+        expect(lp.getStatus()).to.equal(glp.OPT)
+        expect(lp.getObjVal()).to.be.within(...nearly(733 + 1/3, 1000000))
+
+        lp.setObjCoef(3, 20.0)
+        expect(ps.updateObjSync(lp, reduced)).to.equal(0)
+        reduced.simplexSync({msgLev: glp.MSG_OFF})
+        ps.postsolveSync(lp, reduced)
+        let ref = setupSimplexLP()
+        ref.setObjCoef(3, 20.0)
+        ref.simplexSync({msgLev: glp.MSG_OFF})
+        expect(lp.getStatus()).to.equal(glp.OPT)
+        expect(lp.getObjVal()).to.be.within(...nearly(ref.getObjVal(), 1000000))
+        ps.delete()
+    });
+
+    it('should presolve and postsolve a MIP asynchronously', function(done) {
+        let lp = setupSimplexLP()
+        lp.setColKind(2, glp.IV)
+        lp.setColKind(3, glp.IV)
+        let reduced = new glp.Problem()
+        let ps = new glp.Presolver()
+        ps.presolve(lp, reduced, {sol: glp.MIP}, function(err, ret) {
+            expect(err).to.be.null
+            expect(ret).to.equal(0)
+            reduced.simplexSync({msgLev: glp.MSG_OFF})
+            reduced.intoptSync({msgLev: glp.MSG_OFF})
+            ps.postsolve(lp, reduced, function(err) {
+                expect(err).to.be.null
+                expect(lp.mipStatus()).to.equal(glp.OPT)
+                expect(lp.mipObjVal()).to.equal(732)
+                done()
+            })
+        })
+    });
+})
+
+describe("Presolver reduction tests", function() {
+    // each problem below can be reduced only with the help of the
+    // reduction named in the test, so the size of the reduced problem
+    // shows that the reduction has been applied
+    function checkReduction(text, rows, cols) {
+        let file = require('path').join(temp.mkdirSync('glp_npp_test'), 'p.lp')
+        fs.writeFileSync(file, text)
+        let ref = new glp.Problem()
+        let lp = new glp.Problem()
+        expect(ref.readLpSync(file)).to.equal(0)
+        expect(lp.readLpSync(file)).to.equal(0)
+        let mip = lp.getNumInt() > 0
+        let reduced = new glp.Problem()
+        let ps = new glp.Presolver()
+        expect(ps.presolveSync(lp, reduced, {sol: mip ? glp.MIP : glp.SOL})).to.equal(0)
+        expect(reduced.getNumRows()).to.equal(rows)
+        expect(reduced.getNumCols()).to.equal(cols)
+        ref.simplexSync({msgLev: glp.MSG_OFF})
+        reduced.simplexSync({msgLev: glp.MSG_OFF})
+        if (mip) {
+            ref.intoptSync({msgLev: glp.MSG_OFF})
+            reduced.intoptSync({msgLev: glp.MSG_OFF})
+        }
+        ps.postsolveSync(lp, reduced)
+        if (mip) {
+            expect(lp.mipStatus()).to.equal(glp.OPT)
+            expect(lp.mipObjVal()).to.equal(ref.mipObjVal())
+            for (let j = 1; j <= lp.getNumCols(); j++)
+                expect(lp.mipColVal(j)).to.equal(ref.mipColVal(j))
+        } else {
+            expect(lp.getStatus()).to.equal(glp.OPT)
+            expect(lp.getObjVal()).to.be.within(...nearly(ref.getObjVal(), 1000000))
+            // the recovered basis is the same optimal basis
+            for (let i = 1; i <= lp.getNumRows(); i++)
+                expect(lp.getRowStat(i)).to.equal(ref.getRowStat(i))
+            for (let j = 1; j <= lp.getNumCols(); j++)
+                expect(lp.getColStat(j)).to.equal(ref.getColStat(j))
+        }
+        ps.delete()
+        reduced.delete()
+        lp.delete()
+        ref.delete()
+    }
+
+    it('should fix dominated columns', function() {
+        // x3 has a positive cost and may be decreased in every row
+        checkReduction(
+            'Minimize\n obj: - x1 - 2 x2 + x3\n' +
+            'Subject To\n' +
+            ' r1: x1 + x2 + x3 <= 4\n' +
+            ' r2: x1 + 3 x2 + 2 x3 <= 9\n' +
+            ' r3: x1 - x2 >= -1\n' +
+            'Bounds\n x1 <= 3\nEnd\n', 3, 2)
+    });
+
+    it('should remove duplicate rows and columns', function() {
+        // r2 = 2 * r1 with a tighter bound; x4 = 2 * x3 and costs more
+        checkReduction(
+            'Minimize\n obj: - x1 - 2 x2 + x3 + 3 x4\n' +
+            'Subject To\n' +
+            ' r1: x1 + x2 <= 4\n' +
+            ' r2: 2 x1 + 2 x2 <= 7\n' +
+            ' r3: x2 + x3 + 2 x4 <= 5\n' +
+            ' r4: x1 - x2 + x3 + 2 x4 >= 1\n' +
+            'Bounds\n x1 <= 3\nEnd\n', 3, 3)
+    });
+
+    it('should repeat global reductions after basic processing', function() {
+        // removing r2 leaves x5 as an implied slack of r1, after which
+        // r1 becomes parallel to r3
+        checkReduction(
+            'Minimize\n obj: - x1 - 2 x2 + x3\n' +
+            'Subject To\n' +
+            ' r1: x1 + x2 + x5 = 4\n' +
+            ' r2: 2 x1 + 2 x2 + 2 x5 <= 10\n' +
+            ' r3: 3 x1 + 3 x2 <= 11\n' +
+            ' r4: x1 - x2 + x3 >= 1\n' +
+            ' r5: x2 + x3 <= 5\n' +
+            'Bounds\n x1 <= 3\n x5 <= 1\nEnd\n', 3, 3)
+    });
+
+    it('should aggregate doubleton equations', function() {
+        checkReduction(
+            'Minimize\n obj: - x1 - x2 - 2 x3\n' +
+            'Subject To\n' +
+            ' r1: x1 - 2 x2 = 1\n' +
+            ' r2: x1 + x2 + x3 <= 6\n' +
+            ' r3: x1 + 3 x3 <= 7\n' +
+            ' r4: x2 + x3 <= 4\n' +
+            'Bounds\n x1 <= 5\nEnd\n', 3, 2)
+    });
+
+    it('should fix binary columns by probing', function() {
+        // x1 = 1 implies x2 = x3 = 0, so r3 cannot be satisfied
+        checkReduction(
+            'Maximize\n obj: 3 x1 + 2 x2 + 2 x3 + x4\n' +
+            'Subject To\n' +
+            ' r1: x1 + x2 <= 1\n' +
+            ' r2: x1 + x3 <= 1\n' +
+            ' r3: x2 + x3 + x4 >= 2\n' +
+            ' r4: x2 + 2 x3 + 3 x4 <= 5\n' +
+            'Binary\n x1 x2 x3 x4\nEnd\n', 2, 3)
+    });
+})
+
+describe("Compiled Mathprog model tests", function() {
+    function writeFile(dir, name, text) {
+        let file = require('path').join(dir, name)
+        fs.writeFileSync(file, text)
+        return file
+    }
+
+    function solve(mpl, dat) {
+        let lp = new glp.Problem()
+        expect(mpl.readDataSync(dat)).to.equal(0)
+        expect(mpl.generateSync()).to.equal(0)
+        mpl.buildProbSync(lp)
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        let z = lp.getObjVal()
+        lp.delete()
+        return z
+    }
+
+    it('should instantiate a compiled model with several data sets', function() {
+        let dir = temp.mkdirSync('glp_mpl_model_test')
+        let mod = writeFile(dir, 'm.mod',
+            'param n integer > 0;\n' +
+            'param c{1..n};\n' +
+            'var x{1..n} >= 0, <= 1;\n' +
+            'maximize z: sum{j in 1..n} c[j] * x[j];\n' +
+            's.t. cap: sum{j in 1..n} x[j] <= 2;\n' +
+            'end;\n')
+        let dat1 = writeFile(dir, 'a.dat', 'data; param n := 3; param c := 1 5 2 7 3 1; end;\n')
+        let dat2 = writeFile(dir, 'b.dat', 'data; param n := 2; param c := 1 2 2 4; end;\n')
+
+        let model = new glp.MathprogModel()
+        expect(model.compileSync(mod)).to.equal(0)
+        expect(model.idle()).to.equal(1)
+
+        let first = new glp.Mathprog(model)
+        let second = new glp.Mathprog(model)
+        expect(model.idle()).to.equal(0)
+        expect(solve(first, dat1)).to.equal(12)
+        expect(solve(second, dat2)).to.equal(6)
+        first.delete()
+        second.delete()
+        expect(model.idle()).to.equal(2)
+
+        // a reused workspace keeps the model but none of the previous data
+        let again = new glp.Mathprog(model)
+        expect(model.idle()).to.equal(1)
+        expect(solve(again, dat2)).to.equal(6)
+        again.delete()
+        model.delete()
+    });
+
+    it('should generate instances of a compiled model concurrently', function(done) {
+        let dir = temp.mkdirSync('glp_mpl_model_test')
+        let mod = writeFile(dir, 'm.mod',
+            'param n integer > 0;\n' +
+            'var x{1..n} >= 0, <= 1;\n' +
+            'maximize z: sum{j in 1..n} j * x[j];\n' +
+            's.t. cap{i in 1..n}: sum{j in 1..n: j <> i} x[j] <= n - 1;\n' +
+            'end;\n')
+        let model = new glp.MathprogModel()
+        model.compile(mod, function(err, ret) {
+            expect(err).to.be.null
+            expect(ret).to.equal(0)
+            let sizes = [10, 20, 30]
+            let pending = sizes.length
+            sizes.forEach(function(n) {
+                let mpl = new glp.Mathprog(model)
+                expect(mpl.readDataSync(writeFile(dir, n + '.dat', 'data; param n := ' + n + '; end;\n'))).to.equal(0)
+                mpl.generate(null, function(err, ret) {
+                    expect(err).to.be.null
+                    expect(ret).to.equal(0)
+                    let lp = new glp.Problem()
+                    mpl.buildProbSync(lp)
+                    expect(lp.getNumRows()).to.equal(n + 1)
+                    mpl.delete()
+                    lp.delete()
+                    if (--pending == 0) {
+                        expect(model.idle()).to.equal(sizes.length)
+                        model.delete()
+                        done()
+                    }
+                })
+            })
+        })
+    });
+})
+
+describe("Mathprog direct data tests", function() {
+    it('should generate the same instance from injected data as from a data section', function() {
+        let dir = temp.mkdirSync('glp_mpl_data_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod,
+            'set S;\n' +
+            'set E within S cross S;\n' +
+            'param c{E};\n' +
+            'param cap{S} default 2;\n' +
+            'param name symbolic;\n' +
+            'var x{E} >= 0, <= 1;\n' +
+            'maximize z: sum{(i,j) in E} c[i,j] * x[i,j];\n' +
+            's.t. out{i in S}: sum{(i,j) in E} x[i,j] <= cap[i];\n' +
+            'end;\n')
+        let dat = require('path').join(dir, 'm.dat')
+        fs.writeFileSync(dat,
+            'data;\n' +
+            'set S := a b c;\n' +
+            'set E := (a,b) (a,c) (b,c) (c,a);\n' +
+            'param c := [a,b] 3 [a,c] 1.5 [b,c] 2 [c,a] 4;\n' +
+            'param cap := a 1;\n' +
+            'param name := test;\n' +
+            'end;\n')
+
+        function objective(mpl) {
+            let lp = new glp.Problem()
+            expect(mpl.generateSync()).to.equal(0)
+            mpl.buildProbSync(lp)
+            lp.simplexSync({msgLev: glp.MSG_OFF})
+            let z = lp.getObjVal()
+            lp.delete()
+            mpl.delete()
+            return z
+        }
+
+        let ref = new glp.Mathprog()
+        expect(ref.readModelSync(mod, glp.ON)).to.equal(0)
+        expect(ref.readDataSync(dat)).to.equal(0)
+
+        // arrays are indexed from 1, like the other arrays passed to GLPK
+        let mpl = new glp.Mathprog()
+        expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+        expect(mpl.putSetDataSync('S', 1, [0, 'a', 'b', 'c'])).to.equal(0)
+        expect(mpl.putSetDataSync('E', 2, [0, 'a', 'b', 'a', 'c', 'b', 'c', 'c', 'a'])).to.equal(0)
+        expect(mpl.putParDataSync('c', 2, [0, 'a', 'b', 'a', 'c', 'b', 'c', 'c', 'a'],
+            new Float64Array([0, 3, 1.5, 2, 4]))).to.equal(0)
+        expect(mpl.putParDataSync('cap', 1, [0, 'a'], new Float64Array([0, 1]))).to.equal(0)
+        expect(mpl.putParDataSync('name', 0, null, [0, 'test'])).to.equal(0)
+        expect(objective(mpl)).to.equal(objective(ref))
+    });
+
+    it('should report invalid injected data', function() {
+        let dir = temp.mkdirSync('glp_mpl_data_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod, 'param n integer > 0;\nvar x >= 0, <= n;\nmaximize z: x;\nend;\n')
+        let mpl = new glp.Mathprog()
+        expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+        expect(() => mpl.putParDataSync('n', 1, null, new Float64Array([0, 1]))).to.throw()
+        expect(mpl.putParDataSync('n', 0, null, [0, 'one'])).to.equal(1)
+        expect(mpl.getLastError()).to.equal('n requires numeric data')
+        mpl.delete()
+    });
+})
+
+describe("Parallel Mathprog generation tests", function() {
+    it('should number rows and columns as the serial generation', function() {
+        let dir = temp.mkdirSync('glp_mpl_par_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod,
+            'param n := 300;\n' +
+            'set E := setof{i in 1..20, j in 1..n: (i * 7 + j * 13) mod 5 <> 0} (i, j);\n' +
+            'param c{(i,j) in E} := (i * 31 + j * 17) mod 23 + 1;\n' +
+            'var x{E} >= 0, <= 1;\n' +
+            'var y{j in 1..n} >= 0, <= j mod 3;\n' +
+            'minimize obj: sum{(i,j) in E} c[i,j] * x[i,j] + sum{j in 1..n} y[j];\n' +
+            's.t. cap{i in 1..20}: sum{(i,j) in E} x[i,j] <= 40;\n' +
+            's.t. asg{j in 1..n}: sum{(i,j) in E} x[i,j] + y[n + 1 - j] = 1;\n' +
+            'end;\n')
+
+        function generate(threads) {
+            let mpl = new glp.Mathprog()
+            let lp = new glp.Problem()
+            let file = require('path').join(dir, 'm' + threads + '.lp')
+            expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+            mpl.setThreads(threads)
+            expect(mpl.generateSync()).to.equal(0)
+            if (threads > 1)
+                expect(mpl.getParCount()).to.equal(1 + 20 + 300)
+            else
+                expect(mpl.getParCount()).to.equal(0)
+            mpl.buildProbSync(lp)
+            expect(lp.writeLpSync(file)).to.equal(0)
+            lp.delete()
+            mpl.delete()
+            return fs.readFileSync(file, 'utf8')
+        }
+
+        expect(generate(4)).to.equal(generate(1))
+    });
+})
+
+describe("Mathprog bulk build tests", function() {
+    it('should build the same problem without names', function() {
+        let dir = temp.mkdirSync('glp_mpl_build_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod,
+            'set I := 1..30;\n' +
+            'var x{i in I} >= 0, <= i;\n' +
+            'var y{I} binary;\n' +
+            'maximize z: sum{i in I} (i mod 7 + 1) * x[i] - sum{i in I} y[i] + 5;\n' +
+            's.t. cap{k in 1..10}: sum{i in I: i mod k = 0} (x[i] + 0 * y[i]) <= 3 * k;\n' +
+            's.t. lnk{i in I}: x[i] <= i * y[i];\n' +
+            'end;\n')
+
+        function build(options) {
+            let mpl = new glp.Mathprog()
+            let lp = new glp.Problem()
+            expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+            expect(mpl.generateSync()).to.equal(0)
+            if (options) mpl.buildProbSync(lp, options); else mpl.buildProbSync(lp)
+            lp.intoptSync({msgLev: glp.MSG_OFF, presolve: glp.ON})
+            let res = {rows: lp.getNumRows(), cols: lp.getNumCols(), nz: lp.getNumNz(),
+                obj: lp.mipObjVal(), row: lp.getRowName(2), col: lp.getColName(3)}
+            lp.delete()
+            mpl.delete()
+            return res
+        }
+
+        let named = build(), bare = build({names: false})
+        expect(named.row).to.equal('cap[1]')
+        expect(named.col).to.equal('x[3]')
+        expect(bare.row).to.equal('')
+        expect(bare.col).to.equal('')
+        for (let key of ['rows', 'cols', 'nz', 'obj'])
+            expect(bare[key]).to.equal(named[key])
+        expect(() => new glp.Mathprog().buildProbSync(new glp.Problem(), {foo: 1})).to.throw()
+    });
+
+    it('should release the generated content after building', function() {
+        let dir = temp.mkdirSync('glp_mpl_release_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod,
+            'param n := 500;\n' +
+            'var x{1..n} >= 0, <= 1;\n' +
+            'maximize z: sum{j in 1..n} (j mod 11) * x[j];\n' +
+            's.t. c{i in 1..n}: x[i] + x[(i mod n) + 1] <= 1;\n' +
+            'solve;\n' +
+            'end;\n')
+        let mpl = new glp.Mathprog()
+        let lp = new glp.Problem()
+        expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+        expect(mpl.generateSync()).to.equal(0)
+        let before = mpl.memStats()
+        expect(before.pools.members.count).to.be.above(0)
+        expect(before.pools.formulae.total).to.be.above(0)
+
+        mpl.buildProbSync(lp, {release: true})
+        let after = mpl.memStats()
+        expect(lp.getNumRows()).to.equal(501)
+        for (let name of ['strings', 'symbols', 'tuples', 'members', 'elemvars', 'formulae', 'elemcons'])
+            expect(after.pools[name].total).to.equal(0)
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        expect(() => mpl.postsolveSync(lp, glp.SOL)).to.throw()
+        lp.delete()
+        mpl.delete()
+    });
+})
+
+describe("Mathprog output tests", function() {
+    it('should collect display output and JS tables', function() {
+        let dir = temp.mkdirSync('glp_mpl_output_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod,
+            'set J := 1..5;\n' +
+            'var x{j in J} >= 0, <= j;\n' +
+            'maximize z: sum{j in J} x[j];\n' +
+            's.t. c: sum{j in J} x[j] <= 12;\n' +
+            'printf "size %d\\n", card(J);\n' +
+            'solve;\n' +
+            'display x;\n' +
+            'table res{j in J} OUT "JS": j ~ idx, ("x" & j) ~ name, x[j] ~ val;\n' +
+            'end;\n')
+        let mpl = new glp.Mathprog()
+        let lp = new glp.Problem()
+        mpl.setOutput('buffer')
+        expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+        expect(mpl.generateSync()).to.equal(0)
+        expect(mpl.takeOutput().toString()).to.equal('size 5\n')
+        mpl.buildProbSync(lp)
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        expect(mpl.postsolveSync(lp, glp.SOL)).to.equal(0)
+
+        let text = mpl.takeOutput().toString()
+        expect(text).to.contain('Display statement at line 7')
+        expect(text).to.contain('x[5].val = ')
+        expect(mpl.takeOutput().length).to.equal(0)
+        let tables = mpl.takeTables()
+        expect(tables.length).to.equal(1)
+        expect(tables[0].table).to.equal('res')
+        expect(tables[0].fields).to.deep.equal(['idx', 'name', 'val'])
+        expect(tables[0].rows).to.equal(5)
+        expect(tables[0].columns[0]).to.be.an.instanceof(Float64Array)
+        expect(Array.from(tables[0].columns[0])).to.deep.equal([1, 2, 3, 4, 5])
+        expect(tables[0].columns[1]).to.deep.equal(['x1', 'x2', 'x3', 'x4', 'x5'])
+        let sum = Array.from(tables[0].columns[2]).reduce((a, b) => a + b, 0)
+        expect(sum).to.equal(lp.getObjVal())
+        expect(mpl.takeTables().length).to.equal(0)
+        expect(() => mpl.setOutput('file')).to.throw()
+        lp.delete()
+        mpl.delete()
+    });
+})
+
+describe("Mathprog update tests", function() {
+    it('should update the problem instance after parameter changes', function(done) {
+        let dir = temp.mkdirSync('glp_mpl_update_test')
+        let mod = require('path').join(dir, 'm.mod')
+        fs.writeFileSync(mod,
+            'set J := 1..3;\n' +
+            'param u{J};\n' +
+            'param w{J};\n' +
+            'param cap;\n' +
+            'param half := cap / 2;\n' +
+            'var x{j in J} >= 0, <= u[j];\n' +
+            'maximize z: sum{j in J} w[j] * x[j];\n' +
+            's.t. c: sum{j in J} x[j] <= cap;\n' +
+            's.t. d: x[1] + x[2] <= half;\n' +
+            'end;\n')
+
+        function generate(u, w, cap) {
+            let mpl = new glp.Mathprog()
+            let lp = new glp.Problem()
+            expect(mpl.readModelSync(mod, glp.ON)).to.equal(0)
+            expect(mpl.putParDataSync('u', 1, new Float64Array([0, 1, 2, 3]), new Float64Array(u))).to.equal(0)
+            expect(mpl.putParDataSync('w', 1, new Float64Array([0, 1, 2, 3]), new Float64Array(w))).to.equal(0)
+            expect(mpl.putParDataSync('cap', 0, null, new Float64Array(cap))).to.equal(0)
+            expect(mpl.generateSync()).to.equal(0)
+            mpl.buildProbSync(lp)
+            lp.simplexSync({msgLev: glp.MSG_OFF})
+            return {mpl: mpl, lp: lp}
+        }
+
+        let ref = generate([0, 4, 6, 2], [0, 1, 3, 2], [0, 12])
+        let inst = generate([0, 4, 5, 2], [0, 3, 3, 2], [0, 8])
+        let mpl = inst.mpl, lp = inst.lp
+        let stats = [1, 2, 3].map(i => lp.getRowStat(i))
+        expect(mpl.updateParDataSync('u', 1, [0, 2], [0, 6])).to.equal(0)
+        expect(mpl.updateParDataSync('w', 1, [0, 1], [0, 1])).to.equal(0)
+        expect(mpl.updateParDataSync('cap', 0, null, [0, 12])).to.equal(0)
+        expect(mpl.updateSync(lp)).to.equal(0)
+        expect(lp.getColUb(2)).to.equal(6)
+        expect(lp.getObjCoef(1)).to.equal(1)
+        expect(lp.getRowUb(2)).to.equal(12)
+        expect(lp.getRowUb(3)).to.equal(6)
+        // only bounds and coefficients change, the basis is kept
+        expect([1, 2, 3].map(i => lp.getRowStat(i))).to.deep.equal(stats)
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        expect(lp.getObjVal()).to.equal(ref.lp.getObjVal())
+
+        expect(mpl.updateParDataSync('u', 1, [0, 3], [0, 1])).to.equal(0)
+        mpl.update(lp, function(err, ret) {
+            expect(err).to.be.null
+            expect(ret).to.equal(0)
+            expect(lp.getColUb(3)).to.equal(1)
+            expect(mpl.updateParDataSync('x', 0, null, [0, 1])).to.equal(1)
+            expect(mpl.getLastError()).to.equal('x not a parameter')
+            lp.delete()
+            mpl.delete()
+            ref.lp.delete()
+            ref.mpl.delete()
+            done()
+        })
+    });
+})
+
+describe("Basis cache tests", function() {
+    it('should warm start structurally identical problems', function() {
+        glp.setBasisCache({maxEntries: 10})
+        glp.clearBasisCache()
+        let first = setupSimplexLP()
+        first.simplexSync({})
+        let second = setupSimplexLP()
+        second.simplexSync({})
+        let stats = glp.basisCacheStats()
+        glp.setBasisCache({maxEntries: 0})
+
+        expect(second.getStatus()).to.equal(glp.OPT)
+        expect(second.getObjVal()).to.be.within(...(nearly(733 + 1/3)))
+        expect(second.getItCnt()).to.equal(0)
+        expect(stats.hits).to.equal(1)
+        expect(stats.misses).to.equal(1)
+        expect(stats.entries).to.equal(1)
+        expect(glp.basisCacheStats().entries).to.equal(0)
+        glp.clearBasisCache()
+        expect(glp.basisCacheStats().hits).to.equal(0)
+        expect(glp.basisCacheStats().misses).to.equal(0)
+    });
+
+    it('should keep a basis set by the user', function() {
+        glp.setBasisCache({maxEntries: 10})
+        glp.clearBasisCache()
+        let first = setupSimplexLP()
+        first.simplexSync({msgLev: glp.MSG_OFF})
+        let second = setupSimplexLP()
+        // x1 basic instead of the slack of row q, which is feasible but not optimal
+        second.setRowStat(2, glp.NU)
+        second.setColStat(1, glp.BS)
+        second.simplexSync({msgLev: glp.MSG_OFF, itLim: 0})
+        let stats = glp.basisCacheStats()
+        expect(second.getRowStat(2)).to.equal(glp.NU)
+        expect(second.getColStat(1)).to.equal(glp.BS)
+        let third = setupSimplexLP()
+        third.stdBasis()
+        third.simplexSync({msgLev: glp.MSG_OFF})
+        glp.setBasisCache({maxEntries: 0})
+        glp.clearBasisCache()
+
+        expect(stats.hits).to.equal(0)
+        expect(third.getStatus()).to.equal(glp.OPT)
+        expect(third.getObjVal()).to.be.within(...(nearly(733 + 1/3)))
+        expect(third.getItCnt()).to.be.above(0)
+    });
+})
+
 describe("Exact problem tests", function() {
     it('should get the correct answer', function(done) {
         this.timeout(10000)
@@ -58,6 +654,30 @@ describe("Exact problem tests", function() {
 
 
 describe("Intopt problem tests", function() {
+    // multidimensional knapsack with 40 binary columns, whose search tree
+    // has a few hundred subproblems
+    function setupKnapsackLP() {
+        let dir = temp.mkdirSync('glp_knap_test')
+        let mod = require('path').join(dir, 'knap.mod')
+        fs.writeFileSync(mod,
+            'param m := 5;\n' +
+            'param n := 40;\n' +
+            'param w{i in 1..m, j in 1..n} := round(Uniform(10, 100));\n' +
+            'param p{j in 1..n} := round(Uniform(20, 80));\n' +
+            'var x{1..n} binary;\n' +
+            'maximize obj: sum{j in 1..n} p[j] * x[j];\n' +
+            's.t. cap{i in 1..m}: sum{j in 1..n} w[i,j] * x[j] <= sum{j in 1..n} w[i,j] / 2;\n' +
+            'end;\n')
+        let mpl = new glp.Mathprog()
+        let lp = new glp.Problem()
+        expect(mpl.readModelSync(mod, glp.OFF)).to.equal(0)
+        expect(mpl.generateSync()).to.equal(0)
+        mpl.buildProbSync(lp)
+        mpl.delete()
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        return lp
+    }
+
     it('should get the correct answer', function(done) {
         this.timeout(10000)
         // LP inspired by sample.c in the glpk distribution
@@ -118,6 +738,345 @@ describe("Intopt problem tests", function() {
             })
         })
     });
+
+    it('should get the same answer with several search threads', function() {
+        this.timeout(20000)
+        // returns the number of subproblems from the last progress line,
+        // and the numbers processed by each search thread, if any
+        function solve(threads, detMode) {
+            let lp = setupKnapsackLP()
+            let result = {nodes: 0, workers: []}
+            lp.on('log', function(msg) {
+                let m = /\(0; (\d+)\)/.exec(msg)
+                if (m) result.nodes = parseInt(m[1])
+                m = /^Parallel search: \d+ subproblems processed \((.*)\)/.exec(msg)
+                if (m) result.workers = m[1].split(', ').map(Number)
+            })
+            lp.intoptSync({msgLev: glp.MSG_ALL, threads: threads,
+                detMode: detMode, brTech: glp.BR_PCH, btTech: glp.BT_BLB})
+            expect(lp.mipStatus()).to.equal(glp.OPT)
+            result.obj = lp.mipObjVal()
+            lp.delete()
+            return result
+        }
+
+        let serial = solve(1, glp.OFF)
+        expect(serial.nodes).to.be.above(100)
+        expect(serial.workers.length).to.equal(0)
+        for (let detMode of [glp.OFF, glp.ON]) {
+            let result = solve(4, detMode)
+            expect(result.obj).to.equal(serial.obj)
+            expect(result.workers.length).to.equal(4)
+            // the threads share one tree, so the search is about as large
+            // as the serial one rather than four times larger
+            expect(result.nodes).to.be.within(serial.nodes / 2, serial.nodes * 2)
+            if (detMode == glp.ON) {
+                for (let cnt of result.workers)
+                    expect(cnt).to.be.above(0)
+                expect(solve(4, detMode)).to.equal(result)
+            }
+        }
+    });
+
+    it('should get the same answer with a subproblem memory limit', function() {
+        this.timeout(10000)
+        function solve(nodeMem) {
+            let lp = setupKnapsackLP()
+            let spilled = 0
+            function callback(tree) {
+                spilled = Math.max(spilled, tree.spillCount())
+            }
+            lp.intoptSync({msgLev: glp.MSG_OFF, nodeMem: nodeMem, cbFunc: callback,
+                cbReasons: glp.FSELECT})
+            expect(lp.mipStatus()).to.equal(glp.OPT)
+            let result = {obj: lp.mipObjVal(), spilled: spilled}
+            lp.delete()
+            return result
+        }
+
+        let unlimited = solve(0)
+        // 1 Kb holds only a small part of the subproblem data
+        let limited = solve(1)
+        expect(unlimited.spilled).to.equal(0)
+        expect(limited.spilled).to.be.above(0)
+        expect(limited.obj).to.equal(unlimited.obj)
+    });
+
+    it('should solve MIP with reliability branching', function() {
+        this.timeout(20000)
+        let serial = setupKnapsackLP()
+        serial.intoptSync({msgLev: glp.MSG_OFF})
+
+        // returns the number of candidates evaluated by strong branching
+        function solve(parm) {
+            let lp = setupKnapsackLP()
+            let evaluated = 0
+            lp.on('log', function(msg) {
+                let m = /(\d+) candidates evaluated by strong branching/.exec(msg)
+                if (m) evaluated += parseInt(m[1])
+            })
+            lp.intoptSync(Object.assign({msgLev: glp.MSG_DBG, brTech: glp.BR_RLB}, parm))
+            expect(lp.mipStatus()).to.equal(glp.OPT)
+            expect(lp.mipObjVal()).to.equal(serial.mipObjVal())
+            lp.delete()
+            return evaluated
+        }
+
+        expect(solve({threads: 1})).to.be.above(0)
+        // candidates of the root subproblem are evaluated concurrently
+        expect(solve({threads: 4})).to.be.above(0)
+        // with relLim = 0 candidates are chosen by pseudocosts only
+        expect(solve({relLim: 0})).to.equal(0)
+        serial.delete()
+    });
+
+    it('should solve MIP with cuts generated concurrently', function() {
+        this.timeout(20000)
+        // returns cut rows present in the subproblem each time it is
+        // branched; the callback keeps the tree search serial, so only
+        // cut generation depends on the number of threads
+        function solve(threads) {
+            let lp = setupKnapsackLP()
+            let m = lp.getNumRows()
+            let cuts = []
+            function callback(tree) {
+                if (tree.reason() != glp.IBRANCH) return
+                for (let i = m + 1; i <= lp.getNumRows(); i++) {
+                    lp.getMatRow(i, function(ind, val) {
+                        cuts.push([lp.getRowLb(i), lp.getRowUb(i),
+                            Array.from(ind), Array.from(val)])
+                    })
+                }
+            }
+            lp.intoptSync({msgLev: glp.MSG_OFF, threads: threads, gmiCuts: glp.ON,
+                mirCuts: glp.ON, covCuts: glp.ON, clqCuts: glp.ON,
+                cbFunc: callback, cbReasons: glp.FBRANCH})
+            expect(lp.mipStatus()).to.equal(glp.OPT)
+            let result = {obj: lp.mipObjVal(), cuts: cuts}
+            lp.delete()
+            return result
+        }
+
+        let serial = solve(1)
+        expect(serial.cuts.length).to.be.above(0)
+        expect(solve(4)).to.equal(serial)
+    });
+
+    it('should report global cut pool statistics', function() {
+        this.timeout(20000)
+        let serial = setupKnapsackLP()
+        serial.intoptSync({msgLev: glp.MSG_OFF})
+
+        let lp = setupKnapsackLP()
+        let stats = null
+        function callback(tree) {
+            stats = tree.globalPoolStats()
+        }
+        lp.intoptSync({msgLev: glp.MSG_OFF, gmiCuts: glp.ON, mirCuts: glp.ON,
+            covCuts: glp.ON, cutPool: 100, cbFunc: callback})
+
+        expect(lp.mipStatus()).to.equal(glp.OPT)
+        expect(lp.mipObjVal()).to.equal(serial.mipObjVal())
+        expect(stats.size).to.be.within(1, 100)
+        expect(stats.added).to.be.at.least(stats.size)
+        // the same cuts are generated again in other subproblems, and
+        // pooled ones are brought back into subproblems they cut off
+        expect(stats.duplicates + stats.reused).to.be.above(0)
+        expect(stats.duplicates).to.be.at.most(stats.added)
+        serial.delete()
+        lp.delete()
+    });
+
+    it('should select the subproblem with the best local bound', function() {
+        this.timeout(10000)
+        let mod = require('path').join(testRoot, 'examples', 'gap.mod')
+        for (let btTech of [glp.BT_BLB, glp.BT_BPH]) {
+            let mpl = new glp.Mathprog()
+            let lp = new glp.Problem()
+            expect(mpl.readModelSync(mod, glp.OFF)).to.equal(0)
+            expect(mpl.generateSync()).to.equal(0)
+            mpl.buildProbSync(lp)
+            lp.simplexSync({msgLev: glp.MSG_OFF})
+            let selections = 0
+            function callback(tree) {
+                if (tree.reason() != glp.ISELECT) return
+                // the best node must agree with a scan of the active list
+                let best = 0
+                for (let p = tree.nextNode(0); p != 0; p = tree.nextNode(p))
+                    if (best == 0 || tree.nodeBound(p) < tree.nodeBound(best))
+                        best = p
+                expect(tree.nodeBound(tree.bestNode())).to.equal(tree.nodeBound(best))
+                selections++
+            }
+            lp.intoptSync({msgLev: glp.MSG_OFF, btTech: btTech, cbFunc: callback,
+                cbReasons: glp.FSELECT})
+
+            expect(lp.mipStatus()).to.equal(glp.OPT)
+            expect(lp.mipObjVal()).to.equal(261)
+            expect(selections).to.be.above(1)
+            lp.delete()
+            mpl.delete()
+        }
+    });
+
+    it('should race several MIP searches sharing the incumbent', function(done) {
+        this.timeout(20000)
+        let serial = setupKnapsackLP()
+        serial.intoptSync({msgLev: glp.MSG_OFF})
+
+        let lp = setupKnapsackLP()
+        lp.intoptRace({intopt: {msgLev: glp.MSG_OFF}, racers: 6}, function(err, result) {
+            expect(err).to.equal(null)
+            expect(result.ret).to.equal(0)
+            expect(result.status).to.equal(glp.OPT)
+            expect(["default", "pseudocost", "reliability", "depth", "cuts",
+                "proximity"]).to.include(result.preset)
+            expect(result.source).to.be.within(0, 5)
+            expect(lp.mipObjVal()).to.equal(serial.mipObjVal())
+
+            // the race stops once any racer reaches the gap tolerance
+            let result2 = lp.intoptRaceSync({intopt: {msgLev: glp.MSG_OFF, mipGap: 0.05}, racers: 6})
+            expect([0, glp.EMIPGAP]).to.include(result2.ret)
+            expect(result2.racer).to.be.within(0, 5)
+            expect(lp.mipObjVal()).to.be.within(serial.mipObjVal() * 0.95, serial.mipObjVal())
+            serial.delete()
+            lp.delete()
+            done()
+        })
+    });
+
+    // solves the knapsack with a sub-MIP heuristic and returns the number of
+    // sub-MIPs solved and of incumbents they improved
+    function solveSubMip(name, parm) {
+        let lp = setupKnapsackLP()
+        let result = {subMips: 0, improved: 0}
+        let pending = false
+        lp.on('log', function(msg) {
+            // a solution passed by the heuristic is reported only if it is
+            // better than the incumbent
+            if (pending && msg.indexOf('Solution found by heuristic') >= 0)
+                result.improved++
+            pending = msg.indexOf(name + ': sub-MIP') >= 0
+            if (pending) result.subMips++
+        })
+        lp.intoptSync(Object.assign({msgLev: glp.MSG_DBG}, parm))
+        expect(lp.mipStatus()).to.equal(glp.OPT)
+        result.obj = lp.mipObjVal()
+        lp.delete()
+        return result
+    }
+
+    it('should improve the incumbent with RINS', function() {
+        this.timeout(20000)
+        let serial = setupKnapsackLP()
+        serial.intoptSync({msgLev: glp.MSG_OFF})
+
+        let result = solveSubMip('RINS', {rinsHeur: glp.ON, subFreq: 1,
+            subNodes: 50, subTmLim: 1000})
+        expect(result.subMips).to.be.above(0)
+        expect(result.improved).to.be.above(0)
+        expect(result.obj).to.equal(serial.mipObjVal())
+        serial.delete()
+    });
+
+    it('should search the neighborhood of the incumbent with local branching', function() {
+        this.timeout(20000)
+        let serial = setupKnapsackLP()
+        serial.intoptSync({msgLev: glp.MSG_OFF})
+
+        let result = solveSubMip('Local branching', {lbHeur: glp.ON})
+        expect(result.subMips).to.be.above(0)
+        expect(result.improved).to.be.above(0)
+        expect(result.obj).to.equal(serial.mipObjVal())
+        serial.delete()
+    });
+
+    it('should collect the best integer solutions in the pool', function() {
+        this.timeout(20000)
+        let serial = setupKnapsackLP()
+        serial.intoptSync({msgLev: glp.MSG_OFF})
+
+        let lp = setupKnapsackLP()
+        lp.intoptSync({msgLev: glp.MSG_OFF, solPool: 5, poolDiv: 3})
+
+        let pool = lp.mipSolutions()
+        let n = lp.getNumCols()
+        expect(lp.mipObjVal()).to.equal(serial.mipObjVal())
+        expect(pool.count).to.be.within(2, 5)
+        expect(pool.n).to.equal(n)
+        expect(pool.obj[0]).to.equal(serial.mipObjVal())
+        expect(pool.x.length).to.equal(pool.count * n)
+        for (let k = 0; k < pool.count; k++) {
+            // the objective is maximized, so the best solution is the first
+            if (k > 0) expect(pool.obj[k]).to.be.at.most(pool.obj[k - 1])
+            let obj = 0
+            for (let j = 0; j < n; j++) {
+                expect([0, 1]).to.include(pool.x[k * n + j])
+                obj += lp.getObjCoef(j + 1) * pool.x[k * n + j]
+            }
+            expect(obj).to.equal(pool.obj[k])
+            // any two pooled solutions differ in at least poolDiv columns
+            for (let t = 0; t < k; t++) {
+                let diff = 0
+                for (let j = 0; j < n; j++)
+                    if (pool.x[k * n + j] != pool.x[t * n + j]) diff++
+                expect(diff).to.be.at.least(3)
+            }
+        }
+        expect(() => lp.mipSolutions(1)).to.throw("Wrong number of arguments")
+        serial.delete()
+        lp.delete()
+    });
+
+    it('should resume the search from a checkpoint', function() {
+        this.timeout(20000)
+        let ckpt = require('path').join(temp.mkdirSync('glp_ckpt_test'), 'search.ckpt')
+        // counts subproblems processed; once an incumbent exists, the
+        // search is terminated after the given number of subproblems
+        function solve(parm, limit) {
+            let lp = setupKnapsackLP()
+            let result = {nodes: 0, first: null}
+            let found = false
+            function callback(tree) {
+                if (tree.reason() == glp.IBINGO)
+                    found = true
+                else if (tree.reason() == glp.IPREPRO) {
+                    result.nodes++
+                    if (limit && found && result.nodes >= limit) tree.terminate()
+                }
+            }
+            lp.on('log', function(msg) {
+                let m = /mip =\s+(\S+)/.exec(msg)
+                if (m && result.first === null) result.first = m[1]
+            })
+            lp.intoptSync(Object.assign({msgLev: glp.MSG_ON, cbFunc: callback,
+                cbReasons: glp.FPREPRO | glp.FBINGO}, parm))
+            result.status = lp.mipStatus()
+            result.obj = lp.mipObjVal()
+            lp.delete()
+            return result
+        }
+
+        let cold = solve({}, 0)
+        expect(cold.status).to.equal(glp.OPT)
+
+        let stopped = solve({ckptFile: ckpt}, 100)
+        expect(stopped.status).to.equal(glp.FEAS)
+        expect(fs.existsSync(ckpt)).to.be.true()
+
+        let resumed = solve({resumeFrom: ckpt}, 0)
+        expect(resumed.status).to.equal(glp.OPT)
+        expect(resumed.obj).to.equal(cold.obj)
+        // the saved incumbent is reported before any new one is found
+        expect(parseFloat(resumed.first)).to.equal(stopped.obj)
+        // and the explored part of the tree is not searched again
+        expect(resumed.nodes).to.be.below(cold.nodes)
+    });
+
+    it('should reject callbacks in a MIP race', function() {
+        let lp = setupSimplexLP()
+        expect(() => lp.intoptRaceSync({intopt: {cbFunc: function() {}}})).to.throw("intopt.cbFunc: not supported")
+    });
 })
 
 describe("Interior point problem tests", function() {
@@ -140,6 +1099,105 @@ describe("Interior point problem tests", function() {
             done()
         })
     });
+
+    it('should recover an optimal basis with crossover', function() {
+        let lp = setupSimplexLP()
+        lp.interiorSync({msgLev: glp.MSG_OFF})
+        expect(lp.iptXret()).to.equal(-1)
+        lp.interiorSync({msgLev: glp.MSG_OFF, crossover: glp.ON})
+        expect(lp.iptXret()).to.equal(0)
+        let it = lp.getItCnt()
+
+        expect(lp.iptStatus()).to.equal(glp.OPT)
+        expect(lp.getStatus()).to.equal(glp.OPT)
+        expect(lp.getObjVal()).to.be.within(...(nearly(733 + 1/3)))
+        expect(lp.getColStat(3)).to.equal(glp.NL)
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        expect(lp.getItCnt()).to.equal(it)
+    });
+
+    it('should finish crossover in fewer iterations than a cold simplex', function() {
+        this.timeout(20000)
+        let mps = require('path').join(testRoot, 'examples', '25fv47.mps')
+        function load() {
+            let lp = new glp.Problem()
+            expect(lp.readMpsSync(glp.MPS_DECK, null, mps)).to.equal(0)
+            return lp
+        }
+        let lp = load()
+        lp.interiorSync({msgLev: glp.MSG_OFF, crossover: glp.ON})
+        expect(lp.getStatus()).to.equal(glp.OPT)
+        expect(lp.getObjVal()).to.be.within(...(nearly(5501.8459, 1000)))
+
+        for (let meth of [glp.PRIMAL, glp.DUALP]) {
+            let cold = load()
+            cold.simplexSync({msgLev: glp.MSG_OFF, meth: meth})
+            expect(cold.getObjVal()).to.be.within(...(nearly(lp.getObjVal(), 1000)))
+            expect(lp.getItCnt()).to.be.below(cold.getItCnt())
+            cold.delete()
+        }
+        lp.delete()
+    });
+
+    it('should get the same answer with several threads', function() {
+        this.timeout(20000)
+        // the normal equations of 25fv47 have supernodes large enough to be updated in parallel
+        let mps = require('path').join(testRoot, 'examples', '25fv47.mps')
+        let serial = new glp.Problem()
+        expect(serial.readMpsSync(glp.MPS_DECK, null, mps)).to.equal(0)
+        serial.interiorSync({msgLev: glp.MSG_OFF})
+        let parallel = new glp.Problem()
+        expect(parallel.readMpsSync(glp.MPS_DECK, null, mps)).to.equal(0)
+        parallel.interiorSync({msgLev: glp.MSG_OFF, numThr: 4})
+
+        expect(parallel.iptStatus()).to.equal(glp.OPT)
+        expect(parallel.iptObjVal()).to.equal(serial.iptObjVal())
+        for (let j = 1; j <= serial.getNumCols(); j++)
+            expect(parallel.iptColPrim(j)).to.equal(serial.iptColPrim(j))
+        serial.delete()
+        parallel.delete()
+    });
+})
+
+describe("Concurrent LP solve tests", function() {
+    it('should report the winning algorithm and its solution', function(done) {
+        this.timeout(10000)
+        let lp = setupSimplexLP()
+        lp.concurrentSolve({simplex: {msgLev: glp.MSG_OFF}, interior: {msgLev: glp.MSG_OFF}}, function(err, result) {
+            expect(err).to.equal(null)
+            expect(result.ret).to.equal(0)
+            expect(["primal", "dual", "interior"]).to.include(result.algorithm)
+            if (result.algorithm == "interior") {
+                expect(lp.iptStatus()).to.equal(glp.OPT)
+                expect(lp.iptObjVal()).to.be.within(...nearly(733 + 1/3, 10000))
+            }
+            expect(lp.getStatus()).to.equal(glp.OPT)
+            expect(lp.getObjVal()).to.be.within(...(nearly(733 + 1/3)))
+            done()
+        })
+    });
+
+    it('should leave an optimal basis when the interior point method wins', function() {
+        let lp = setupSimplexLP()
+        // neither simplex racer may iterate, so the interior point racer wins
+        let result = lp.concurrentSolveSync({simplex: {msgLev: glp.MSG_OFF, itLim: 0}, interior: {msgLev: glp.MSG_OFF}})
+        expect(result.algorithm).to.equal("interior")
+        expect(result.ret).to.equal(0)
+        expect(lp.iptStatus()).to.equal(glp.OPT)
+        expect(lp.iptXret()).to.equal(0)
+        expect(lp.getStatus()).to.equal(glp.OPT)
+        expect(lp.getObjVal()).to.be.within(...(nearly(733 + 1/3)))
+        expect(lp.getColPrim(1)).to.be.within(...(nearly(33 + 1/3)))
+        expect(lp.getColStat(3)).to.equal(glp.NL)
+        let it = lp.getItCnt()
+        lp.simplexSync({msgLev: glp.MSG_OFF})
+        expect(lp.getItCnt()).to.equal(it)
+    });
+
+    it('should reject unknown options', function() {
+        let lp = setupSimplexLP()
+        expect(() => lp.concurrentSolveSync({barrier: {}})).to.throw("Unknow field: barrier")
+    });
 })
 
 describe("Factorize problem tests", function() {